@@ -25,6 +25,8 @@
 #include <sound/soundmanager.h>
 #include <genesis.h>
 #include <log.hpp>
+#include <memorytracker.hpp>
+#include <performancecounters.h>
 
 #include "game.hpp"
 #include "sector/sector.h"
@@ -47,6 +49,7 @@ namespace Hyperscape
 AmmoManager::AmmoManager():
 m_Idx( 0 )
 {
+	GENESIS_MEMORY_SCOPE( Ammo );
 	for ( int i = 0; i < AmmoManagerCapacity; ++i )
 	{
 		m_pAmmo[ i ] = nullptr;
@@ -104,6 +107,11 @@ Ammo** AmmoManager::GetFreeAmmo()
 
 Ammo* AmmoManager::Create( Weapon* pWeapon, float additionalRotation /* = 0.0f */ )
 {
+	GENESIS_MEMORY_SCOPE( Ammo );
+
+	static Genesis::PerformanceCounter* sAmmoCreated = Genesis::PerformanceCounters::Register( "Ammo/Created", Genesis::PerformanceCounterType::Counter );
+	sAmmoCreated->Increment();
+
 	Ammo** ppAmmo = GetFreeAmmo();
 	if ( ppAmmo == nullptr )
 	{
@@ -151,17 +159,25 @@ Ammo* AmmoManager::Create( Weapon* pWeapon, float additionalRotation /* = 0.0f *
 
 void AmmoManager::Update( float delta )
 {
+	GENESIS_MEMORY_SCOPE( Ammo );
 	if ( g_pGame->IsPaused() )
 	{
 		return;
 	}
 
+	int liveAmmo = 0;
 	for ( int i = 0; i < AmmoManagerCapacity; ++i )
 	{
 		if ( m_pAmmo[ i ] != nullptr && m_pAmmo[ i ]->IsAlive() )
+		{
 			m_pAmmo[ i ]->Update( delta );
+			liveAmmo++;
+		}
 	}
 
+	static Genesis::PerformanceCounter* sLiveAmmo = Genesis::PerformanceCounters::Register( "Ammo/Live", Genesis::PerformanceCounterType::Gauge, AmmoManagerCapacity * 9 / 10 );
+	sLiveAmmo->Set( liveAmmo );
+
 	Genesis::Physics::Simulation* pPhysicsSimulation = g_pGame->GetPhysicsSimulation();
 	for ( int i = 0; i < AmmoManagerCapacity; ++i )
 	{
@@ -179,13 +195,12 @@ void AmmoManager::Update( float delta )
 
 			for ( auto& result : m_RayTestResults )
 			{
-				// If we've collided with a compound shape (the only shape that has child shapes) then the child
-				// shape is the one that has relevant collision info.
-				Genesis::Physics::ShapeSharedPtr pShape = !result.GetChildShape().expired() ? result.GetChildShape().lock() : result.GetShape().lock();
-				SDL_assert( pShape != nullptr );
+				// If we've collided with a compound shape (the only shape that has child shapes) then the result's
+				// user data is the one belonging to the child that was hit, which has the relevant collision info.
+				SDL_assert( !result.GetShape().expired() );
 
 				// Only collide with hostile ships.
-				ShipCollisionInfo* pCollisionInfo = reinterpret_cast< ShipCollisionInfo* >( pShape->GetUserData() );
+				ShipCollisionInfo* pCollisionInfo = reinterpret_cast< ShipCollisionInfo* >( result.GetUserData() );
 				if ( pCollisionInfo == nullptr )
 				{
 					continue;
@@ -332,12 +347,11 @@ void AmmoManager::PlayHitSFX( const glm::vec3& position, Weapon* pWeapon )
 	ResourceSound* pSFX = pWeapon->GetInfo()->GetOnHitSFX();
 	if ( pSFX != nullptr )
 	{
-		Sound::SoundInstanceSharedPtr pSoundInstance = FrameWork::GetSoundManager()->CreateSoundInstance( pSFX );
-		if ( pSoundInstance != nullptr )
-		{
-			pSoundInstance->Set3DAttributes( &position );
-			pSoundInstance->SetMinimumDistance( pWeapon->GetInfo()->GetOnHitSFXDistance() );
-		}
+		Sound::SoundRequest request;
+		request.pResource = pSFX;
+		request.position = position;
+		request.minimumDistance = pWeapon->GetInfo()->GetOnHitSFXDistance();
+		FrameWork::GetSoundManager()->QueueSound( request );
 	}
 }
 
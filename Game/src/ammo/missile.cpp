@@ -21,6 +21,7 @@
 #include <resources/resourcemodel.h>
 
 #include "ammo/missile.h"
+#include "misc/random.h"
 #include "sector/sector.h"
 #include "sprite/spritemanager.h"
 #include "sprite/sprite.h"
@@ -40,7 +41,7 @@ m_LaunchTimer( 0.0f ),
 m_GlowSize( 30.0f ),
 m_GlowColour( 0.8f, 0.8f, 0.8f, 1.0f )
 {
-	m_SwarmTimer = (float)(rand() % 314) / 100.0f;
+	m_SwarmTimer = Random::Next( 3.14f );
 }
 
 Missile::~Missile()
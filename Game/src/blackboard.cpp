@@ -84,6 +84,16 @@ bool Blackboard::Write( tinyxml2::XMLDocument& xmlDoc, tinyxml2::XMLElement* pRo
 	return true;
 }
 
+void Blackboard::Snapshot( SaveGameSnapshot& snapshot ) const
+{
+	snapshot.facts.clear();
+	snapshot.facts.reserve( m_Map.size() );
+	for ( auto& pair : m_Map )
+	{
+		snapshot.facts.push_back( { pair.first, pair.second } );
+	}
+}
+
 bool Blackboard::Read( tinyxml2::XMLElement* pRootElement ) 
 {
 	using namespace tinyxml2;
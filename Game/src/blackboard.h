@@ -25,6 +25,7 @@
 #include <externalheadersend.hpp>
 // clang-format on
 
+#include "savegamesnapshot.h"
 #include "serialisable.h"
 
 
@@ -51,6 +52,7 @@ public:
 	int						Get( const std::string& text ) const;
 	void					Clear();
 	void					UpdateDebugUI();
+	void					Snapshot( SaveGameSnapshot& snapshot ) const;
 
 	// Serialisable
 	virtual bool			Write( tinyxml2::XMLDocument& xmlDoc, tinyxml2::XMLElement* pRootElement ) override;
@@ -39,7 +39,7 @@ bool Component::Serialize(nlohmann::json& data)
 
 bool Component::Deserialize(const nlohmann::json& data) 
 {
-    // Type is intentionally not deserialized here, but left to the ComponentFactory to handle.
+    // Type is intentionally not deserialized here, but left to Entity::Deserialize(), which needs it to pick the ComponentPool.
     bool success = TryDeserialize(data, "version", m_Version);
     TryDeserialize(data, "name", m_Name); // "name" is optional.
     return success;
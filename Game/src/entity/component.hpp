@@ -31,6 +31,7 @@
 #include <coredefines.h>
 #include <scene/scene.h>
 
+#include "entity/componenthandle.hpp"
 #include "entity/componenttype.hpp"
 #include "jsonserialization.hpp"
 
@@ -57,6 +58,11 @@ public:
     virtual ~Component() {}
 
     virtual ComponentType GetType() const = 0;
+
+    // Called before Initialize() and whenever another component is added to an initialized entity.
+    // Components which need other components from the same entity should look them up here,
+    // rather than on every update.
+    virtual void ResolveDependencies() {}
     virtual void Initialize() = 0;
     virtual void Update(float delta) = 0;
     virtual void UpdateDebugUI() = 0;
@@ -75,6 +81,8 @@ public:
     void SetName(const std::string& name);
     const std::string& GetName() const;
     int GetVersion() const;
+    void SetHandle(const ComponentHandle& handle);
+    const ComponentHandle& GetHandle() const;
 
 protected:
     // Do not add template specializations here, use jsonserialization.hpp instead.
@@ -107,6 +115,7 @@ private:
     Entity* m_pEntity;
     std::string m_Name;
     int m_Version;
+    ComponentHandle m_Handle;
 };
 
 inline bool Component::UpdatesInEditor() const
@@ -144,4 +153,14 @@ inline int Component::GetVersion() const
     return m_Version;
 }
 
+inline void Component::SetHandle(const ComponentHandle& handle)
+{
+    m_Handle = handle;
+}
+
+inline const ComponentHandle& Component::GetHandle() const
+{
+    return m_Handle;
+}
+
 } // namespace Hyperscape
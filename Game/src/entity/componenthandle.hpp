@@ -1,4 +1,4 @@
-// Copyright 2021 Pedro Nunes
+// Copyright 2026 Pedro Nunes
 //
 // This file is part of Hyperscape.
 //
@@ -15,19 +15,25 @@
 // You should have received a copy of the GNU General Public License
 // along with Hyperscape. If not, see <http://www.gnu.org/licenses/>.
 
-#include <chrono>
+#pragma once
 
-#include "misc/randomshuffle.h"
+#include <cstdint>
+
+#include "entity/componenttype.hpp"
 
 namespace Hyperscape
 {
 
-std::default_random_engine RandomShuffle::m_Engine = std::default_random_engine();
-
-void RandomShuffle::Initialise()
+// Identifies a component in its pool. Handles remain valid for as long as the
+// component is alive, and resolve to nullptr once the component is destroyed,
+// even if its slot has been reused by another component since.
+struct ComponentHandle
 {
-	const unsigned int seed = static_cast<unsigned int>( std::chrono::system_clock::now().time_since_epoch().count() );
-	m_Engine = std::default_random_engine( seed );
-}
+    ComponentType type = ComponentType::Count;
+    uint32_t index = 0;
+    uint32_t generation = 0;
+
+    bool IsValid() const { return type != ComponentType::Count; }
+};
 
 } // namespace Hyperscape
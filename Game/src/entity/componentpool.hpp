@@ -0,0 +1,222 @@
+// Copyright 2026 Pedro Nunes
+//
+// This file is part of Hyperscape.
+//
+// Hyperscape is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Hyperscape is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Hyperscape. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+#include <SDL.h>
+
+#include "entity/component.hpp"
+#include "entity/componenthandle.hpp"
+#include "entity/entity.hpp"
+
+namespace Hyperscape
+{
+
+class ComponentPoolBase
+{
+public:
+    virtual ~ComponentPoolBase() {}
+
+    virtual Component* Create() = 0;
+    virtual void Destroy(const ComponentHandle& handle) = 0;
+    virtual Component* Get(const ComponentHandle& handle) const = 0;
+
+    // Makes sure that at least this many components can be created without the pool allocating.
+    virtual void Reserve(size_t count) = 0;
+
+    // Updates every component in the pool which belongs to an entity in a scene.
+    virtual void Update(float delta) = 0;
+
+    virtual size_t GetSize() const = 0;
+    virtual size_t GetCapacity() const = 0;
+};
+
+/////////////////////////////////////////////////////////////////////
+// ComponentPool
+// Stores all the components of a given type in fixed size blocks.
+// Blocks are never moved or freed while the pool is alive, so the
+// address of a component is stable for its entire lifetime and other
+// components can keep pointers to it.
+// Slots freed by destroyed components are reused, with a generation
+// counter making sure stale handles don't resolve to the new occupant.
+/////////////////////////////////////////////////////////////////////
+
+template <typename T> class ComponentPool : public ComponentPoolBase
+{
+public:
+    ComponentPool()
+        : m_Size(0)
+    {
+    }
+
+    virtual ~ComponentPool() override
+    {
+        for (size_t blockIndex = 0; blockIndex < m_Blocks.size(); ++blockIndex)
+        {
+            Block* pBlock = m_Blocks[blockIndex].get();
+            for (uint32_t slot = 0; slot < sBlockSize; ++slot)
+            {
+                if (pBlock->alive[slot])
+                {
+                    GetComponent(pBlock, slot)->~T();
+                }
+            }
+        }
+    }
+
+    virtual Component* Create() override
+    {
+        if (m_FreeIndices.empty())
+        {
+            AddBlock();
+        }
+
+        const uint32_t index = m_FreeIndices.back();
+        m_FreeIndices.pop_back();
+
+        Block* pBlock = m_Blocks[index / sBlockSize].get();
+        const uint32_t slot = index % sBlockSize;
+        T* pComponent = new (&pBlock->components[slot]) T();
+        pBlock->alive[slot] = true;
+        pComponent->SetHandle(ComponentHandle{T::sType, index, pBlock->generations[slot]});
+        m_Size++;
+        return pComponent;
+    }
+
+    virtual void Destroy(const ComponentHandle& handle) override
+    {
+        SDL_assert(handle.type == T::sType);
+        Block* pBlock = m_Blocks[handle.index / sBlockSize].get();
+        const uint32_t slot = handle.index % sBlockSize;
+        if (pBlock->alive[slot] && pBlock->generations[slot] == handle.generation)
+        {
+            GetComponent(pBlock, slot)->~T();
+            pBlock->alive[slot] = false;
+            pBlock->generations[slot]++;
+            m_FreeIndices.push_back(handle.index);
+            m_Size--;
+        }
+    }
+
+    virtual Component* Get(const ComponentHandle& handle) const override
+    {
+        if (handle.type != T::sType || handle.index >= m_Blocks.size() * sBlockSize)
+        {
+            return nullptr;
+        }
+
+        Block* pBlock = m_Blocks[handle.index / sBlockSize].get();
+        const uint32_t slot = handle.index % sBlockSize;
+        return (pBlock->alive[slot] && pBlock->generations[slot] == handle.generation) ? GetComponent(pBlock, slot) : nullptr;
+    }
+
+    virtual void Reserve(size_t count) override
+    {
+        while (m_FreeIndices.size() < count)
+        {
+            AddBlock();
+        }
+    }
+
+    // The calls are qualified with the component type so they can be resolved at compile time
+    // rather than going through the vtable for every component.
+    virtual void Update(float delta) override
+    {
+        // Indices rather than iterators, as updating a component can create other components.
+        for (size_t blockIndex = 0; blockIndex < m_Blocks.size(); ++blockIndex)
+        {
+            Block* pBlock = m_Blocks[blockIndex].get();
+            for (uint32_t slot = 0; slot < sBlockSize; ++slot)
+            {
+                if (pBlock->alive[slot] == false)
+                {
+                    continue;
+                }
+
+                T* pComponent = GetComponent(pBlock, slot);
+                Entity* pOwner = pComponent->GetOwner();
+                if (pOwner == nullptr || pOwner->GetScene() == nullptr)
+                {
+                    continue;
+                }
+                else if (pOwner->IsEditorEntity() && pComponent->T::UpdatesInEditor() == false)
+                {
+                    continue;
+                }
+
+                pComponent->T::Update(delta);
+            }
+        }
+    }
+
+    virtual size_t GetSize() const override
+    {
+        return m_Size;
+    }
+
+    virtual size_t GetCapacity() const override
+    {
+        return m_Blocks.size() * sBlockSize;
+    }
+
+private:
+    static const uint32_t sBlockSize = 64;
+
+    struct Block
+    {
+        Block()
+        {
+            for (uint32_t slot = 0; slot < sBlockSize; ++slot)
+            {
+                generations[slot] = 0;
+                alive[slot] = false;
+            }
+        }
+
+        typename std::aligned_storage<sizeof(T), alignof(T)>::type components[sBlockSize];
+        uint32_t generations[sBlockSize];
+        bool alive[sBlockSize];
+    };
+
+    void AddBlock()
+    {
+        const uint32_t firstIndex = static_cast<uint32_t>(m_Blocks.size()) * sBlockSize;
+        m_Blocks.push_back(std::make_unique<Block>());
+        m_FreeIndices.reserve(m_FreeIndices.size() + sBlockSize);
+        for (uint32_t slot = sBlockSize; slot > 0; --slot)
+        {
+            m_FreeIndices.push_back(firstIndex + slot - 1);
+        }
+    }
+
+    static T* GetComponent(Block* pBlock, uint32_t slot)
+    {
+        return std::launder(reinterpret_cast<T*>(&pBlock->components[slot]));
+    }
+
+    std::vector<std::unique_ptr<Block>> m_Blocks;
+    std::vector<uint32_t> m_FreeIndices;
+    size_t m_Size;
+};
+
+} // namespace Hyperscape
@@ -0,0 +1,136 @@
+// Copyright 2026 Pedro Nunes
+//
+// This file is part of Hyperscape.
+//
+// Hyperscape is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Hyperscape is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Hyperscape. If not, see <http://www.gnu.org/licenses/>.
+
+#include "entity/componentpools.hpp"
+
+// clang-format off
+#include <externalheadersbegin.hpp>
+#include <magic_enum.hpp>
+#include <externalheadersend.hpp>
+// clang-format on
+
+#include <imgui/imgui.h>
+#include <imgui/imgui_impl.h>
+
+#include "entity/componentpool.hpp"
+#include "entity/components/cameracomponent.hpp"
+#include "entity/components/enginecomponent.hpp"
+#include "entity/components/hullcomponent.hpp"
+#include "entity/components/modelcomponent.hpp"
+#include "entity/components/navigationcomponent.hpp"
+#include "entity/components/playercontrollercomponent.hpp"
+#include "entity/components/reactorcomponent.hpp"
+#include "entity/components/rigidbodycomponent.hpp"
+#include "entity/components/shipdetailscomponent.hpp"
+#include "entity/components/swaycomponent.hpp"
+#include "entity/components/trailcomponent.hpp"
+#include "entity/components/transformcomponent.hpp"
+#include "entity/components/weaponcomponent.hpp"
+
+namespace Hyperscape
+{
+
+#define REGISTER_COMPONENT_POOL( COMPONENT_NAME ) \
+    m_Pools[ static_cast<size_t>( COMPONENT_NAME::sType ) ] = std::make_unique<ComponentPool<COMPONENT_NAME>>();
+
+ComponentPools::ComponentPools()
+    : m_DebugUIOpen( false )
+{
+    REGISTER_COMPONENT_POOL( CameraComponent );
+    REGISTER_COMPONENT_POOL( EngineComponent );
+    REGISTER_COMPONENT_POOL( ModelComponent );
+    REGISTER_COMPONENT_POOL( NavigationComponent );
+    REGISTER_COMPONENT_POOL( PlayerControllerComponent );
+    REGISTER_COMPONENT_POOL( TransformComponent );
+    REGISTER_COMPONENT_POOL( RigidBodyComponent );
+    REGISTER_COMPONENT_POOL( TrailComponent );
+    REGISTER_COMPONENT_POOL( SwayComponent );
+    REGISTER_COMPONENT_POOL( ShipDetailsComponent );
+    REGISTER_COMPONENT_POOL( HullComponent );
+    REGISTER_COMPONENT_POOL( ReactorComponent );
+    REGISTER_COMPONENT_POOL( WeaponComponent );
+
+    Genesis::ImGuiImpl::RegisterDevMenu( "Game", "Component pools", &m_DebugUIOpen );
+}
+
+ComponentPools::~ComponentPools()
+{
+    Genesis::ImGuiImpl::UnregisterDevMenu( "Game", "Component pools" );
+}
+
+ComponentPools* ComponentPools::Get()
+{
+    // Intentionally never destroyed: entities owned by other globals (such as the EntityFactory's
+    // templates) return their components to the pools during static destruction, which happens in
+    // an unspecified order across translation units.
+    static ComponentPools* sComponentPools = new ComponentPools();
+    return sComponentPools;
+}
+
+Component* ComponentPools::Create( ComponentType type )
+{
+    return m_Pools[ static_cast<size_t>( type ) ]->Create();
+}
+
+void ComponentPools::Destroy( Component* pComponent )
+{
+    const ComponentHandle& handle = pComponent->GetHandle();
+    m_Pools[ static_cast<size_t>( handle.type ) ]->Destroy( handle );
+}
+
+Component* ComponentPools::Get( const ComponentHandle& handle ) const
+{
+    return handle.IsValid() ? m_Pools[ static_cast<size_t>( handle.type ) ]->Get( handle ) : nullptr;
+}
+
+void ComponentPools::Reserve( ComponentType type, size_t count )
+{
+    m_Pools[ static_cast<size_t>( type ) ]->Reserve( count );
+}
+
+void ComponentPools::Update( float delta )
+{
+    for ( auto& pPool : m_Pools )
+    {
+        pPool->Update( delta );
+    }
+}
+
+void ComponentPools::UpdateDebugUI()
+{
+#ifndef _FINAL
+    if ( m_DebugUIOpen )
+    {
+        ImGui::Begin( "Component pools", &m_DebugUIOpen );
+        ImGui::Columns( 3 );
+        ImGui::Text( "Component" ); ImGui::NextColumn();
+        ImGui::Text( "Alive" ); ImGui::NextColumn();
+        ImGui::Text( "Capacity" ); ImGui::NextColumn();
+        for ( size_t i = 0; i < m_Pools.size(); ++i )
+        {
+            auto name = magic_enum::enum_name( static_cast<ComponentType>( i ) );
+            ImGui::Text( "%.*s", static_cast<int>( name.size() ), name.data() ); ImGui::NextColumn();
+            ImGui::Text( "%d", static_cast<int>( m_Pools[ i ]->GetSize() ) ); ImGui::NextColumn();
+            ImGui::Text( "%d", static_cast<int>( m_Pools[ i ]->GetCapacity() ) ); ImGui::NextColumn();
+        }
+        ImGui::Columns( 1 );
+        ImGui::End();
+    }
+#endif
+}
+
+} // namespace Hyperscape
@@ -0,0 +1,66 @@
+// Copyright 2026 Pedro Nunes
+//
+// This file is part of Hyperscape.
+//
+// Hyperscape is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Hyperscape is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Hyperscape. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <array>
+#include <memory>
+
+#include "entity/componenthandle.hpp"
+#include "entity/componenttype.hpp"
+
+namespace Hyperscape
+{
+
+class Component;
+class ComponentPoolBase;
+
+/////////////////////////////////////////////////////////////////////
+// ComponentPools
+// Owns the storage for every component, with one pool per component
+// type. Entities only hold pointers into the pools.
+// Components are updated system by system: all the components of a
+// type are updated before moving on to the next type, in the order
+// of ComponentType.
+/////////////////////////////////////////////////////////////////////
+
+class ComponentPools
+{
+public:
+    ComponentPools();
+    ~ComponentPools();
+
+    static ComponentPools* Get();
+
+    Component* Create(ComponentType type);
+    void Destroy(Component* pComponent);
+    Component* Get(const ComponentHandle& handle) const;
+    void Reserve(ComponentType type, size_t count);
+    template <typename T> T* Get(const ComponentHandle& handle) const
+    {
+        return static_cast<T*>(Get(handle));
+    }
+
+    void Update(float delta);
+    void UpdateDebugUI();
+
+private:
+    std::array<std::unique_ptr<ComponentPoolBase>, static_cast<size_t>(ComponentType::Count)> m_Pools;
+    bool m_DebugUIOpen;
+};
+
+} // namespace Hyperscape
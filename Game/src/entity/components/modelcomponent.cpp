@@ -32,12 +32,28 @@ namespace Hyperscape
 
 ModelComponent::ModelComponent()
     : m_pModel(nullptr)
+    , m_ModelLoaded(false)
+    , m_pTransformComponent(nullptr)
 {
 }
 
 ModelComponent::~ModelComponent() {}
 
+void ModelComponent::ResolveDependencies()
+{
+    m_pTransformComponent = GetOwner()->GetComponent<TransformComponent>();
+}
+
+// Components cloned from a template share the template's model, so only the template has to look it up.
 void ModelComponent::Initialize() 
+{
+    if (m_ModelLoaded == false)
+    {
+        LoadModel();
+    }
+}
+
+void ModelComponent::LoadModel()
 {
     using namespace Genesis;
     if (std::filesystem::exists(m_Filename) && std::filesystem::is_regular_file(m_Filename))
@@ -48,6 +64,7 @@ void ModelComponent::Initialize()
     {
         m_pModel = nullptr;
     }
+    m_ModelLoaded = true;
 }
 
 void ModelComponent::Update(float delta) {}
@@ -56,7 +73,7 @@ void ModelComponent::UpdateDebugUI()
 {
     if (ImGui::InputText("Model", &m_Filename))
     {
-        Initialize();
+        LoadModel();
     }
 }
 
@@ -65,10 +82,9 @@ void ModelComponent::Render()
     if (m_pModel != nullptr)
     {
         glm::mat4 transform(1.0f);
-        TransformComponent* pTransformComponent = GetOwner()->GetComponent<TransformComponent>();
-        if (pTransformComponent)
+        if (m_pTransformComponent)
         {
-            transform = pTransformComponent->GetTransform();
+            transform = m_pTransformComponent->GetTransform();
         }
 
         m_pModel->Render(transform);
@@ -94,6 +110,8 @@ void ModelComponent::CloneFrom(Component* pComponent)
     Component::CloneFrom(pComponent);
     ModelComponent* pModelComponent = reinterpret_cast<ModelComponent*>(pComponent);
     m_Filename = pModelComponent->m_Filename;
+    m_pModel = pModelComponent->m_pModel;
+    m_ModelLoaded = pModelComponent->m_ModelLoaded;
 }
 
 } // namespace Hyperscape
@@ -29,12 +29,15 @@ class ResourceModel;
 namespace Hyperscape
 {
 
+class TransformComponent;
+
 class ModelComponent : public Component
 {
 public:
     ModelComponent();
     virtual ~ModelComponent() override;
 
+    virtual void ResolveDependencies() override;
     virtual void Initialize() override;
     virtual void Update(float delta) override;
     virtual void UpdateDebugUI() override;
@@ -46,8 +49,12 @@ public:
     DEFINE_COMPONENT(ModelComponent);
 
 private:
+    void LoadModel();
+
     std::string m_Filename;
     Genesis::ResourceModel* m_pModel;
+    bool m_ModelLoaded;
+    TransformComponent* m_pTransformComponent;
 };
 
 } // namespace Hyperscape
@@ -41,30 +41,36 @@ NavigationComponent::NavigationComponent()
     , m_SourceRotation(0.0f, 0.0f, 0.0f, 0.0f)
     , m_TargetRotation(0.0f, 0.0f, 0.0f, 0.0f)
     , m_TargetInterpolation(1.0f)
+    , m_pTransformComponent(nullptr)
+    , m_pEngineComponent(nullptr)
 {
 }
 
+void NavigationComponent::ResolveDependencies()
+{
+    m_pTransformComponent = GetOwner()->GetComponent<TransformComponent>();
+    m_pEngineComponent = GetOwner()->GetComponent<EngineComponent>();
+}
+
 void NavigationComponent::Update(float delta)
 {
-    TransformComponent* pTransformComponent = GetOwner()->GetComponent<TransformComponent>();
-    if (pTransformComponent == nullptr)
+    if (m_pTransformComponent == nullptr)
     {
         return;
     }
 
     m_TargetInterpolation = glm::min(m_TargetInterpolation + delta, 1.0f);
-    glm::mat4x4 translationTransform(glm::translate(glm::vec3(pTransformComponent->GetTransform()[3])));
+    glm::mat4x4 translationTransform(glm::translate(glm::vec3(m_pTransformComponent->GetTransform()[3])));
     glm::mat4x4 rotationTransform(glm::slerp(m_SourceRotation, m_TargetRotation, m_TargetInterpolation));
 
     float speed = 0.0f;
-    EngineComponent* pEngineComponent = GetOwner()->GetComponent<EngineComponent>();
-    if (pEngineComponent != nullptr)
+    if (m_pEngineComponent != nullptr)
     {
-        speed = pEngineComponent->GetCurrentSpeed() * delta;
+        speed = m_pEngineComponent->GetCurrentSpeed() * delta;
     }
 
     glm::mat4x4 newTransform = translationTransform * rotationTransform * glm::translate(glm::vec3(speed, 0.0f, 0.0f));
-    pTransformComponent->SetTransform(newTransform);
+    m_pTransformComponent->SetTransform(newTransform);
 }
 
 bool NavigationComponent::Serialize(nlohmann::json& data)
@@ -88,13 +94,12 @@ void NavigationComponent::FlyTowards(const glm::vec3& direction)
 {
     m_Mode = Mode::Direction;
 
-    TransformComponent* pTransformComponent = GetOwner()->GetComponent<TransformComponent>();
-    if (pTransformComponent == nullptr)
+    if (m_pTransformComponent == nullptr)
     {
         return;
     }
 
-    const glm::mat4x4& currentTransform = pTransformComponent->GetTransform();
+    const glm::mat4x4& currentTransform = m_pTransformComponent->GetTransform();
 
     const glm::vec3 upAbsolute(0.0f, 1.0f, 0.0f);
     const glm::vec3 right = glm::cross(direction, upAbsolute);
@@ -108,10 +113,9 @@ void NavigationComponent::FlyTowards(const glm::vec3& direction)
     m_TargetRotation = glm::quat(directionTransform);
     m_TargetInterpolation = 0.0f;
 
-    EngineComponent* pEngineComponent = GetOwner()->GetComponent<EngineComponent>();
-    if (pEngineComponent != nullptr)
+    if (m_pEngineComponent != nullptr)
     {
-        pEngineComponent->SetTargetThrottle(1.0f);
+        m_pEngineComponent->SetTargetThrottle(1.0f);
     }
 }
 
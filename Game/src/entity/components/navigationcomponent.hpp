@@ -30,12 +30,16 @@
 namespace Hyperscape
 {
 
+class EngineComponent;
+class TransformComponent;
+
 class NavigationComponent : public Component
 {
 public:
     NavigationComponent();
     virtual ~NavigationComponent() override {}
 
+    virtual void ResolveDependencies() override;
     virtual void Initialize() override {}
     virtual void Update(float delta) override;
     virtual void UpdateDebugUI() override {}
@@ -62,6 +66,9 @@ private:
     glm::quat m_SourceRotation;
     glm::quat m_TargetRotation;
     float m_TargetInterpolation;
+
+    TransformComponent* m_pTransformComponent;
+    EngineComponent* m_pEngineComponent;
 };
 
 inline bool NavigationComponent::UpdatesInEditor() const
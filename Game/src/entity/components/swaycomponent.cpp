@@ -34,6 +34,7 @@ SwayComponent::SwayComponent()
     , m_BaseTransformSet(false)
     , m_BaseTransform(1.0f)
     , m_Amplitude(1.0f)
+    , m_pTransformComponent(nullptr)
 {
     m_Values[0] = gRand(0.0f, 100.0f);
     m_Values[1] = gRand(0.0f, 100.0f);
@@ -45,20 +46,24 @@ void SwayComponent::UpdateDebugUI()
 
 }
 
+void SwayComponent::ResolveDependencies()
+{
+    m_pTransformComponent = GetOwner()->GetComponent<TransformComponent>();
+}
+
 void SwayComponent::Update(float delta)
 {
-    TransformComponent* pTransformComponent = GetOwner()->GetComponent<TransformComponent>();
-    if (!m_BaseTransformSet && pTransformComponent )
+    if (!m_BaseTransformSet && m_pTransformComponent )
     {
-        m_BaseTransform = pTransformComponent->GetTransform();
+        m_BaseTransform = m_pTransformComponent->GetTransform();
         m_BaseTransformSet = true;
     }
 
-    if ( m_BaseTransformSet && pTransformComponent )
+    if ( m_BaseTransformSet && m_pTransformComponent )
     {
         m_Values += glm::vec3(delta * 0.81, delta * 0.73, delta * 0.66);
         glm::mat4x4 m = m_BaseTransform * glm::translate(glm::cos(m_Values));
-        pTransformComponent->SetTransform(m);
+        m_pTransformComponent->SetTransform(m);
     }
 }
 
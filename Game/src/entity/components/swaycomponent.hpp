@@ -32,12 +32,15 @@
 namespace Hyperscape
 {
 
+class TransformComponent;
+
 class SwayComponent : public Component
 {
 public:
     SwayComponent();
     virtual ~SwayComponent() override {}
 
+    virtual void ResolveDependencies() override;
     virtual void Initialize() override {}
     virtual void Update(float delta) override;
     virtual void UpdateDebugUI() override;
@@ -54,6 +57,7 @@ private:
     glm::mat4x4 m_BaseTransform;
     float m_Amplitude;
     glm::vec3 m_Values;
+    TransformComponent* m_pTransformComponent;
 };
 
 } // namespace Hyperscape
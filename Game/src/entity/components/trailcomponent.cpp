@@ -42,6 +42,11 @@ TrailComponent::TrailComponent()
     , m_DebugRender(false)
     , m_pSpriteManager(nullptr)
     , m_pTrailManager(nullptr)
+    , m_pTransformComponent(nullptr)
+    , m_WorldTransform(1.0f)
+    , m_WorldTransformOffset(0.0f)
+    , m_WorldTransformRevision(0)
+    , m_WorldTransformValid(false)
 {
 }
 
@@ -54,6 +59,12 @@ TrailComponent::~TrailComponent()
     }
 }
 
+void TrailComponent::ResolveDependencies()
+{
+    m_pTransformComponent = GetOwner()->GetComponent<TransformComponent>();
+    m_WorldTransformValid = false;
+}
+
 void TrailComponent::Update(float delta)
 {
     if (m_pTrail.expired() && m_pTrailManager)
@@ -61,22 +72,15 @@ void TrailComponent::Update(float delta)
         m_pTrail = m_pTrailManager->Add(m_Width, m_Lifetime, m_Color);
     }
 
-    TransformComponent* pTransformComponent = GetOwner()->GetComponent<TransformComponent>();
-    glm::mat4x4 transform(1.0f);
-    if (pTransformComponent)
+    const glm::mat4x4& transform = GetWorldTransform();
+    if (m_pTransformComponent)
     {
-        transform = pTransformComponent->GetTransform() * glm::translate(m_Offset);
-
         TrailSharedPtr pTrail = m_pTrail.lock();
         if (pTrail)
         {
             pTrail->AddPoint(transform);
         }
     }
-    else
-    {
-        transform = glm::translate(m_Offset);
-    }
 
     if (m_pSpriteManager != nullptr)
     {
@@ -109,16 +113,30 @@ void TrailComponent::Render()
     using namespace Genesis;
     if (m_DebugRender)
     {
-        glm::mat4x4 transform(1.0f);
+        const glm::mat4x4& transform = GetWorldTransform();
+        Genesis::FrameWork::GetDebugRender()->DrawCross(glm::vec3(transform[3]), m_Width, glm::vec3(1.0f));
+    }
+}
 
-        TransformComponent* pTransformComponent = GetOwner()->GetComponent<TransformComponent>();
-        if (pTransformComponent)
+const glm::mat4x4& TrailComponent::GetWorldTransform()
+{
+    const uint32_t revision = m_pTransformComponent ? m_pTransformComponent->GetRevision() : 0;
+    if (m_WorldTransformValid == false || m_WorldTransformRevision != revision || m_WorldTransformOffset != m_Offset)
+    {
+        if (m_pTransformComponent)
         {
-            transform = pTransformComponent->GetTransform() * glm::translate(m_Offset);
+            m_WorldTransform = m_pTransformComponent->GetTransform() * glm::translate(m_Offset);
+        }
+        else
+        {
+            m_WorldTransform = glm::translate(m_Offset);
         }
 
-        Genesis::FrameWork::GetDebugRender()->DrawCross(glm::vec3(transform[3]), m_Width, glm::vec3(1.0f));
+        m_WorldTransformOffset = m_Offset;
+        m_WorldTransformRevision = revision;
+        m_WorldTransformValid = true;
     }
+    return m_WorldTransform;
 }
 
 bool TrailComponent::Serialize(nlohmann::json& data)
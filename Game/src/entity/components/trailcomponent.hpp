@@ -33,6 +33,7 @@ namespace Hyperscape
 
 GENESIS_DECLARE_SMART_PTR(Trail);
 class SpriteManager;
+class TransformComponent;
 class TrailManager;
 
 class TrailComponent : public Component
@@ -41,6 +42,7 @@ public:
     TrailComponent();
     virtual ~TrailComponent() override;
 
+    virtual void ResolveDependencies() override;
     virtual void Initialize() override {}
     virtual void Update(float delta) override;
     virtual void UpdateDebugUI() override;
@@ -54,6 +56,8 @@ public:
     DEFINE_COMPONENT(TrailComponent);
 
 private:
+    const glm::mat4x4& GetWorldTransform();
+
     TrailWeakPtr m_pTrail;
     glm::vec3 m_Offset;
     float m_Width;
@@ -62,6 +66,13 @@ private:
     bool m_DebugRender;
     SpriteManager* m_pSpriteManager;
     TrailManager* m_pTrailManager;
+    TransformComponent* m_pTransformComponent;
+
+    // Cached result of GetWorldTransform(), only recalculated when the owner's transform or our offset change.
+    glm::mat4x4 m_WorldTransform;
+    glm::vec3 m_WorldTransformOffset;
+    uint32_t m_WorldTransformRevision;
+    bool m_WorldTransformValid;
 };
 
 } // namespace Hyperscape
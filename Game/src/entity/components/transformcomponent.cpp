@@ -27,6 +27,7 @@ namespace Hyperscape
 TransformComponent::TransformComponent()
     : m_Version(1)
     , m_Transform(1)
+    , m_Revision(0)
 {
 }
 
@@ -40,6 +41,7 @@ void TransformComponent::UpdateDebugUI()
         if (ImGui::InputFloat4(label.str().c_str(), v))
         {
             m_Transform[i] = glm::vec4(v[0], v[1], v[2], v[3]);
+            m_Revision++;
         }
     }
 }
@@ -49,12 +49,17 @@ public:
     const glm::vec3 GetPosition() const;
     void SetTransform(const glm::mat4x4& value);
 
+    // Incremented whenever the transform actually changes, so that components which
+    // derive their own transforms from this one only need to recalculate them then.
+    uint32_t GetRevision() const;
+
 
     DEFINE_COMPONENT(TransformComponent);
 
 private:
     uint16_t m_Version;
     glm::mat4x4 m_Transform;
+    uint32_t m_Revision;
 };
 
 inline const glm::mat4x4& TransformComponent::GetTransform() const
@@ -69,7 +74,16 @@ inline const glm::vec3 TransformComponent::GetPosition() const
 
 inline void TransformComponent::SetTransform(const glm::mat4x4& value)
 {
-    m_Transform = value;
+    if (m_Transform != value)
+    {
+        m_Transform = value;
+        m_Revision++;
+    }
+}
+
+inline uint32_t TransformComponent::GetRevision() const
+{
+    return m_Revision;
 }
 
 } // namespace Hyperscape
@@ -34,6 +34,7 @@ WeaponComponent::WeaponComponent()
     : m_WeaponType( WeaponType::Turret )
     , m_Offset(0.0f)
     , m_DebugRender(false)
+    , m_pTransformComponent(nullptr)
 {
 }
 
@@ -42,6 +43,11 @@ WeaponComponent::~WeaponComponent()
 
 }
 
+void WeaponComponent::ResolveDependencies()
+{
+    m_pTransformComponent = GetOwner()->GetComponent<TransformComponent>();
+}
+
 void WeaponComponent::Update(float delta)
 {
 
@@ -63,10 +69,9 @@ void WeaponComponent::Render()
     {
         glm::mat4x4 transform(1.0f);
 
-        TransformComponent* pTransformComponent = GetOwner()->GetComponent<TransformComponent>();
-        if (pTransformComponent)
+        if (m_pTransformComponent)
         {
-            transform = pTransformComponent->GetTransform() * glm::translate(m_Offset);
+            transform = m_pTransformComponent->GetTransform() * glm::translate(m_Offset);
         }
 
         Genesis::FrameWork::GetDebugRender()->DrawCross(glm::vec3(transform[3]), 10.0f, glm::vec3(1.0f));
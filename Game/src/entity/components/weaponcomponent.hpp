@@ -32,12 +32,15 @@
 namespace Hyperscape
 {
 
+class TransformComponent;
+
 class WeaponComponent : public Component
 {
 public:
     WeaponComponent();
     virtual ~WeaponComponent() override;
 
+    virtual void ResolveDependencies() override;
     virtual void Initialize() override {}
     virtual void Update( float delta ) override;
     virtual void UpdateDebugUI() override;
@@ -52,6 +55,7 @@ private:
     WeaponType m_WeaponType;
     glm::vec3 m_Offset;
     bool m_DebugRender;
+    TransformComponent* m_pTransformComponent;
 };
 
 } // namespace Hyperscape
@@ -30,54 +30,74 @@
 #include <scene/scene.h>
 
 #include "entity/component.hpp"
-#include "entity/componentfactory.hpp"
+#include "entity/componentpools.hpp"
 
 namespace Hyperscape
 {
 
+Entity::Entity()
+    : m_IsEditorEntity(false)
+    , m_IsInitialized(false)
+{
+}
+
 Entity::Entity(const Entity& other) 
     : m_IsEditorEntity(false)
+    , m_IsInitialized(false)
 {
-    for (Component* pOtherComponent : other.GetComponents())
+    for (size_t i = 0; i < m_Components.size(); ++i)
     {
-        ComponentUniquePtr pComponent = ComponentFactory::Get()->Create(pOtherComponent->GetType());
-        pComponent->CloneFrom(pOtherComponent);
-        AddComponent(std::move(pComponent));
+        m_Components[i].reserve(other.m_Components[i].size());
+        for (Component* pOtherComponent : other.m_Components[i])
+        {
+            AddComponent(pOtherComponent->GetType())->CloneFrom(pOtherComponent);
+        }
     }
 
-    for (Component* pComponent : GetComponents())
+    InitializeComponents();
+}
+
+Entity::~Entity()
+{
+    ComponentPools* pPools = ComponentPools::Get();
+    for (auto& components : m_Components)
     {
-        pComponent->Initialize();
+        for (Component* pComponent : components)
+        {
+            pPools->Destroy(pComponent);
+        }
     }
 }
 
-void Entity::AddComponent(ComponentUniquePtr pComponent) 
+Component* Entity::AddComponent(ComponentType type)
 {
+    Component* pComponent = ComponentPools::Get()->Create(type);
     pComponent->SetOwner(this);
-	m_Components[static_cast<size_t>(pComponent->GetType())].push_back(std::move(pComponent));
-}
+    m_Components[static_cast<size_t>(type)].push_back(pComponent);
 
-void Entity::Update(float delta) 
-{
-    for (size_t i = 0; i < m_Components.size(); ++i)
+    // Components which have already been initialized might depend on the new one.
+    if (m_IsInitialized)
     {
-        for (auto& pComponent : m_Components[i])
+        for (Component* pOtherComponent : GetComponents())
         {
-            if (IsEditorEntity() && pComponent->UpdatesInEditor() == false)
-            {
-                continue;
-            }
-
-            pComponent->Update(delta);
+            pOtherComponent->ResolveDependencies();
         }
     }
+
+    return pComponent;
+}
+
+// Components built outside of the pools are cloned into them.
+void Entity::AddComponent(ComponentUniquePtr pComponent) 
+{
+    AddComponent(pComponent->GetType())->CloneFrom(pComponent.get());
 }
 
 void Entity::Render( const Genesis::SceneCameraSharedPtr& pCamera )
 {
     for (size_t i = 0; i < m_Components.size(); ++i)
     {
-        for (auto& pComponent : m_Components[i])
+        for (Component* pComponent : m_Components[i])
         {
             pComponent->Render();
         }
@@ -88,7 +108,7 @@ void Entity::OnAddedToScene(Genesis::Scene* pScene)
 {
     for (auto& components : m_Components)
     {
-        for (auto& pComponent : components)
+        for (Component* pComponent : components)
         {
             pComponent->OnAddedToScene(pScene);
         }
@@ -99,7 +119,7 @@ void Entity::OnRemovedFromScene()
 {
     for (auto& components : m_Components)
     {
-        for (auto& pComponent : components)
+        for (Component* pComponent : components)
         {
             pComponent->OnRemovedFromScene();
         }
@@ -112,9 +132,9 @@ std::vector<Component*> Entity::GetComponents() const
 
 	for (size_t i = 0; i < m_Components.size(); ++i)
     {
-		for (auto& pComponent : m_Components[i])
+		for (Component* pComponent : m_Components[i])
         {
-			components.push_back(pComponent.get());
+			components.push_back(pComponent);
 		}
     }
 
@@ -131,7 +151,7 @@ bool Entity::Serialize(nlohmann::json& data)
         if (!typeComponents.empty())
         {
             json jTypeComponents = json::object();   
-            for (auto& pComponent : typeComponents)
+            for (Component* pComponent : typeComponents)
             {
                 json jComponent = json::object();
                 success &= pComponent->Serialize(jComponent);
@@ -157,21 +177,21 @@ bool Entity::Deserialize(const nlohmann::json& jData)
             if (typeIt != jComponent.cend())
             {
                 const std::string& typeName = typeIt.value().get<std::string>();
-                ComponentUniquePtr pComponent = std::move(ComponentFactory::Get()->Create(typeName));
-                if (pComponent == nullptr)
+                auto type = magic_enum::enum_cast<ComponentType>(typeName);
+                if (type.has_value() == false || type.value() == ComponentType::Count)
                 {
                     Log::Error() << "Failed to create component of type '" << typeName << "'.";
                     return false;
                 }
-                else if (!pComponent->Deserialize(jComponent))
+
+                Component* pComponent = AddComponent(type.value());
+                if (!pComponent->Deserialize(jComponent))
                 {
                     Log::Error() << "Failed to deserialize component of type '" << typeName << "'.";
+                    m_Components[static_cast<size_t>(type.value())].pop_back();
+                    ComponentPools::Get()->Destroy(pComponent);
                     return false;
                 }
-                else
-                {
-                    AddComponent(std::move(pComponent));
-                }
             }
             else
             {
@@ -181,12 +201,30 @@ bool Entity::Deserialize(const nlohmann::json& jData)
         }
     }
 
-    for (Component* pComponent : GetComponents())
+    InitializeComponents();
+
+    return true;
+}
+
+void Entity::InitializeComponents()
+{
+    for (auto& components : m_Components)
     {
-        pComponent->Initialize();
+        for (Component* pComponent : components)
+        {
+            pComponent->ResolveDependencies();
+        }
     }
 
-    return true;
+    for (auto& components : m_Components)
+    {
+        for (Component* pComponent : components)
+        {
+            pComponent->Initialize();
+        }
+    }
+
+    m_IsInitialized = true;
 }
 
 } // namespace Hyperscape
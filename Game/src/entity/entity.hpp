@@ -36,26 +36,34 @@ namespace Hyperscape
 
 GENESIS_DECLARE_SMART_PTR(Component)
 
+// Entities don't own their components, which are stored in the ComponentPools and
+// updated system by system. The Entity keeps track of which components belong to it
+// and remains the interface for finding, adding and serializing them.
 class Entity : public Genesis::SceneObject
 {
 public:
-    Entity() {}
+    Entity();
     Entity(const Entity& other);
-    virtual ~Entity() override {}
+    virtual ~Entity() override;
 
-    virtual void Update(float delta) override;
     virtual void Render( const Genesis::SceneCameraSharedPtr& pCamera ) override;
 
     virtual void OnAddedToScene(Genesis::Scene* pScene);
     virtual void OnRemovedFromScene();
 
+    Component* AddComponent(ComponentType type);
+    template<typename T> T* AddComponent()
+    {
+        return static_cast<T*>(AddComponent(T::sType));
+    }
     void AddComponent(ComponentUniquePtr pComponent);
     template<typename T> T* GetComponent() 
     { 
         auto& components = m_Components[static_cast<size_t>(T::sType)];
-        return components.empty() ? nullptr : reinterpret_cast<T*>(components.front().get());
+        return components.empty() ? nullptr : static_cast<T*>(components.front());
     }
     std::vector<Component*> GetComponents() const;
+    size_t GetComponentCount(ComponentType type) const;
 
     bool Serialize(nlohmann::json& data);
     bool Deserialize(const nlohmann::json& data);
@@ -64,10 +72,18 @@ public:
     void SetEditorEntity(bool state);
 
 private:
-    std::array<std::vector<ComponentUniquePtr>, static_cast<size_t>(ComponentType::Count)> m_Components;
+    void InitializeComponents();
+
+    std::array<std::vector<Component*>, static_cast<size_t>(ComponentType::Count)> m_Components;
     bool m_IsEditorEntity;
+    bool m_IsInitialized;
 };
 
+inline size_t Entity::GetComponentCount(ComponentType type) const
+{
+    return m_Components[static_cast<size_t>(type)].size();
+}
+
 inline bool Entity::IsEditorEntity() const
 {
     return m_IsEditorEntity;
@@ -27,10 +27,11 @@
 #include <memory>
 
 #include <log.hpp>
+#include <memorytracker.hpp>
 #include <genesis.h>
 
 #include "entity/component.hpp"
-#include "entity/componentfactory.hpp"
+#include "entity/componentpools.hpp"
 #include "entity/entity.hpp"
 
 namespace Hyperscape
@@ -66,6 +67,7 @@ EntityFactory* EntityFactory::Get()
 
 EntitySharedPtr EntityFactory::Create(const std::string& templateName) const 
 {
+    GENESIS_MEMORY_SCOPE(Entities);
     auto it = m_Templates.find(templateName);
     if (it == m_Templates.end())
     {
@@ -74,12 +76,42 @@ EntitySharedPtr EntityFactory::Create(const std::string& templateName) const
     }
     else
     {
-        EntitySharedPtr pTemplateEntity = it->second;
-        EntitySharedPtr pEntity = std::make_shared<Entity>(*pTemplateEntity);
+        EntitySharedPtr pEntity = std::make_shared<Entity>(*it->second.pEntity);
         return pEntity;
     }
 }
 
+// Creates several entities from the same template, making sure the component pools
+// only need to grow once for the whole batch.
+std::vector<EntitySharedPtr> EntityFactory::Create(const std::string& templateName, size_t count) const
+{
+    GENESIS_MEMORY_SCOPE(Entities);
+    std::vector<EntitySharedPtr> entities;
+    auto it = m_Templates.find(templateName);
+    if (it == m_Templates.end())
+    {
+        Genesis::Log::Error() << "Failed to create entities from template '" << templateName << "': unknown template.";
+        return entities;
+    }
+
+    const Prototype& prototype = it->second;
+    ComponentPools* pPools = ComponentPools::Get();
+    for (size_t i = 0; i < prototype.componentCounts.size(); ++i)
+    {
+        if (prototype.componentCounts[i] > 0)
+        {
+            pPools->Reserve(static_cast<ComponentType>(i), prototype.componentCounts[i] * count);
+        }
+    }
+
+    entities.reserve(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        entities.push_back(std::make_shared<Entity>(*prototype.pEntity));
+    }
+    return entities;
+}
+
 bool EntityFactory::AddBlankTemplate(const std::string& templateName) 
 {
     if (m_Templates.find(templateName) != m_Templates.end())
@@ -111,7 +143,6 @@ void EntityFactory::LoadTemplate(const std::filesystem::path& path)
     {
         std::string templateName = path.stem().generic_string();
         EntitySharedPtr pEntity = std::make_shared<Entity>();
-        m_Templates[templateName] = pEntity;
 
         json jData = json::parse(file);
         file.close();
@@ -120,6 +151,8 @@ void EntityFactory::LoadTemplate(const std::filesystem::path& path)
         {
             Log::Error() << "Failed to load entity template '" << path << "', deserialization failed.";
         }
+
+        SetPrototype(templateName, pEntity);
     }
     else
     {
@@ -131,7 +164,7 @@ void EntityFactory::SaveTemplate(const std::string& templateName, EntitySharedPt
 {
     using namespace Genesis;
 
-    m_Templates[templateName] = pEntity;
+    SetPrototype(templateName, pEntity);
 
     // Serialize the entity.
     nlohmann::json jData;
@@ -157,4 +190,16 @@ void EntityFactory::SaveTemplate(const std::string& templateName, EntitySharedPt
     }
 }
 
+// The editor keeps modifying the entity it saved, so the prototype is a copy of it rather than
+// the entity itself. Otherwise later edits would change what is spawned without updating the counts.
+void EntityFactory::SetPrototype(const std::string& templateName, EntitySharedPtr pEntity)
+{
+    Prototype& prototype = m_Templates[templateName];
+    prototype.pEntity = std::make_shared<Entity>(*pEntity);
+    for (size_t i = 0; i < prototype.componentCounts.size(); ++i)
+    {
+        prototype.componentCounts[i] = pEntity->GetComponentCount(static_cast<ComponentType>(i));
+    }
+}
+
 } // namespace Hyperscape
@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <array>
 #include <filesystem>
 #include <unordered_map>
 #include <set>
@@ -25,6 +26,8 @@
 
 #include <coredefines.h>
 
+#include "entity/componenttype.hpp"
+
 namespace Hyperscape
 {
 
@@ -39,14 +42,26 @@ public:
     static EntityFactory* Get();
 
     EntitySharedPtr Create(const std::string& templateName) const;
+    std::vector<EntitySharedPtr> Create(const std::string& templateName, size_t count) const;
     bool AddBlankTemplate(const std::string& templateName);
     std::set<std::string> GetTemplateNames() const;
     void SaveTemplate(const std::string& templateName, EntitySharedPtr pEntity);
 
 private:
+    // Templates are deserialized and initialized once, when they are loaded. Creating an entity
+    // only needs to clone the prototype's components, which already have their resources resolved.
+    // The prototype is owned by the factory, so the component counts can only change when the
+    // template is loaded or saved.
+    struct Prototype
+    {
+        EntitySharedPtr pEntity;
+        std::array<size_t, static_cast<size_t>(ComponentType::Count)> componentCounts;
+    };
+
     void LoadTemplate(const std::filesystem::path& path);
+    void SetPrototype(const std::string& templateName, EntitySharedPtr pEntity);
 
-    std::unordered_map<std::string, EntitySharedPtr> m_Templates;
+    std::unordered_map<std::string, Prototype> m_Templates;
 };
 
 } // namespace Hyperscape
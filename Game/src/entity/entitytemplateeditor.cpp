@@ -33,7 +33,6 @@
 
 #include "entity/entity.hpp"
 #include "entity/component.hpp"
-#include "entity/componentfactory.hpp"
 #include "entity/entityfactory.hpp"
 #include "sprite/spritemanager.h"
 #include "trail/trailmanager.h"
@@ -171,7 +170,7 @@ void EntityTemplateEditor::DrawMenu()
                 auto name = magic_enum::enum_name(type);
                 if (ImGui::MenuItem(name.data()))
                 {
-                    m_pEntity->AddComponent(std::move(ComponentFactory::Get()->Create(type)));
+                    m_pEntity->AddComponent(type);
                 }
             }
 
@@ -97,6 +97,7 @@ GENESIS_DECLARE_SMART_PTR(EntityTemplateEditor);
 GENESIS_DECLARE_SMART_PTR(ExplorationViewer);
 GENESIS_DECLARE_SMART_PTR(Player);
 GENESIS_DECLARE_SMART_PTR(System);
+GENESIS_DECLARE_SMART_PTR(SystemPrefetcher);
 GENESIS_DECLARE_SMART_PTR(SystemViewer);
 GENESIS_DECLARE_SMART_PTR(SaveGameHeader);
 
@@ -155,6 +156,7 @@ public:
     AchievementsManager* GetAchievementsManager() const;
     SaveGameStorage* GetSaveGameStorage() const;
     ShipOutline* GetShipOutline() const;
+    SystemPrefetcher* GetSystemPrefetcher() const;
 
     void RaiseInteractiveWarning(const std::string& text) const;
     void SetCursorType(CursorType type);
@@ -164,7 +166,7 @@ public:
     void StartNewGame(const ShipCustomisationData& customisationData);
     void EndGame();
     void KillSaveGame();
-    bool SaveGame();
+    void SaveGame();
     void LoadGame(SaveGameHeaderWeakPtr pSaveGameHeader);
     void LoadToState(GameState state);
     void SetState(GameState state);
@@ -205,6 +207,7 @@ private:
     ShipInfoManager* m_pShipInfoManager;
     PlayerSharedPtr m_pPlayer;
     SystemSharedPtr m_pSystem;
+    SystemPrefetcherUniquePtr m_pSystemPrefetcher;
     ExplorationViewerUniquePtr m_pExplorationViewer;
     SystemViewerUniquePtr m_pSystemViewer;
     MusicTitle* m_pMusicTitle;
@@ -250,6 +253,11 @@ private:
     EntityTemplateEditorUniquePtr m_pEntityTemplateEditor;
 };
 
+inline SystemPrefetcher* Game::GetSystemPrefetcher() const
+{
+    return m_pSystemPrefetcher.get();
+}
+
 inline Genesis::Physics::Simulation* Game::GetPhysicsSimulation() const
 {
     return m_pPhysicsSimulation;
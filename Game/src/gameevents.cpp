@@ -15,52 +15,115 @@
 // You should have received a copy of the GNU General Public License
 // along with Hyperscape. If not, see <http://www.gnu.org/licenses/>.
 
-#include <memory.h>
+#include <algorithm>
 
 #include "gameevents.h"
 
 namespace Hyperscape
 {
 
-GameEventHandlerList GameEventManager::m_Handlers;
+GameEventManager::ChannelArray GameEventManager::m_Channels;
+GameEventToken GameEventManager::m_NextToken = sInvalidGameEventToken + 1;
 
 /////////////////////////////////////////////////////////////////////
 // GameEventManager
 /////////////////////////////////////////////////////////////////////
 
-void GameEventManager::RegisterHandler( GameEventHandler* pListener )
+void GameEventManager::Unsubscribe( GameEventToken token )
 {
-    m_Handlers.push_back( pListener );
+    for ( auto& pChannel : m_Channels )
+    {
+        if ( pChannel != nullptr && pChannel->Unsubscribe( token ) )
+        {
+            return;
+        }
+    }
 }
 
-void GameEventManager::RemoveHandler( GameEventHandler* pHandler )
+
+/////////////////////////////////////////////////////////////////////
+// GameEventChannelBase
+/////////////////////////////////////////////////////////////////////
+
+GameEventChannelBase::GameEventChannelBase() :
+m_DispatchDepth( 0 ),
+m_HasRemovedSubscribers( false )
 {
-    m_Handlers.remove( pHandler );
+
 }
 
-void GameEventManager::Broadcast( GameEvent* pEvent )
+void GameEventChannelBase::AddSubscriber( GameEventToken token, HandlerFn handler )
 {
-    for ( auto& pHandler : m_Handlers )
+    if ( m_DispatchDepth > 0 )
     {
-        pHandler->HandleGameEvent( pEvent );
+        m_PendingSubscribers.push_back( { token, std::move( handler ) } );
+    }
+    else
+    {
+        m_Subscribers.push_back( { token, std::move( handler ) } );
     }
-
-	delete pEvent;
 }
 
+// Subscribers can't be erased while dispatching, so they are only flagged as removed
+// by clearing their token and erased once the outermost dispatch is over.
+bool GameEventChannelBase::Unsubscribe( GameEventToken token )
+{
+    for ( Subscriber& subscriber : m_Subscribers )
+    {
+        if ( subscriber.token == token )
+        {
+            subscriber.token = sInvalidGameEventToken;
+            m_HasRemovedSubscribers = true;
+            ApplyPendingChanges();
+            return true;
+        }
+    }
 
-/////////////////////////////////////////////////////////////////////
-// GameEventHandler
-/////////////////////////////////////////////////////////////////////
+    auto it = std::find_if( m_PendingSubscribers.begin(), m_PendingSubscribers.end(), [ token ]( const Subscriber& subscriber ) { return subscriber.token == token; } );
+    if ( it != m_PendingSubscribers.end() )
+    {
+        m_PendingSubscribers.erase( it );
+        return true;
+    }
+
+    return false;
+}
 
-GameEventHandler::GameEventHandler()
+void GameEventChannelBase::Dispatch( const GameEvent& event )
 {
-    GameEventManager::RegisterHandler( this );
+    m_DispatchDepth++;
+
+    // Subscribers added during the dispatch go into m_PendingSubscribers, so the vector is never resized here.
+    for ( Subscriber& subscriber : m_Subscribers )
+    {
+        if ( subscriber.token != sInvalidGameEventToken )
+        {
+            subscriber.handler( event );
+        }
+    }
+
+    m_DispatchDepth--;
+    ApplyPendingChanges();
 }
 
-GameEventHandler::~GameEventHandler()
+void GameEventChannelBase::ApplyPendingChanges()
 {
-    GameEventManager::RemoveHandler( this );
+    if ( m_DispatchDepth > 0 )
+    {
+        return;
+    }
+
+    if ( m_HasRemovedSubscribers )
+    {
+        m_Subscribers.erase( std::remove_if( m_Subscribers.begin(), m_Subscribers.end(), []( const Subscriber& subscriber ) { return subscriber.token == sInvalidGameEventToken; } ), m_Subscribers.end() );
+        m_HasRemovedSubscribers = false;
+    }
+
+    for ( Subscriber& subscriber : m_PendingSubscribers )
+    {
+        m_Subscribers.push_back( std::move( subscriber ) );
+    }
+    m_PendingSubscribers.clear();
 }
 
 }
@@ -17,16 +17,21 @@
 
 #pragma once
 
-#include <list>
+#include <array>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <vector>
 
 namespace Hyperscape
 {
 
 class ModuleInfo;
-class Ship;
 
 /////////////////////////////////////////////////////////////////////
 // GameEvent
+// Events are small value types, passed by reference to the
+// subscribers of their type. Every event type needs a unique sType.
 /////////////////////////////////////////////////////////////////////
 
 enum class GameEventType
@@ -35,7 +40,8 @@ enum class GameEventType
 	PerkPointAcquired,
 	PerkPointPartAcquired,
     ModuleAcquired,
-	ShipDestroyed
+
+	Count
 };
 
 class GameEvent
@@ -54,8 +60,10 @@ private:
 class GameEventModuleAcquired : public GameEvent
 {
 public:
+    static const GameEventType sType = GameEventType::ModuleAcquired;
+
     GameEventModuleAcquired( ModuleInfo* pModuleInfo, unsigned int quantity, bool triggersNotification ) :
-        GameEvent( GameEventType::ModuleAcquired ), 
+        GameEvent( sType ), 
         m_pModuleInfo( pModuleInfo ),
         m_Quantity( quantity ),
         m_TriggersNotification( triggersNotification )
@@ -71,50 +79,113 @@ private:
     bool m_TriggersNotification;
 };
 
-// Message for when a ship has been destroyed
-class GameEventShipDestroyed : public GameEvent
+
+/////////////////////////////////////////////////////////////////////
+// GameEventChannel
+// Subscribers for a single event type.
+// Subscriptions made while the channel is dispatching only take
+// effect once the dispatch is over, and unsubscribing during a
+// dispatch stops the subscriber from being called straight away.
+/////////////////////////////////////////////////////////////////////
+
+typedef unsigned int GameEventToken;
+static const GameEventToken sInvalidGameEventToken = 0;
+
+class GameEventChannelBase
 {
 public:
-    GameEventShipDestroyed( Ship* pShip ) :
-        GameEvent( GameEventType::ShipDestroyed ), 
-        m_pShip( pShip )
-    {}
+    GameEventChannelBase();
+    virtual ~GameEventChannelBase() {}
 
-	inline Ship* GetShip() const { return m_pShip; }
+    bool Unsubscribe( GameEventToken token );
 
-private:
-    Ship* m_pShip;
-};
+protected:
+    using HandlerFn = std::function<void( const GameEvent& )>;
 
+    void AddSubscriber( GameEventToken token, HandlerFn handler );
+    void Dispatch( const GameEvent& event );
 
-/////////////////////////////////////////////////////////////////////
-// GameEventHandler
-/////////////////////////////////////////////////////////////////////
+private:
+    struct Subscriber
+    {
+        GameEventToken token;
+        HandlerFn handler;
+    };
+
+    void ApplyPendingChanges();
+
+    std::vector<Subscriber> m_Subscribers;
+    std::vector<Subscriber> m_PendingSubscribers;
+    int m_DispatchDepth;
+    bool m_HasRemovedSubscribers;
+};
 
-class GameEventHandler
+template <typename T>
+class GameEventChannel : public GameEventChannelBase
 {
 public:
-    GameEventHandler();
-    virtual ~GameEventHandler();
-
-    virtual void HandleGameEvent( GameEvent* pEvent ) = 0;
+    void Subscribe( GameEventToken token, std::function<void( const T& )> handler );
+    void Dispatch( const T& event );
 };
 
-typedef std::list< GameEventHandler* > GameEventHandlerList;
-
 
 /////////////////////////////////////////////////////////////////////
 // GameEventManager
+// Broadcast() calls the event type's subscribers immediately.
 /////////////////////////////////////////////////////////////////////
 
 class GameEventManager
 {
 public:
-    static void RegisterHandler( GameEventHandler* pListener );
-    static void RemoveHandler( GameEventHandler* pListener );
-    static void Broadcast( GameEvent* pEvent ); 
+    template <typename T> static GameEventToken Subscribe( std::function<void( const T& )> handler );
+    static void Unsubscribe( GameEventToken token );
+
+    template <typename T> static void Broadcast( const T& event );
+
+private:
+    template <typename T> static GameEventChannel<T>* GetChannel();
 
-    static GameEventHandlerList m_Handlers;
+    using ChannelArray = std::array<std::unique_ptr<GameEventChannelBase>, static_cast<size_t>( GameEventType::Count )>;
+    static ChannelArray m_Channels;
+    static GameEventToken m_NextToken;
 };
 
-};
\ No newline at end of file
+template <typename T>
+void GameEventChannel<T>::Subscribe( GameEventToken token, std::function<void( const T& )> handler )
+{
+    AddSubscriber( token, [ handler ]( const GameEvent& event ) { handler( static_cast<const T&>( event ) ); } );
+}
+
+template <typename T>
+void GameEventChannel<T>::Dispatch( const T& event )
+{
+    GameEventChannelBase::Dispatch( event );
+}
+
+template <typename T>
+GameEventChannel<T>* GameEventManager::GetChannel()
+{
+    static_assert( std::is_base_of<GameEvent, T>::value, "Game events must derive from GameEvent." );
+    std::unique_ptr<GameEventChannelBase>& pChannel = m_Channels[ static_cast<size_t>( T::sType ) ];
+    if ( pChannel == nullptr )
+    {
+        pChannel = std::make_unique<GameEventChannel<T>>();
+    }
+    return static_cast<GameEventChannel<T>*>( pChannel.get() );
+}
+
+template <typename T>
+GameEventToken GameEventManager::Subscribe( std::function<void( const T& )> handler )
+{
+    const GameEventToken token = m_NextToken++;
+    GetChannel<T>()->Subscribe( token, handler );
+    return token;
+}
+
+template <typename T>
+void GameEventManager::Broadcast( const T& event )
+{
+    GetChannel<T>()->Dispatch( event );
+}
+
+};
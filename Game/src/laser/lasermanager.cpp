@@ -58,9 +58,9 @@ void LaserManager::Update( float delta )
 		return;
 	}
 
-	PositionData posData;
-	UVData uvData;
-	ColourData colourData;
+	FramePositionData posData( &FrameArena::Get() );
+	FrameUVData uvData( &FrameArena::Get() );
+	FrameColourData colourData( &FrameArena::Get() );
 
 	posData.reserve( lasersCount * 6 );
 	uvData.reserve( lasersCount * 6 );
@@ -24,6 +24,7 @@
 #endif
 
 #include "achievements.h"
+#include "entity/componentpools.hpp"
 #include "entity/entitytemplateeditor.hpp"
 #include "faction/faction.h"
 #include "game.hpp"
@@ -46,6 +47,7 @@
 #include "sector/sector.h"
 #include "sector/sectorinfo.h"
 #include "shadertweaks.h"
+#include "startupgraph.h"
 #include "ship/inventory.h"
 #include "ship/module.h"
 #include "ship/ship.h"
@@ -53,6 +55,7 @@
 #include "ship/shipoutline.h"
 #include "stringaux.h"
 #include "system/system.hpp"
+#include "system/systemprefetcher.hpp"
 #include "system/systemviewer.hpp"
 #include "ui/editor.h"
 #include "ui/rootelement.h"
@@ -92,6 +95,8 @@ namespace Hyperscape
 
 Game* g_pGame = nullptr;
 
+static const char* sStartingSystemSeed = "17260877307600676";
+
 //-------------------------------------------------------------------
 // Game
 //-------------------------------------------------------------------
@@ -144,6 +149,9 @@ Game::Game()
 
 Game::~Game()
 {
+    // The prefetcher's worker may still be preloading through the resource manager.
+    m_pSystemPrefetcher = nullptr;
+
     ShaderTweaksDebugWindow::Unregister();
 
     delete m_pTutorialWindow;
@@ -185,38 +193,9 @@ Game::~Game()
 void Game::Initialise()
 {
     Random::Initialise();
-    RandomShuffle::Initialise();
 
     Genesis::Log::Info() << "Hyperscape build " << HYPERSCAPE_BUILD;
 
-    m_pLoadingScreen = LoadingScreenUniquePtr( new LoadingScreen );
-    m_pBlackboard = std::make_shared<Blackboard>();
-    m_pModuleInfoManager = new ModuleInfoManager();
-    m_pShipInfoManager = new ShipInfoManager();
-
-    m_pShipInfoManager->Initialise();
-
-    m_pPhysicsSimulation = new Genesis::Physics::Simulation();
-    Genesis::FrameWork::GetTaskManager()->AddTask( "Physics", m_pPhysicsSimulation, (Genesis::TaskFunc)&Genesis::Physics::Simulation::Update, Genesis::TaskPriority::Physics );
-
-    m_pPopup = new Popup();
-
-#ifdef _DEBUG
-    m_pAudioDebug = new AudioDebug();
-#endif
-
-    m_pMusicTitle = new MusicTitle();
-
-#ifndef _FINAL
-    m_pFrameText = GuiExtended::CreateText( 8, 8, 1024, 128, "", nullptr );
-    m_pFrameText->SetColour( 1.0f, 0.4f, 0.0f, 1.0f );
-#endif
-
-    SetCursorType( CursorType::Pointer );
-
-    ShaderTweaksDebugWindow::Register();
-    m_pEntityTemplateEditor = std::make_unique<EntityTemplateEditor>();
-
 #if USE_STEAM
     if ( SteamAPI_RestartAppIfNecessary( STEAM_APP_ID ) )
     {
@@ -234,20 +213,69 @@ void Game::Initialise()
     }
 #endif // USE_STEAM
 
-    Genesis::ImGuiImpl::Enable( true );
-    Genesis::ImGuiImpl::RegisterDevMenu( "Tools", "ImGui demo window", &m_ShowImGuiDemoWindow );
-    Genesis::ImGuiImpl::RegisterDevMenu( "Tools", "ImPlot demo window", &m_ShowImPlotDemoWindow );
+    // Anything which touches the GL context, registers tasks or creates GUI elements has to run on the main thread.
+    // Only steps which are safe to run concurrently with those (such as parsing data) go in the worker threads.
+    using Affinity = StartupGraph::Affinity;
+    StartupGraph startup;
+
+    startup.Add( "Loading screen", Affinity::MainThread, [ this ]() { m_pLoadingScreen = LoadingScreenUniquePtr( new LoadingScreen ); } );
+    startup.Add( "Blackboard", Affinity::AnyThread, [ this ]() { m_pBlackboard = std::make_shared<Blackboard>(); } );
+    const StartupGraph::TaskId moduleInfos = startup.Add( "Module infos", Affinity::AnyThread, [ this ]() { m_pModuleInfoManager = new ModuleInfoManager(); } );
+    startup.Add( "Ship infos", Affinity::AnyThread, [ this ]() {
+        m_pShipInfoManager = new ShipInfoManager();
+        m_pShipInfoManager->Initialise();
+    }, { moduleInfos } );
 
-    UI2::Initialize();
+    startup.Add( "Physics", Affinity::MainThread, [ this ]() {
+        m_pPhysicsSimulation = new Genesis::Physics::Simulation();
+        Genesis::FrameWork::GetTaskManager()->AddTask( "Physics", m_pPhysicsSimulation, (Genesis::TaskFunc)&Genesis::Physics::Simulation::Update, Genesis::TaskPriority::Physics );
+    } );
 
-    m_pAchievementsManager = new AchievementsManager();
-    m_pSaveGameStorage = std::make_unique<SaveGameStorage>();
-    m_pShipOutline = std::make_unique<ShipOutline>();
-    m_pUIRootElement = std::make_unique<UI::RootElement>();
-    m_pUIEditor = std::make_unique<UI::Editor>();
-    m_pExplorationViewer = std::make_unique<ExplorationViewer>();
-    m_pModelViewer = std::make_unique<Genesis::ModelViewer>();
-    m_pSystemViewer = std::make_unique<SystemViewer>();
+    startup.Add( "Interface", Affinity::MainThread, [ this ]() {
+        m_pPopup = new Popup();
+
+#ifdef _DEBUG
+        m_pAudioDebug = new AudioDebug();
+#endif
+
+        m_pMusicTitle = new MusicTitle();
+
+#ifndef _FINAL
+        m_pFrameText = GuiExtended::CreateText( 8, 8, 1024, 128, "", nullptr );
+        m_pFrameText->SetColour( 1.0f, 0.4f, 0.0f, 1.0f );
+#endif
+
+        SetCursorType( CursorType::Pointer );
+    } );
+
+    startup.Add( "Development tools", Affinity::MainThread, [ this ]() {
+        ShaderTweaksDebugWindow::Register();
+        m_pEntityTemplateEditor = std::make_unique<EntityTemplateEditor>();
+
+        Genesis::ImGuiImpl::Enable( true );
+        Genesis::ImGuiImpl::RegisterDevMenu( "Tools", "ImGui demo window", &m_ShowImGuiDemoWindow );
+        Genesis::ImGuiImpl::RegisterDevMenu( "Tools", "ImPlot demo window", &m_ShowImPlotDemoWindow );
+    } );
+
+    const StartupGraph::TaskId ui2 = startup.Add( "UI2", Affinity::MainThread, []() { UI2::Initialize(); } );
+    startup.Add( "Achievements", Affinity::MainThread, [ this ]() { m_pAchievementsManager = new AchievementsManager(); } );
+    startup.Add( "Save game storage", Affinity::AnyThread, [ this ]() { m_pSaveGameStorage = std::make_unique<SaveGameStorage>(); } );
+    startup.Add( "Ship outline", Affinity::MainThread, [ this ]() { m_pShipOutline = std::make_unique<ShipOutline>(); } );
+    const StartupGraph::TaskId uiRoot = startup.Add( "UI root", Affinity::MainThread, [ this ]() { m_pUIRootElement = std::make_unique<UI::RootElement>(); }, { ui2 } );
+    startup.Add( "UI editor", Affinity::MainThread, [ this ]() { m_pUIEditor = std::make_unique<UI::Editor>(); }, { uiRoot } );
+    startup.Add( "Viewers", Affinity::MainThread, [ this ]() {
+        m_pExplorationViewer = std::make_unique<ExplorationViewer>();
+        m_pModelViewer = std::make_unique<Genesis::ModelViewer>();
+        m_pSystemViewer = std::make_unique<SystemViewer>();
+    }, { moduleInfos } );
+    startup.Add( "System prefetcher", Affinity::MainThread, [ this ]() {
+        // The starting system is generated while the player is still in the menus.
+        m_pSystemPrefetcher = std::make_unique<SystemPrefetcher>();
+        m_pSystemPrefetcher->Prefetch( sStartingSystemSeed );
+    } );
+
+    startup.Run();
+    startup.LogTimings();
 
     SetState( GameState::Intro );
 }
@@ -299,8 +327,10 @@ Genesis::TaskStatus Game::Update( float delta )
     m_pExplorationViewer->UpdateDebugUI();
     m_pSystemViewer->UpdateDebugUI();
     GetBlackboard()->UpdateDebugUI();
+    GetSaveGameStorage()->Update();
     GetSaveGameStorage()->UpdateDebugUI();
     m_pEntityTemplateEditor->UpdateDebugUI();
+    ComponentPools::Get()->UpdateDebugUI();
     ShaderTweaksDebugWindow::Update();
 
     UI2::Update( delta );
@@ -355,6 +385,9 @@ Genesis::TaskStatus Game::Update( float delta )
         m_pSystem->Update( delta );
     }
 
+    // Components of entities which are in a scene, updated system by system.
+    ComponentPools::Get()->Update( delta );
+
     if ( m_pIntelWindow )
     {
         m_pIntelWindow->Update( delta );
@@ -412,7 +445,7 @@ void Game::StartNewGame( const ShipCustomisationData& customisationData )
     SetPlayedTime( 0.0f );
 
     m_pSystem = nullptr;
-    m_pSystem = std::make_shared<System>( "17260877307600676" );
+    m_pSystem = std::make_shared<System>( m_pSystemPrefetcher->Take( sStartingSystemSeed ) );
     m_pSystemViewer->View( m_pSystem );
     m_pExplorationViewer->View( m_pSystem );
 
@@ -447,9 +480,9 @@ void Game::KillSaveGame()
     m_KillSave = true;
 }
 
-bool Game::SaveGame()
+void Game::SaveGame()
 {
-    return GetSaveGameStorage()->SaveGame( m_KillSave );
+    GetSaveGameStorage()->SaveGame( m_KillSave );
 }
 
 void Game::LoadGame( SaveGameHeaderWeakPtr pSaveGameHeaderWeakPtr )
@@ -473,8 +506,6 @@ void Game::LoadGame( SaveGameHeaderWeakPtr pSaveGameHeaderWeakPtr )
 
 void Game::LoadGameAux()
 {
-    using namespace tinyxml2;
-
     if ( m_GameToLoad.empty() )
     {
         return;
@@ -483,41 +514,14 @@ void Game::LoadGameAux()
     std::filesystem::path filename = m_GameToLoad;
     m_GameToLoad.clear();
 
-    tinyxml2::XMLDocument xmlDoc;
-    if ( m_pSaveGameStorage->LoadGame( filename, xmlDoc ) == false )
-    {
-        return;
-    }
-
-    bool hasErrors = false;
-    XMLElement* pRootElem = xmlDoc.FirstChildElement();
-
-    if ( !hasErrors )
-    {
-        // Load the Player and therefore the Inventory / ship's hexgrid template
-        for ( XMLElement* pElem = pRootElem->FirstChildElement(); pElem != nullptr; pElem = pElem->NextSiblingElement() )
-        {
-            const std::string value( pElem->Value() );
-            if ( value == "Player" )
-            {
-                m_pPlayer = std::make_shared<Player>();
-                hasErrors = ( m_pPlayer->Read( pElem ) == false );
-                break;
-            }
-        }
-    }
-
-    if ( !hasErrors )
+    PlayerSharedPtr pPlayer;
+    if ( m_pSaveGameStorage->LoadGame( filename, pPlayer ) )
     {
+        m_pPlayer = pPlayer;
         m_pMainMenu->Show( false );
         m_ContextualTipsEnabled = m_pBlackboard->Exists( "#contextual_tips" );
         SetState( GameState::GalaxyView );
     }
-    else
-    {
-        m_pPlayer = nullptr;
-        RaiseInteractiveWarning( "Invalid save file." );
-    }
 
     m_pLoadingScreen->Show( false );
 }
@@ -73,6 +73,10 @@ void AudioDebug::Update( float delta )
 
 	ss << "Active sounds: " << pSoundManager->GetActiveSoundCount() << std::endl;
 
+	const Sound::VoiceStats& voiceStats = pSoundManager->GetVoiceStats();
+	ss << "Voice requests: " << voiceStats.requested << " (" << voiceStats.played << " played, " << voiceStats.coalesced << " coalesced, ";
+	ss << voiceStats.culled << " culled, " << voiceStats.overBudget << " over budget)" << std::endl;
+
 	ResourceSound* pPlaylistResource = pSoundManager->GetPlaylistResource();
 	std::string playlistName = pPlaylistResource ? pPlaylistResource->GetFilename().GetName() : std::string("none");
 
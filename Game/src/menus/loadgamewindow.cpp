@@ -71,7 +71,8 @@ void TableRowLoadGame::OnPress()
 ///////////////////////////////////////////////////////////////////////////////
 
 LoadGameWindow::LoadGameWindow() : UI::Window( "Load game window" ),
-m_pTable( nullptr )
+m_pTable( nullptr ),
+m_SaveGamesGeneration( -1 )
 {
 	m_pScrollingElement = std::make_shared<UI::ScrollingElement>( "Scrolling element" );
 	GetContentPanel()->Add( m_pScrollingElement );
@@ -81,9 +82,21 @@ m_pTable( nullptr )
 
 void LoadGameWindow::Reset()
 {
+	// The rescan happens in the background, the table is recreated by Update() once it finishes.
+	g_pGame->GetSaveGameStorage()->Refresh();
 	CreateTable();
 }
 
+void LoadGameWindow::Update()
+{
+	UI::Window::Update();
+
+	if ( m_SaveGamesGeneration != g_pGame->GetSaveGameStorage()->GetGeneration() )
+	{
+		CreateTable();
+	}
+}
+
 void LoadGameWindow::CreateTable()
 {
 	if ( m_pTable != nullptr )
@@ -109,6 +122,7 @@ void LoadGameWindow::CreateTable()
 
 	SaveGameHeaderVector saveGameHeaders;
 	g_pGame->GetSaveGameStorage()->GetSaveGameHeaders( saveGameHeaders );
+	m_SaveGamesGeneration = g_pGame->GetSaveGameStorage()->GetGeneration();
 	Genesis::ResourceFont* pFont = UI::Fonts::Get( "kimberley18light.fnt" );
 	for ( auto& pSaveGameHeader : saveGameHeaders )
 	{
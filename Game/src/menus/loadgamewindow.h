@@ -40,6 +40,7 @@ class LoadGameWindow : public UI::Window
 public:
 	LoadGameWindow();
 	virtual void Reset() override;
+	virtual void Update() override;
 
 private:
 	void CreateTable();
@@ -50,6 +51,7 @@ private:
 	ButtonLoad* m_pLoadGameButton;
 	LoadGameSelectionVector	m_Selections;
 	bool m_TableDirty;
+	int m_SaveGamesGeneration; // Generation of the save game storage the table was created from.
 };
 
 } // namespace Hyperscape
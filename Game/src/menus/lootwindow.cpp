@@ -48,6 +48,7 @@ m_pWingsRight( nullptr ),
 m_pPerkMeter( nullptr ),
 m_pPerkAcquired( nullptr ),
 m_Dirty( false ),
+m_ModuleAcquiredToken( sInvalidGameEventToken ),
 m_PanelWidth( 400.0f ),
 m_PanelHeight( 400.0f ),
 m_IconSize( 64.0f ),
@@ -120,10 +121,14 @@ m_pPerkProgressSFX( nullptr )
 	m_pMainPanel->AddElement( m_pPerkAcquired );
 
     InitialiseSounds();
+
+	m_ModuleAcquiredToken = GameEventManager::Subscribe<GameEventModuleAcquired>( [ this ]( const GameEventModuleAcquired& event ) { OnModuleAcquired( event ); } );
 }
 
 LootWindow::~LootWindow()
 {
+	GameEventManager::Unsubscribe( m_ModuleAcquiredToken );
+
 	Genesis::Gui::GuiManager* pGuiManager = Genesis::FrameWork::GetGuiManager();
 	pGuiManager->RemoveElement( m_pMainPanel );
 }
@@ -213,7 +218,7 @@ void LootWindow::Update( float delta )
 //#endif
 }
 
-void LootWindow::HandleGameEvent( GameEvent* pEvent )
+void LootWindow::OnModuleAcquired( const GameEventModuleAcquired& event )
 {
 
 }
@@ -26,16 +26,15 @@ namespace Hyperscape
 class Meter;
 class ModuleInfo;
 
-class LootWindow : public GameEventHandler
+class LootWindow
 {
 public:
 							LootWindow();
 							~LootWindow();
 	void					Update( float delta );
 
-	virtual	void			HandleGameEvent( GameEvent* pEvent ) override;
-
 private:
+	void					OnModuleAcquired( const GameEventModuleAcquired& event );
     void                    InitialiseSounds();
     void                    Test( float delta );
 	float					CalculateIconScaling() const;
@@ -50,6 +49,7 @@ private:
 	Genesis::Gui::Text*		m_pPerkAcquired;
 
 	bool					m_Dirty;
+	GameEventToken			m_ModuleAcquiredToken;
 
     float                   m_PanelWidth;
     float                   m_PanelHeight;
@@ -59,6 +59,9 @@ void PointOfInterest::Render()
 
 	Gui::GuiElement::Render();
 
+	// The children's quads may still be in the GUI batch, so it needs to be flushed for the line to be drawn over them.
+	PrepareDirectDraw();
+
 	const glm::vec2& end = ( m_pDynamicEnd ? m_pDynamicEnd->GetPointOfInterestEnd() : m_StaticEnd );
 
 	PositionData posData;
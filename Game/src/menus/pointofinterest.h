@@ -71,6 +71,7 @@ public:
 								PointOfInterest();
 	virtual						~PointOfInterest();
 	virtual void				Render() override;
+	virtual bool				IsBatchable() const override { return false; }
 
 	void						SetStart( const glm::vec2& position );
 	void						SetEnd( const glm::vec2& position );
@@ -50,6 +50,7 @@ public:
 
 	virtual void		Update( float delta ) override;
 	virtual void		Render() override;
+	virtual bool		IsBatchable() const override { return false; }
 
 	int					AddRow( TableRow* pTableRow );
 	TableRow*			GetRow( unsigned int index ) const;
@@ -24,46 +24,194 @@
 namespace Hyperscape
 {
 
+//-----------------------------------------------------------------------------
+// RandomStream
+//-----------------------------------------------------------------------------
+
+RandomStream::RandomStream( uint64_t seed )
+{
+	Seed( seed );
+}
+
+void RandomStream::Seed( uint64_t seed )
+{
+	// SplitMix64 expands the seed so that similar seeds still produce unrelated states,
+	// and guarantees the state is never all zeroes.
+	for ( uint64_t& state : m_State )
+	{
+		seed += 0x9E3779B97F4A7C15ull;
+		uint64_t z = seed;
+		z = ( z ^ ( z >> 30 ) ) * 0xBF58476D1CE4E5B9ull;
+		z = ( z ^ ( z >> 27 ) ) * 0x94D049BB133111EBull;
+		state = z ^ ( z >> 31 );
+	}
+}
+
+uint32_t RandomStream::Next()
+{
+	return static_cast<uint32_t>( NextU64() >> 32 );
+}
+
+uint32_t RandomStream::Next( uint32_t max )
+{
+	SDL_assert( max > 0 );
+
+	// Lemire's multiply-shift: maps a 32 bit value into [0, max) and only
+	// rejects when the value falls into the small biased region.
+	uint64_t m = static_cast<uint64_t>( Next() ) * max;
+	uint32_t low = static_cast<uint32_t>( m );
+	if ( low < max )
+	{
+		const uint32_t threshold = ( 0u - max ) % max;
+		while ( low < threshold )
+		{
+			m = static_cast<uint64_t>( Next() ) * max;
+			low = static_cast<uint32_t>( m );
+		}
+	}
+	return static_cast<uint32_t>( m >> 32 );
+}
+
+uint32_t RandomStream::Next( uint32_t min, uint32_t max )
+{
+	SDL_assert( min < max );
+	return min + Next( max - min );
+}
+
+float RandomStream::Next( float max )
+{
+	SDL_assert( max > 0.0f );
+	return NextUnitFloat() * max;
+}
+
+float RandomStream::Next( float min, float max )
+{
+	SDL_assert( min < max );
+	return min + NextUnitFloat() * ( max - min );
+}
+
+void RandomStream::Fill( uint32_t* pValues, size_t count )
+{
+	for ( size_t i = 0; i < count; ++i )
+	{
+		pValues[ i ] = Next();
+	}
+}
+
+void RandomStream::Fill( uint32_t* pValues, size_t count, uint32_t max )
+{
+	for ( size_t i = 0; i < count; ++i )
+	{
+		pValues[ i ] = Next( max );
+	}
+}
+
+void RandomStream::Fill( float* pValues, size_t count, float min, float max )
+{
+	SDL_assert( min < max );
+	const float range = max - min;
+	for ( size_t i = 0; i < count; ++i )
+	{
+		pValues[ i ] = min + NextUnitFloat() * range;
+	}
+}
+
+void RandomStream::Jump()
+{
+	static const uint64_t sJump[] = { 0x180EC6D33CFD0ABAull, 0xD5A61266F0C9392Cull, 0xA9582618E03FC9AAull, 0x39ABDC4529B1661Cull };
+
+	std::array<uint64_t, 4> state = { 0, 0, 0, 0 };
+	for ( uint64_t jump : sJump )
+	{
+		for ( int b = 0; b < 64; ++b )
+		{
+			if ( jump & ( 1ull << b ) )
+			{
+				for ( size_t i = 0; i < state.size(); ++i )
+				{
+					state[ i ] ^= m_State[ i ];
+				}
+			}
+			NextU64();
+		}
+	}
+	m_State = state;
+}
+
+RandomStream RandomStream::Split()
+{
+	RandomStream stream = *this;
+	Jump();
+	return stream;
+}
+
 //-----------------------------------------------------------------------------
 // Random
 //-----------------------------------------------------------------------------
 
-std::default_random_engine Random::m_Engine = std::default_random_engine();
+RandomStream Random::m_Root;
+std::mutex Random::m_RootMutex;
+std::atomic<uint32_t> Random::m_Generation( 1 );
 
 void Random::Initialise()
 {
-	const unsigned int seed = static_cast<unsigned int>( std::chrono::system_clock::now().time_since_epoch().count() );
-	m_Engine = std::default_random_engine( seed );
+	Initialise( static_cast<uint64_t>( std::chrono::system_clock::now().time_since_epoch().count() ) );
+}
+
+void Random::Initialise( uint64_t seed )
+{
+	std::lock_guard<std::mutex> lock( m_RootMutex );
+	m_Root.Seed( seed );
+	m_Generation++;
+}
+
+RandomStream Random::CreateStream()
+{
+	std::lock_guard<std::mutex> lock( m_RootMutex );
+	return m_Root.Split();
+}
+
+RandomStream& Random::GetThreadStream()
+{
+	struct ThreadStream
+	{
+		RandomStream stream;
+		uint32_t generation = 0;
+	};
+	thread_local ThreadStream tls;
+
+	const uint32_t generation = m_Generation.load( std::memory_order_relaxed );
+	if ( tls.generation != generation )
+	{
+		tls.stream = CreateStream();
+		tls.generation = generation;
+	}
+	return tls.stream;
 }
 
 uint32_t Random::Next()
 {
-	return static_cast<uint32_t>( m_Engine() % UINT32_MAX );
+	return GetThreadStream().Next();
 }
 
 uint32_t Random::Next( uint32_t max )
 {
-	return static_cast<uint32_t>( m_Engine() % max );
+	return GetThreadStream().Next( max );
 }
 
 uint32_t Random::Next( uint32_t min, uint32_t max )
 {
-	SDL_assert( min < max );
-	return min + static_cast<uint32_t>( m_Engine() % ( max - min ) );
+	return GetThreadStream().Next( min, max );
 }
 
 float Random::Next( float max )
 {
-	SDL_assert( max > 0.0f );
-	std::uniform_real_distribution<float> dist( 0.0f, max );
-	return dist( m_Engine );
+	return GetThreadStream().Next( max );
 }
 
 float Random::Next( float min, float max )
 {
-	SDL_assert( min < max );
-	std::uniform_real_distribution<float> dist( min, max );
-	return dist( m_Engine );
+	return GetThreadStream().Next( min, max );
 }
 
 } // namespace Hyperscape
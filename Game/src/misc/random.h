@@ -17,20 +17,99 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
+#include <cstddef>
 #include <cstdint>
-#include <random>
+#include <mutex>
 
 namespace Hyperscape
 {
 
 //-----------------------------------------------------------------------------
-// NullscapeLocation
+// RandomStream
+// A xoshiro256** generator. Cheap to copy and to advance, so every worker or
+// subsystem that needs random numbers should own a stream rather than share
+// one. Streams obtained through Split() never overlap, which keeps results
+// reproducible regardless of how work is scheduled across threads.
+// Satisfies UniformRandomBitGenerator, so it can drive std::shuffle and the
+// std:: distributions.
+//-----------------------------------------------------------------------------
+
+class RandomStream
+{
+public:
+	using result_type = uint64_t;
+
+	explicit RandomStream( uint64_t seed = 0 );
+	void Seed( uint64_t seed );
+
+	inline uint64_t NextU64();
+	uint32_t Next(); // Returns a value between 0 and 2^32-1.
+	uint32_t Next( uint32_t max ); // Returns a value between 0 and max - 1, without modulo bias.
+	uint32_t Next( uint32_t min, uint32_t max ); // Returns a value between min and max - 1, without modulo bias.
+	float Next( float max ); // Returns a value between 0.0f and max.
+	float Next( float min, float max ); // Returns a value between min and max.
+
+	// Batch versions, producing the same sequence as the equivalent number of individual calls.
+	void Fill( uint32_t* pValues, size_t count );
+	void Fill( uint32_t* pValues, size_t count, uint32_t max );
+	void Fill( float* pValues, size_t count, float min, float max );
+
+	void Jump(); // Equivalent to 2^128 calls to NextU64().
+	RandomStream Split(); // Returns a stream starting at the current state and jumps this one past it.
+
+	static constexpr result_type min() { return 0; }
+	static constexpr result_type max() { return UINT64_MAX; }
+	result_type operator()() { return NextU64(); }
+
+private:
+	static inline uint64_t Rotl( uint64_t x, int k );
+	inline float NextUnitFloat(); // [0, 1)
+
+	std::array<uint64_t, 4> m_State;
+};
+
+inline uint64_t RandomStream::Rotl( uint64_t x, int k )
+{
+	return ( x << k ) | ( x >> ( 64 - k ) );
+}
+
+inline uint64_t RandomStream::NextU64()
+{
+	const uint64_t result = Rotl( m_State[ 1 ] * 5, 7 ) * 9;
+	const uint64_t t = m_State[ 1 ] << 17;
+	m_State[ 2 ] ^= m_State[ 0 ];
+	m_State[ 3 ] ^= m_State[ 1 ];
+	m_State[ 1 ] ^= m_State[ 2 ];
+	m_State[ 0 ] ^= m_State[ 3 ];
+	m_State[ 2 ] ^= t;
+	m_State[ 3 ] = Rotl( m_State[ 3 ], 45 );
+	return result;
+}
+
+inline float RandomStream::NextUnitFloat()
+{
+	// The top 24 bits fill a float's mantissa exactly.
+	return static_cast<float>( NextU64() >> 40 ) * ( 1.0f / 16777216.0f );
+}
+
+//-----------------------------------------------------------------------------
+// Random
+// Convenience front end: each thread draws from its own stream, split from a
+// root stream the first time that thread asks for a number. Systems which
+// need reproducible results should call CreateStream() in a fixed order and
+// keep the stream, rather than rely on which thread happens to run them.
 //-----------------------------------------------------------------------------
 
 class Random
 {
 public:
-	static void Initialise();
+	static void Initialise(); // Seeds the root stream from the clock.
+	static void Initialise( uint64_t seed );
+
+	static RandomStream CreateStream();
+	static RandomStream& GetThreadStream();
 
 	static uint32_t Next(); // Returns a value between 0 and 2^32-1.
 	static uint32_t Next( uint32_t max ); // Returns a value between 0 and max - 1.
@@ -39,7 +118,9 @@ public:
 	static float Next( float min, float max ); // returns a value between min and max.
 
 private:
-	static std::default_random_engine m_Engine;
+	static RandomStream m_Root;
+	static std::mutex m_RootMutex;
+	static std::atomic<uint32_t> m_Generation; // Bumped on every Initialise() so thread streams reseed.
 };
 
 } // namespace Hyperscape
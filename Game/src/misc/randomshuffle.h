@@ -18,7 +18,8 @@
 #pragma once
 
 #include <algorithm>
-#include <random>
+
+#include "misc/random.h"
 
 namespace Hyperscape
 {
@@ -26,16 +27,17 @@ namespace Hyperscape
 class RandomShuffle
 {
 public:
-	static void Initialise();
-
 	template< class RandomIt >
 	static void Shuffle( RandomIt first, RandomIt last )
 	{
-		std::shuffle( first, last, m_Engine );
+		std::shuffle( first, last, Random::GetThreadStream() );
 	}
 
-private:
-	static std::default_random_engine m_Engine;
+	template< class RandomIt >
+	static void Shuffle( RandomIt first, RandomIt last, RandomStream& stream )
+	{
+		std::shuffle( first, last, stream );
+	}
 };
 
 }
\ No newline at end of file
@@ -67,9 +67,9 @@ void MuzzleflashManagerRep::Update( float delta )
 		return;
 	}
 
-    PositionData posData;
-    UVData uvData;
-    ColourData colourData;
+    FramePositionData posData( &FrameArena::Get() );
+    FrameUVData uvData( &FrameArena::Get() );
+    FrameColourData colourData( &FrameArena::Get() );
     posData.reserve( 512 );
     uvData.reserve( 512 );
     colourData.reserve( 512 );
@@ -131,7 +131,7 @@ void MuzzleflashManagerRep::Update( float delta )
 	}
 }
 
-void MuzzleflashManagerRep::PushBackUVs( Genesis::UVData& uvData )
+void MuzzleflashManagerRep::PushBackUVs( Genesis::FrameUVData& uvData )
 {
 	using namespace Genesis;
 	static const glm::vec2 uvs[4] = {
@@ -147,7 +147,7 @@ void MuzzleflashManagerRep::PushBackUVs( Genesis::UVData& uvData )
     }
 }
 
-void MuzzleflashManagerRep::PushBackColours( Genesis::ColourData& colourData, const Genesis::Colour& colour )
+void MuzzleflashManagerRep::PushBackColours( Genesis::FrameColourData& colourData, const Genesis::Colour& colour )
 {
 	using namespace Genesis;
 	const float r = colour.r;
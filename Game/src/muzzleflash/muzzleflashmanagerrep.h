@@ -44,8 +44,8 @@ public:
 	void SetManager( MuzzleflashManager* pManager );
 
 private:
-    void PushBackUVs( Genesis::UVData& uvData );
-	void PushBackColours( Genesis::ColourData& colourData, const Genesis::Colour& colour );
+    void PushBackUVs( Genesis::FrameUVData& uvData );
+	void PushBackColours( Genesis::FrameColourData& colourData, const Genesis::Colour& colour );
 
 	MuzzleflashManager* m_pManager;
     Genesis::ResourceShader* m_pShader;
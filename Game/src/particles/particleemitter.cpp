@@ -23,6 +23,7 @@
 #include <math/misc.h>
 
 #include "particles/particleemitter.h"
+#include "misc/random.h"
 #include "particles/particle.h"
 
 namespace Hyperscape
@@ -185,7 +186,7 @@ const std::string& ParticleEmitter::GetRandomExplosion()
 		"data/particles/Oil_Rig_Sprites_v2.png",
 		"data/particles/Oil_Rig_Sprites_v3.png"
 	};
-	return atlas[ rand() % sFxVariants ];
+	return atlas[ Random::Next( static_cast<uint32_t>( sFxVariants ) ) ];
 }
 
 }
\ No newline at end of file
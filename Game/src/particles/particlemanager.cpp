@@ -21,6 +21,9 @@
 #include "game.hpp"
 #endif
 
+#include <memorytracker.hpp>
+#include <performancecounters.h>
+
 #include "particles/particlemanager.h"
 #include "particles/particleemitter.h"
 
@@ -31,6 +34,7 @@ static int sMaxEmitters = 2048;
 
 ParticleManager::ParticleManager()
 {
+	GENESIS_MEMORY_SCOPE( Particles );
 	m_Emitters.resize( sMaxEmitters );
 	for ( int i = 0; i < sMaxEmitters; ++i )
 	{
@@ -46,6 +50,7 @@ ParticleManager::~ParticleManager()
 
 void ParticleManager::Update( float delta )
 {
+	GENESIS_MEMORY_SCOPE( Particles );
 	int activeEmitters = 0;
 	for ( auto& emitter : m_Emitters )
 	{
@@ -56,6 +61,9 @@ void ParticleManager::Update( float delta )
 		}
 	}
 
+	static Genesis::PerformanceCounter* sActiveEmitters = Genesis::PerformanceCounters::Register( "Particles/Active emitters", Genesis::PerformanceCounterType::Gauge, sMaxEmitters * 9 / 10 );
+	sActiveEmitters->Set( activeEmitters );
+
 //#ifdef _DEBUG
 //	glm::vec3 colour = ( activeEmitters < sMaxEmitters ) ? glm::vec3( 0.0f, 1.0f, 0.0f ) : glm::vec3( 1.0f, 0.0f, 0.0f );
 //	std::stringstream ss;
@@ -66,6 +74,7 @@ void ParticleManager::Update( float delta )
 
 ParticleEmitter* ParticleManager::GetAvailableEmitter()
 {
+	GENESIS_MEMORY_SCOPE( Particles );
 	int numEmitters = static_cast<int>(m_Emitters.size());
 	for ( int i = m_Idx; i < numEmitters; ++i )
 	{
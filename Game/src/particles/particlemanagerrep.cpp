@@ -64,7 +64,13 @@ void ParticleManagerRep::Update( float delta )
 	{
 		ParticlePass* pPass = m_pPass[ i ];
 
-		pPass->m_Data.clear();
+		// Keep the per-texture entries and their capacity from previous frames, so that
+		// gathering particles doesn't reallocate every frame.
+		for ( auto& particleRenderData : pPass->m_Data )
+		{
+			particleRenderData.particles.clear();
+		}
+
 		const ParticleEmitterVector& emitters = m_pParticleManager->GetEmitters();
 		for ( auto& emitter : emitters )
 		{
@@ -54,6 +54,27 @@ bool Player::Write( tinyxml2::XMLDocument& xmlDoc, tinyxml2::XMLElement* pRootEl
 	return result;
 }
 
+void Player::Snapshot( SaveGameSnapshot& snapshot ) const
+{
+	snapshot.playerVersion = GetVersion();
+	snapshot.captainName = m_ShipCustomisationData.m_CaptainName;
+	snapshot.shipName = m_ShipCustomisationData.m_ShipName;
+	snapshot.playedTime = g_pGame->GetPlayedTime();
+	GetInventory()->Snapshot( snapshot );
+}
+
+bool Player::Restore( const SaveGameSnapshot& snapshot )
+{
+	m_ShipCustomisationData.m_CaptainName = snapshot.captainName;
+	m_ShipCustomisationData.m_ShipName = snapshot.shipName;
+	m_pInventory->Restore( snapshot );
+	m_ShipCustomisationData.m_pModuleInfoHexGrid = m_pInventory->GetHexGrid();
+
+	g_pGame->SetPlayedTime( snapshot.playedTime );
+
+	return true;
+}
+
 bool Player::Read( tinyxml2::XMLElement* pRootElement )
 {
 	float playedTime = 0.0f;
@@ -5,6 +5,7 @@
 #include <coredefines.h>
 
 #include "ship/ship.h"
+#include "savegamesnapshot.h"
 #include "serialisable.h"
 
 namespace Hyperscape
@@ -25,6 +26,8 @@ public:
 	ShipCustomisationData&	GetShipCustomisationData()	{ return m_ShipCustomisationData; }
 	Ship*					GetShip() const				{ return m_pShip; }
 	Inventory*				GetInventory() const		{ return m_pInventory; }
+	void					Snapshot( SaveGameSnapshot& snapshot ) const;
+	bool					Restore( const SaveGameSnapshot& snapshot ); // The counterpart of Read() for binary saves.
 
 	// Serialisable
 	virtual bool			Write( tinyxml2::XMLDocument& xmlDoc, tinyxml2::XMLElement* pRootElement ) override;
@@ -0,0 +1,233 @@
+// Copyright 2026 Pedro Nunes
+//
+// This file is part of Hyperscape.
+//
+// Hyperscape is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Hyperscape is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Hyperscape. If not, see <http://www.gnu.org/licenses/>.
+
+// clang-format off
+#include <externalheadersbegin.hpp>
+#include <bitsery/bitsery.h>
+#include <bitsery/adapter/buffer.h>
+#include <bitsery/traits/array.h>
+#include <bitsery/traits/string.h>
+#include <bitsery/traits/vector.h>
+#include <externalheadersend.hpp>
+// clang-format on
+
+#include <log.hpp>
+
+#include "ship/hexgrid.h"
+#include "savegamebinary.h"
+
+namespace Hyperscape
+{
+
+// Every binary save starts with this magic number followed by the format version.
+// Saves with any other version are rejected rather than partially loaded.
+// Version 3 replaced the encoded XML tree with the SaveGameSnapshot.
+static const uint32_t sBinarySaveMagic = 0x56415348; // "HSAV"
+static const uint32_t sBinarySaveVersion = 3;
+
+// Magic number, version and the header block, which has no variable length fields.
+static const size_t sHeaderBlockSize = sizeof( uint32_t ) * 2 + sizeof( BinarySaveHeader::captainName ) + sizeof( BinarySaveHeader::shipName ) + sizeof( float ) + sizeof( uint8_t );
+
+// Upper bounds used by bitsery to reject corrupted files before allocating.
+static const size_t sMaxStringLength = 1 << 16;
+static const size_t sMaxEntries = 1 << 16;
+
+using BinarySaveBuffer = std::vector<uint8_t>;
+using BinarySaveOutputAdapter = bitsery::OutputBufferAdapter<BinarySaveBuffer>;
+using BinarySaveInputAdapter = bitsery::InputBufferAdapter<BinarySaveBuffer>;
+
+template <typename S> void serialize( S& s, BinarySaveHeader& header )
+{
+	s.container1b( header.captainName );
+	s.container1b( header.shipName );
+	s.value4b( header.playedTime );
+	s.value1b( header.alive );
+}
+
+template <typename S> void serialize( S& s, SaveGameItem& item )
+{
+	s.text1b( item.moduleName, sMaxStringLength );
+	s.value4b( item.quantity );
+	s.value4b( item.cached );
+}
+
+template <typename S> void serialize( S& s, SaveGameModule& module )
+{
+	s.value4b( module.x );
+	s.value4b( module.y );
+	s.text1b( module.moduleName, sMaxStringLength );
+}
+
+template <typename S> void serialize( S& s, SaveGameFact& fact )
+{
+	s.text1b( fact.name, sMaxStringLength );
+	s.value4b( fact.value );
+}
+
+template <typename S> void serialize( S& s, SaveGameSnapshot& snapshot )
+{
+	s.boolValue( snapshot.alive );
+	s.value4b( snapshot.playerVersion );
+	s.text1b( snapshot.captainName, sMaxStringLength );
+	s.text1b( snapshot.shipName, sMaxStringLength );
+	s.value4b( snapshot.playedTime );
+	s.value4b( snapshot.inventoryVersion );
+	s.container( snapshot.items, sMaxEntries );
+	s.value4b( snapshot.hexGridVersion );
+	s.container( snapshot.modules, sMaxEntries );
+	s.container( snapshot.facts, sMaxEntries );
+}
+
+BinarySaveDocument::BinarySaveDocument() :
+m_Header{}
+{
+
+}
+
+BinarySaveDocument::BinarySaveDocument( SaveGameSnapshot&& snapshot ) :
+m_Header{},
+m_Snapshot( std::move( snapshot ) )
+{
+
+}
+
+bool BinarySaveDocument::Serialise( std::vector<uint8_t>& buffer ) const
+{
+	buffer.clear();
+
+	bitsery::Serializer<BinarySaveOutputAdapter> serializer{ buffer };
+	serializer.value4b( sBinarySaveMagic );
+	serializer.value4b( sBinarySaveVersion );
+
+	// bitsery needs mutable objects, even though serialising doesn't change them.
+	serializer.object( const_cast<BinarySaveHeader&>( m_Header ) );
+	serializer.object( const_cast<SaveGameSnapshot&>( m_Snapshot ) );
+	serializer.adapter().flush();
+	buffer.resize( serializer.adapter().writtenBytesCount() );
+	return true;
+}
+
+bool BinarySaveDocument::Deserialise( const std::vector<uint8_t>& buffer )
+{
+	bitsery::Deserializer<BinarySaveInputAdapter> deserializer{ buffer.begin(), buffer.size() };
+
+	uint32_t magic = 0;
+	uint32_t version = 0;
+	deserializer.value4b( magic );
+	deserializer.value4b( version );
+	if ( magic != sBinarySaveMagic )
+	{
+		Genesis::Log::Warning() << "Binary save has an invalid magic number.";
+		return false;
+	}
+	else if ( version != sBinarySaveVersion )
+	{
+		Genesis::Log::Warning() << "Binary save has version " << version << ", expected version " << sBinarySaveVersion << ".";
+		return false;
+	}
+
+	deserializer.object( m_Header );
+	deserializer.object( m_Snapshot );
+	if ( deserializer.adapter().error() != bitsery::ReaderError::NoError || deserializer.adapter().isCompletedSuccessfully() == false )
+	{
+		Genesis::Log::Warning() << "Binary save is corrupted.";
+		return false;
+	}
+	else if ( IsValid() == false )
+	{
+		Genesis::Log::Warning() << "Binary save has modules outside of the ship's hexgrid.";
+		return false;
+	}
+
+	return true;
+}
+
+void BinarySaveDocument::SetHeader( const BinarySaveHeader& header )
+{
+	m_Header = header;
+}
+
+const BinarySaveHeader& BinarySaveDocument::GetHeader() const
+{
+	return m_Header;
+}
+
+const SaveGameSnapshot& BinarySaveDocument::GetSnapshot() const
+{
+	return m_Snapshot;
+}
+
+bool BinarySaveDocument::ReadHeader( const std::vector<uint8_t>& data, BinarySaveHeader& header )
+{
+	if ( data.size() < sHeaderBlockSize )
+	{
+		return false;
+	}
+
+	// Only the header block is handed to bitsery, as the data will usually be a partial read of the file.
+	bitsery::Deserializer<BinarySaveInputAdapter> deserializer{ data.begin(), sHeaderBlockSize };
+
+	uint32_t magic = 0;
+	uint32_t version = 0;
+	deserializer.value4b( magic );
+	deserializer.value4b( version );
+	if ( magic != sBinarySaveMagic || version != sBinarySaveVersion )
+	{
+		return false;
+	}
+
+	deserializer.object( header );
+	if ( deserializer.adapter().error() != bitsery::ReaderError::NoError )
+	{
+		return false;
+	}
+
+	// Names are always written with a terminator, but the file could have been tampered with.
+	header.captainName.back() = '\0';
+	header.shipName.back() = '\0';
+	return true;
+}
+
+size_t BinarySaveDocument::GetHeaderBlockSize()
+{
+	return sHeaderBlockSize;
+}
+
+bool BinarySaveDocument::IsBinarySave( const std::filesystem::path& filename )
+{
+	return filename.extension() == GetExtension();
+}
+
+const char* BinarySaveDocument::GetExtension()
+{
+	return ".sav";
+}
+
+bool BinarySaveDocument::IsValid() const
+{
+	for ( const SaveGameModule& module : m_Snapshot.modules )
+	{
+		if ( module.x < 0 || module.x >= sHexGridWidth || module.y < 0 || module.y >= sHexGridHeight )
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+}
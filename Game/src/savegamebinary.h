@@ -0,0 +1,82 @@
+// Copyright 2026 Pedro Nunes
+//
+// This file is part of Hyperscape.
+//
+// Hyperscape is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Hyperscape is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Hyperscape. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <coredefines.h>
+
+#include "savegamesnapshot.h"
+
+namespace Hyperscape
+{
+
+// Fixed size block written right after the magic number and version of every binary save.
+// It holds everything the load menu needs, so listing the saves only takes one small read per file.
+struct BinarySaveHeader
+{
+	std::array<char, 128> captainName;
+	std::array<char, 128> shipName;
+	float playedTime;
+	uint8_t alive;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// BinarySaveDocument
+// A save game in the binary format: the header block followed by a
+// SaveGameSnapshot, serialised with bitsery. It is built from a snapshot
+// taken on the main thread and never modified afterwards, so it can be
+// handed over to the save thread while the game carries on.
+///////////////////////////////////////////////////////////////////////////////
+
+class BinarySaveDocument
+{
+public:
+								BinarySaveDocument();
+	explicit					BinarySaveDocument( SaveGameSnapshot&& snapshot );
+
+	bool						Serialise( std::vector<uint8_t>& buffer ) const;
+	bool						Deserialise( const std::vector<uint8_t>& buffer );
+
+	void						SetHeader( const BinarySaveHeader& header );
+	const BinarySaveHeader&		GetHeader() const;
+	const SaveGameSnapshot&		GetSnapshot() const;
+
+	static bool					IsBinarySave( const std::filesystem::path& filename );
+	static const char*			GetExtension();
+
+	// Reads the header block from the start of a binary save. Only the first GetHeaderBlockSize() bytes
+	// of the file are needed. Returns false if the data isn't a binary save in the current format.
+	static bool					ReadHeader( const std::vector<uint8_t>& data, BinarySaveHeader& header );
+	static size_t				GetHeaderBlockSize();
+
+private:
+	bool						IsValid() const;
+
+	BinarySaveHeader			m_Header;
+	SaveGameSnapshot			m_Snapshot;
+};
+
+GENESIS_DECLARE_SMART_PTR( BinarySaveDocument );
+
+}
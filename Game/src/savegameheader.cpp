@@ -67,4 +67,39 @@ bool SaveGameHeader::Read( tinyxml2::XMLDocument& xmlDoc )
 	return ( m_Error == SaveGameHeaderError::NoError );
 }
 
-}
\ No newline at end of file
+bool SaveGameHeader::Read( const BinarySaveHeader& header )
+{
+	m_CaptainName = header.captainName.data();
+	m_ShipName = header.shipName.data();
+	m_PlayedTime = header.playedTime;
+	m_Alive = ( header.alive != 0 );
+
+	const bool allContentSerialised = ( m_CaptainName.empty() == false && m_ShipName.empty() == false );
+	m_Error = allContentSerialised ? SaveGameHeaderError::NoError : SaveGameHeaderError::ContentError;
+	return ( m_Error == SaveGameHeaderError::NoError );
+}
+
+bool SaveGameHeader::Read( const SaveGameSnapshot& snapshot )
+{
+	m_CaptainName = snapshot.captainName;
+	m_ShipName = snapshot.shipName;
+	m_PlayedTime = snapshot.playedTime;
+	m_Alive = snapshot.alive;
+
+	const bool allContentSerialised = ( m_CaptainName.empty() == false && m_ShipName.empty() == false );
+	m_Error = allContentSerialised ? SaveGameHeaderError::NoError : SaveGameHeaderError::ContentError;
+	return ( m_Error == SaveGameHeaderError::NoError );
+}
+
+void SaveGameHeader::Write( BinarySaveHeader& header ) const
+{
+	// Names which don't fit are truncated, always leaving room for the terminator.
+	header.captainName.fill( '\0' );
+	header.shipName.fill( '\0' );
+	std::copy_n( m_CaptainName.begin(), std::min( m_CaptainName.size(), header.captainName.size() - 1 ), header.captainName.begin() );
+	std::copy_n( m_ShipName.begin(), std::min( m_ShipName.size(), header.shipName.size() - 1 ), header.shipName.begin() );
+	header.playedTime = m_PlayedTime;
+	header.alive = m_Alive ? 1 : 0;
+}
+
+}
@@ -23,8 +23,10 @@
 
 #include <coredefines.h>
 #include <genesis.h>
+#include <xml.h>
 
 #include "game.hpp"
+#include "savegamebinary.h"
 
 namespace Hyperscape
 {
@@ -46,6 +48,9 @@ public:
 								SaveGameHeader( const std::filesystem::path& filename );
 
 	bool						Read( tinyxml2::XMLDocument& xmlDoc );
+	bool						Read( const BinarySaveHeader& header );
+	bool						Read( const SaveGameSnapshot& snapshot );
+	void						Write( BinarySaveHeader& header ) const;
 	inline bool					IsValid() const				{ return m_Error == SaveGameHeaderError::NoError; }
 	inline SaveGameHeaderError	GetError() const			{ return m_Error; }
 
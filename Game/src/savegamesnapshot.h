@@ -0,0 +1,71 @@
+// Copyright 2026 Pedro Nunes
+//
+// This file is part of Hyperscape.
+//
+// Hyperscape is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Hyperscape is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Hyperscape. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+namespace Hyperscape
+{
+
+struct SaveGameItem
+{
+	std::string moduleName;
+	int quantity;
+	int cached;
+};
+
+struct SaveGameModule
+{
+	int x;
+	int y;
+	std::string moduleName;
+};
+
+struct SaveGameFact
+{
+	std::string name;
+	int value;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// SaveGameSnapshot
+// Everything that goes into a save game, copied out of the game state as
+// plain values. Taking a snapshot is cheap enough to do on the main thread;
+// it holds no pointers into the game, so the save thread can serialise it
+// while the game carries on.
+///////////////////////////////////////////////////////////////////////////////
+
+struct SaveGameSnapshot
+{
+	bool alive = true;
+
+	int playerVersion = 0;
+	std::string captainName;
+	std::string shipName;
+	float playedTime = 0.0f;
+
+	int inventoryVersion = 0;
+	std::vector<SaveGameItem> items;
+	int hexGridVersion = 0;
+	std::vector<SaveGameModule> modules;
+
+	std::vector<SaveGameFact> facts;
+};
+
+}
@@ -18,10 +18,15 @@
 #ifdef _WIN32
 #define NOMINMAX
 #include <windows.h>
+#else
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
 #endif
 
 #include <algorithm>
 #include <filesystem>
+#include <fstream>
 #include <sstream>
 
 #include <genesis.h>
@@ -44,8 +49,12 @@ namespace Hyperscape
 SaveGameStorage::SaveGameStorage() :
 m_DebugWindowOpen( false ),
 m_CloudStorageActive( false ),
-m_pXmlReadThread( nullptr ),
-m_Ready( false )
+m_Ready( false ),
+m_Generation( 0 ),
+m_HeadersReused( 0 ),
+m_HeadersReadFromBlock( 0 ),
+m_pWriteThread( nullptr ),
+m_WriteFinished( false )
 {
 	Genesis::ImGuiImpl::RegisterDevMenu( "Game", "Save game storage", &m_DebugWindowOpen );
 
@@ -58,6 +67,141 @@ m_Ready( false )
 		m_CloudStorageActive = false;
 	}
 
+#endif // USE_STEAM
+
+	Refresh();
+}
+
+void SaveGameStorage::Refresh()
+{
+	// Whatever the previous scan finds would be out of date, so there's no point in waiting for it.
+	if ( m_pScan != nullptr )
+	{
+		m_pScan->cancelled.store( true );
+		m_CancelledScans.push_back( std::move( m_pScan ) );
+	}
+
+	m_pScan = std::make_unique<Scan>();
+	m_pScan->pSaveGameStorage = this;
+	m_pScan->storageFiles = ListStorageFiles();
+
+	bool needsScanThread = false;
+	m_HeadersReused = 0;
+	for ( auto& pStorageFile : m_pScan->storageFiles )
+	{
+		// Files which haven't changed since the last refresh keep their header.
+		auto it = std::find_if( m_StorageFiles.begin(), m_StorageFiles.end(), [ &pStorageFile ]( const std::shared_ptr< StorageFile >& pExistingFile ) { return pExistingFile->filename == pStorageFile->filename; } );
+		if ( it != m_StorageFiles.end() && ( *it )->pSaveGameHeader != nullptr && ( *it )->fileSize == pStorageFile->fileSize && ( *it )->timestamp == pStorageFile->timestamp )
+		{
+			pStorageFile->pSaveGameHeader = ( *it )->pSaveGameHeader;
+			m_HeadersReused++;
+		}
+		else
+		{
+			needsScanThread = true;
+		}
+	}
+
+	m_Ready = false;
+	if ( needsScanThread )
+	{
+		m_pScan->pThread = SDL_CreateThread( &SaveGameStorage::sScanThreadMain, "Save game storage - scan thread", m_pScan.get() );
+		if ( m_pScan->pThread == nullptr )
+		{
+			Genesis::Log::Warning() << "Couldn't create save game scan thread, scanning on the main thread: " << SDL_GetError();
+			sScanThreadMain( m_pScan.get() );
+		}
+	}
+	else
+	{
+		m_pScan->finished.store( true );
+	}
+
+	if ( m_pScan->pThread == nullptr )
+	{
+		FinishScan();
+	}
+}
+
+int SaveGameStorage::sScanThreadMain( void* pData )
+{
+	Scan* pScan = reinterpret_cast< Scan* >( pData );
+	StorageFileList& storageFiles = pScan->storageFiles;
+	for ( StorageFileList::iterator it = storageFiles.begin(); it != storageFiles.end() && pScan->cancelled.load() == false; )
+	{
+		auto pStorageFile = *it;
+		if ( pStorageFile->pSaveGameHeader != nullptr )
+		{
+			it++;
+		}
+		else if ( pScan->pSaveGameStorage->ReadHeaderBlock( *pStorageFile ) )
+		{
+			pScan->headersReadFromBlock++;
+			it++;
+		}
+		else if ( BinarySaveDocument::IsBinarySave( pStorageFile->filename ) )
+		{
+			// Every binary save has a header block, so this one is either corrupted or in a format we can't load.
+			Genesis::Log::Warning() << "Couldn't read the header of save game '" << ToString( pStorageFile->filename ) << "', skipping.";
+			it = storageFiles.erase( it );
+		}
+		else
+		{
+			// XML saves have to be read in full.
+			tinyxml2::XMLDocument xmlDoc;
+			pScan->pSaveGameStorage->XmlRead( pStorageFile->filename, xmlDoc );
+
+			SaveGameHeaderSharedPtr pSaveGameHeader = std::make_shared< SaveGameHeader >( pStorageFile->filename );
+			if ( pSaveGameHeader->Read( xmlDoc ) )
+			{
+				pStorageFile->pSaveGameHeader = pSaveGameHeader;
+				it++;
+			}
+			else
+			{
+				it = storageFiles.erase( it );
+			}
+		}
+	}
+
+	pScan->finished.store( true );
+	return 0;
+}
+
+void SaveGameStorage::WaitForScan()
+{
+	if ( m_pScan != nullptr )
+	{
+		if ( m_pScan->pThread != nullptr )
+		{
+			SDL_WaitThread( m_pScan->pThread, nullptr );
+			m_pScan->pThread = nullptr;
+		}
+
+		FinishScan();
+	}
+}
+
+void SaveGameStorage::FinishScan()
+{
+	SDL_assert( m_pScan != nullptr && m_pScan->finished.load() );
+	if ( m_pScan->pThread != nullptr )
+	{
+		SDL_WaitThread( m_pScan->pThread, nullptr );
+	}
+
+	m_StorageFiles = std::move( m_pScan->storageFiles );
+	m_HeadersReadFromBlock = m_pScan->headersReadFromBlock;
+	m_pScan = nullptr;
+	m_Ready = true;
+	m_Generation++;
+}
+
+SaveGameStorage::StorageFileList SaveGameStorage::ListStorageFiles() const
+{
+	StorageFileList storageFiles;
+
+#if USE_STEAM
 	if ( m_CloudStorageActive )
 	{
 		const int filecount = m_pSteamRemoteStorage->GetFileCount();
@@ -65,9 +209,16 @@ m_Ready( false )
 		{
 			int fileSize = 0;
 			const char* pFilename = m_pSteamRemoteStorage->GetFileNameAndSize( i, &fileSize );
+			if ( IsSaveGameFile( pFilename ) == false )
+			{
+				continue;
+			}
+
 			std::shared_ptr<StorageFile> pStorageFile = std::make_shared<StorageFile>();
 			pStorageFile->filename = ToWString( pFilename );
-			m_StorageFiles.push_back( pStorageFile );
+			pStorageFile->fileSize = static_cast<std::uintmax_t>( fileSize );
+			pStorageFile->timestamp = m_pSteamRemoteStorage->GetFileTimestamp( pFilename );
+			storageFiles.push_back( pStorageFile );
 		}
 	}
 #endif // USE_STEAM
@@ -79,14 +230,123 @@ m_Ready( false )
 		{
 			for ( const auto& filename : std::filesystem::directory_iterator( saveGameDirectory ) )
 			{
+				// Skips anything else in the folder, such as temporary files left behind by an interrupted save.
+				if ( IsSaveGameFile( filename.path() ) == false )
+				{
+					continue;
+				}
+
+				std::error_code errorCode;
 				std::shared_ptr< StorageFile > pStorageFile = std::make_shared<StorageFile>();
 				pStorageFile->filename = filename.path();
-				m_StorageFiles.push_back( pStorageFile );
+				pStorageFile->fileSize = filename.file_size( errorCode );
+				pStorageFile->timestamp = static_cast<int64_t>( filename.last_write_time( errorCode ).time_since_epoch().count() );
+				storageFiles.push_back( pStorageFile );
 			}
 		}
 	}
 
-	m_pXmlReadThread = SDL_CreateThread( &SaveGameStorage::sXmlReadThreadMain, "Save game storage - reader thread", this );
+	return storageFiles;
+}
+
+bool SaveGameStorage::ReadHeaderBlock( StorageFile& storageFile )
+{
+	if ( BinarySaveDocument::IsBinarySave( storageFile.filename ) == false )
+	{
+		return false;
+	}
+
+	std::vector<uint8_t> data( BinarySaveDocument::GetHeaderBlockSize() );
+
+#if USE_STEAM
+	if ( m_CloudStorageActive )
+	{
+		if ( storageFile.fileSize < data.size() )
+		{
+			return false;
+		}
+
+		const std::string steamFilename = ToString( storageFile.filename );
+		const int32 bytesRead = m_pSteamRemoteStorage->FileRead( steamFilename.c_str(), data.data(), static_cast<int32>( data.size() ) );
+		if ( bytesRead != static_cast<int32>( data.size() ) )
+		{
+			return false;
+		}
+	}
+	else
+#endif // USE_STEAM
+	{
+		std::ifstream file( storageFile.filename, std::ios::in | std::ios::binary );
+		file.read( reinterpret_cast<char*>( data.data() ), static_cast<std::streamsize>( data.size() ) );
+		if ( file.gcount() != static_cast<std::streamsize>( data.size() ) )
+		{
+			return false;
+		}
+	}
+
+	BinarySaveHeader binaryHeader;
+	if ( BinarySaveDocument::ReadHeader( data, binaryHeader ) == false )
+	{
+		return false;
+	}
+
+	SaveGameHeaderSharedPtr pSaveGameHeader = std::make_shared< SaveGameHeader >( storageFile.filename );
+	if ( pSaveGameHeader->Read( binaryHeader ) == false )
+	{
+		return false;
+	}
+
+	storageFile.pSaveGameHeader = pSaveGameHeader;
+	return true;
+}
+
+SaveGameStorage::~SaveGameStorage()
+{
+	// Any save in flight has to reach the disk, or Steam, before we go away.
+	WaitForPendingWrite();
+
+	if ( m_pScan != nullptr )
+	{
+		m_pScan->cancelled.store( true );
+		m_CancelledScans.push_back( std::move( m_pScan ) );
+	}
+
+	for ( auto& pScan : m_CancelledScans )
+	{
+		if ( pScan->pThread != nullptr )
+		{
+			SDL_WaitThread( pScan->pThread, nullptr );
+		}
+	}
+
+	Genesis::ImGuiImpl::UnregisterDevMenu( "Game", "Save game storage" );
+}
+
+void SaveGameStorage::Update()
+{
+	if ( m_pPendingWrite != nullptr && m_WriteFinished.load() )
+	{
+		WaitForPendingWrite();
+	}
+
+	if ( m_pScan != nullptr && m_pScan->finished.load() )
+	{
+		FinishScan();
+	}
+
+	m_CancelledScans.remove_if( []( const ScanUniquePtr& pScan )
+	{
+		if ( pScan->finished.load() == false )
+		{
+			return false;
+		}
+
+		if ( pScan->pThread != nullptr )
+		{
+			SDL_WaitThread( pScan->pThread, nullptr );
+		}
+		return true;
+	} );
 }
 
 void SaveGameStorage::UpdateDebugUI()
@@ -95,6 +355,23 @@ void SaveGameStorage::UpdateDebugUI()
 	{
 		ImGui::SetNextWindowSize( ImVec2( 600.0f, 800.0f ) );
 		ImGui::Begin( "Save game storage", &m_DebugWindowOpen );
+
+		if ( m_pPendingWrite != nullptr )
+		{
+			std::string filename = ToString( m_pPendingWrite->filename );
+			ImGui::Text( "Writing: %s", filename.c_str() );
+		}
+		else
+		{
+			ImGui::Text( "Writing: -" );
+		}
+
+		ImGui::Text( "Scanning: %s (%d cancelled scans still running)", m_pScan == nullptr ? "no" : "yes", static_cast<int>( m_CancelledScans.size() ) );
+		ImGui::Text( "Last refresh: %d headers reused, %d read from header blocks", m_HeadersReused, m_HeadersReadFromBlock );
+		if ( ImGui::Button( "Refresh" ) )
+		{
+			Refresh();
+		}
 		
 		ImGui::Columns( 2 );
 
@@ -115,17 +392,22 @@ void SaveGameStorage::UpdateDebugUI()
 	}
 }
 
-bool SaveGameStorage::SaveGame( bool killSave /* = false */ )
+void SaveGameStorage::SaveGame( bool killSave /* = false */ )
 {
 	using namespace Genesis;
 
 	if ( g_pGame->GetState() != GameState::GalaxyView )
 	{
 		g_pGame->RaiseInteractiveWarning( "Save failed: attempting to save game while not in the galaxy view." );
-		return false;
+		return;
 	}
 
+	// Only one save can be in flight at a time. Saves are rare enough that waiting here is fine.
+	WaitForPendingWrite();
+
 	std::filesystem::path filename = GetSaveGameFileName();
+	std::filesystem::path legacyFilename = filename;
+	legacyFilename.replace_extension( ".xml" );
 	std::filesystem::path fullPath;
 
 	if ( m_CloudStorageActive == false )
@@ -136,137 +418,272 @@ bool SaveGameStorage::SaveGame( bool killSave /* = false */ )
 		if ( !CreateSaveGameFolder( gameSaveGameFolder ) )
 		{
 			g_pGame->RaiseInteractiveWarning( "Save failed: couldn't create save game folder." );
-			return false;
+			return;
 		}
 
 		fullPath = gameSaveGameFolder / filename; 
+		legacyFilename = gameSaveGameFolder / legacyFilename;
 		Genesis::Log::Info() << "Attempting to save to " << ToString(fullPath);
 	}
 
-	tinyxml2::XMLDocument xmlDoc;
-	CreateSaveGameData( xmlDoc, killSave );
+	// The game state is copied into a snapshot here, on the main thread. Everything after this
+	// point only touches the snapshot, and serialising it is done by the save thread.
+	SaveGameSnapshot snapshot;
+	CreateSaveGameSnapshot( snapshot, killSave );
+
+	m_pPendingWrite = std::make_unique<PendingWrite>();
+	m_pPendingWrite->pSaveGameHeader = std::make_shared<SaveGameHeader>( m_CloudStorageActive ? filename : fullPath );
+	m_pPendingWrite->pSaveGameHeader->Read( snapshot );
+	m_pPendingWrite->pDocument = std::make_unique<BinarySaveDocument>( std::move( snapshot ) );
+
+	BinarySaveHeader binaryHeader;
+	m_pPendingWrite->pSaveGameHeader->Write( binaryHeader );
+	m_pPendingWrite->pDocument->SetHeader( binaryHeader );
+	m_pPendingWrite->filename = filename;
+	m_pPendingWrite->fullPath = fullPath;
+	m_pPendingWrite->legacyFilename = legacyFilename;
+	m_pPendingWrite->serialised = false;
+	m_pPendingWrite->success = false;
+
+	m_WriteFinished.store( false );
+	m_pWriteThread = SDL_CreateThread( &SaveGameStorage::sWriteThreadMain, "Save game storage - writer thread", this );
+	if ( m_pWriteThread == nullptr )
+	{
+		Genesis::Log::Warning() << "Couldn't create save game writer thread, saving on the main thread: " << SDL_GetError();
+		sWriteThreadMain( this );
+		WaitForPendingWrite();
+	}
+}
 
-	if ( m_CloudStorageActive )
+int SaveGameStorage::sWriteThreadMain( void* pData )
+{
+	SaveGameStorage* pSaveGameStorage = reinterpret_cast< SaveGameStorage* >( pData );
+	PendingWrite* pPendingWrite = pSaveGameStorage->m_pPendingWrite.get();
+
+	pPendingWrite->serialised = pPendingWrite->pDocument->Serialise( pPendingWrite->data );
+	if ( pPendingWrite->serialised == false )
 	{
-		return SaveToRemoteStorage( xmlDoc );
+		pPendingWrite->error = "Save failed: couldn't serialise the game state.";
 	}
-	else
+	else if ( pSaveGameStorage->m_CloudStorageActive == false )
 	{
-		return SaveToLocalStorage( xmlDoc, fullPath );
+		pPendingWrite->success = pSaveGameStorage->SaveToLocalStorage( pPendingWrite->data, pPendingWrite->fullPath, pPendingWrite->error );
 	}
+
+	pSaveGameStorage->m_WriteFinished.store( true );
+	return 0;
 }
 
-bool SaveGameStorage::SaveToLocalStorage( tinyxml2::XMLDocument& xmlDoc, const std::filesystem::path& fullPath )
+void SaveGameStorage::WaitForPendingWrite()
 {
-	using namespace tinyxml2;
+	if ( m_pPendingWrite == nullptr )
+	{
+		return;
+	}
 
-	FILE* fp = nullptr;
+	if ( m_pWriteThread != nullptr )
+	{
+		SDL_WaitThread( m_pWriteThread, nullptr );
+		m_pWriteThread = nullptr;
+	}
 
-#ifdef _WIN32
-	errno_t err = _wfopen_s( &fp, fullPath.c_str(), L"wb" );
-	if ( err != 0 )
+	if ( m_CloudStorageActive && m_pPendingWrite->serialised )
 	{
-		char errorMessage[256];
-		strerror_s( errorMessage, 256, err );
+		m_pPendingWrite->success = SaveToRemoteStorage( m_pPendingWrite->data, m_pPendingWrite->filename, m_pPendingWrite->error );
+	}
 
-		std::stringstream ss;
-		ss << "Save failed: " << errorMessage;
-		g_pGame->RaiseInteractiveWarning( ss.str() );
+	if ( m_pPendingWrite->success )
+	{
+		// Once the binary save is safely written, an XML save for the same captain and ship is out of date.
+#if USE_STEAM
+		if ( m_CloudStorageActive )
+		{
+			const std::string steamFilename = ToString( m_pPendingWrite->legacyFilename );
+			if ( m_pSteamRemoteStorage->FileExists( steamFilename.c_str() ) )
+			{
+				m_pSteamRemoteStorage->FileDelete( steamFilename.c_str() );
+			}
+		}
+		else
+#endif // USE_STEAM
+		{
+			std::error_code errorCode;
+			std::filesystem::remove( m_pPendingWrite->legacyFilename, errorCode );
+		}
+
+		RemoveStorageFile( m_pPendingWrite->legacyFilename );
+		UpdateStorageFiles( m_pPendingWrite->pSaveGameHeader->GetFilename(), *m_pPendingWrite->pSaveGameHeader );
+		Genesis::Log::Info() << "Game saved successfully!";
+
+		// A scan in flight may have listed the files before this save was written.
+		if ( m_pScan != nullptr )
+		{
+			Refresh();
+		}
+	}
+	else
+	{
+		g_pGame->RaiseInteractiveWarning( m_pPendingWrite->error );
+	}
+
+	m_pPendingWrite = nullptr;
+}
+
+// Only returns once the data has reached the disk and the file has been closed without errors,
+// as otherwise the rename which follows could replace a good save with one which is lost on a
+// power cut.
+static bool WriteToDisk( const std::vector<uint8_t>& data, const std::filesystem::path& path, std::string& error )
+{
+#ifdef _WIN32
+	HANDLE hFile = CreateFileW( path.c_str(), GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr );
+	if ( hFile == INVALID_HANDLE_VALUE )
+	{
+		error = "Save failed: couldn't create " + ToString( path );
 		return false;
 	}
+
+	bool success = true;
+	size_t written = 0;
+	while ( success && written < data.size() )
+	{
+		const DWORD bytesToWrite = static_cast<DWORD>( std::min<size_t>( data.size() - written, 1u << 30 ) );
+		DWORD bytesWritten = 0;
+		success = WriteFile( hFile, data.data() + written, bytesToWrite, &bytesWritten, nullptr ) != FALSE;
+		written += bytesWritten;
+	}
+	success = success && FlushFileBuffers( hFile ) != FALSE;
+	success = ( CloseHandle( hFile ) != FALSE ) && success;
 #else
-	fp = fopen( fullPath.c_str(), "wb" );
-	if ( fp == nullptr )
+	const int fd = open( path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644 );
+	if ( fd == -1 )
 	{
-		std::stringstream ss;
-		ss << "Save failed: error " << errno;
-		g_pGame->RaiseInteractiveWarning( ss.str() );
+		error = "Save failed: couldn't create " + ToString( path );
 		return false;
 	}
+
+	bool success = true;
+	size_t written = 0;
+	while ( success && written < data.size() )
+	{
+		const ssize_t bytesWritten = write( fd, data.data() + written, data.size() - written );
+		if ( bytesWritten >= 0 )
+		{
+			written += static_cast<size_t>( bytesWritten );
+		}
+		else
+		{
+			success = ( errno == EINTR );
+		}
+	}
+	success = success && fsync( fd ) == 0;
+	success = ( close( fd ) == 0 ) && success;
 #endif
 
-	XMLError saveResult = xmlDoc.SaveFile( fp );
+	if ( success == false )
+	{
+		error = "Save failed: couldn't write " + ToString( path );
+	}
+	return success;
+}
+
+bool SaveGameStorage::SaveToLocalStorage( const std::vector<uint8_t>& data, const std::filesystem::path& fullPath, std::string& error )
+{
+	// The save is written to a temporary file which then replaces the existing save, so
+	// a crash or a full disk halfway through never leaves the player with a broken save.
+	std::filesystem::path temporaryPath = fullPath;
+	temporaryPath += ".tmp";
 
-	if ( saveResult == XMLError::XML_SUCCESS )
+	if ( WriteToDisk( data, temporaryPath, error ) == false )
 	{
-		Genesis::Log::Info() << "Game saved successfully!";
-		fclose( fp );
-		return true;
+		std::error_code errorCode;
+		std::filesystem::remove( temporaryPath, errorCode );
+		return false;
 	}
-	else
+
+	std::error_code errorCode;
+	std::filesystem::rename( temporaryPath, fullPath, errorCode );
+	if ( errorCode )
 	{
-		std::stringstream ss;
-		ss << "Save failed: TinyXML error code " << static_cast<unsigned int>( saveResult );
-		g_pGame->RaiseInteractiveWarning( ss.str() );
-		fclose( fp );
+		error = "Save failed: " + errorCode.message();
+		std::filesystem::remove( temporaryPath, errorCode );
 		return false;
 	}
 
-	return false;
+	return true;
 }
 
-bool SaveGameStorage::SaveToRemoteStorage( tinyxml2::XMLDocument& xmlDoc )
+bool SaveGameStorage::SaveToRemoteStorage( const std::vector<uint8_t>& data, const std::filesystem::path& filename, std::string& error )
 {
-	bool success = false;
-	std::filesystem::path filename = GetSaveGameFileName();
-
 #if USE_STEAM
-	// Generates a buffer with the XML contents which can then be passed to Steam.
-	using namespace tinyxml2;
-	XMLPrinter printer;
-	xmlDoc.Print( &printer );
-
-	std::string steamFilename = ToString( filename );
-	success = m_pSteamRemoteStorage->FileWrite( steamFilename.c_str(), printer.CStr(), printer.CStrSize() );
+	// Steam only replaces the file once the whole buffer has been received.
+	const std::string steamFilename = ToString( filename );
+	if ( m_pSteamRemoteStorage->FileWrite( steamFilename.c_str(), data.data(), static_cast<int32>( data.size() ) ) )
 	{
-		UpdateStorageFiles( filename, xmlDoc );
 		return true;
 	}
+
+	error = "Save failed: couldn't write to Steam remote storage.";
+	return false;
 #else
 	SDL_assert( false ); // Not implemented
+	error = "Save failed: remote storage isn't available.";
+	return false;
 #endif
-
-	if ( success )
-	{
-		UpdateStorageFiles( filename, xmlDoc );
-	}
-
-	return success;
 }
 
-bool SaveGameStorage::LoadGame( const std::filesystem::path& filename, tinyxml2::XMLDocument& xmlDoc )
+bool SaveGameStorage::LoadGame( const std::filesystem::path& filename, PlayerSharedPtr& pPlayer )
 {
-	return XmlRead( filename, xmlDoc );
-}
+	// Make sure we aren't reading a save which is still being written.
+	WaitForPendingWrite();
 
-int SaveGameStorage::sXmlReadThreadMain( void* pData )
-{
-	using namespace tinyxml2;
-	SaveGameStorage* pSaveGameStorage = reinterpret_cast< SaveGameStorage* >( pData );
-	for ( StorageFileList::iterator it = pSaveGameStorage->m_StorageFiles.begin(); it != pSaveGameStorage->m_StorageFiles.end(); )
+	pPlayer = std::make_shared< Player >();
+	bool loaded = false;
+
+	// Binary saves are restored straight from their snapshot. Saves from older versions of the
+	// game are still in XML and go through the Serialisable interface.
+	if ( BinarySaveDocument::IsBinarySave( filename ) )
 	{
-		auto pStorageFile = *it;
-		if ( pStorageFile->pSaveGameHeader == nullptr )
+		BinarySaveDocument document;
+		if ( BinaryRead( filename, document ) == false )
 		{
-			tinyxml2::XMLDocument xmlDoc;
-			pSaveGameStorage->XmlRead( pStorageFile->filename, xmlDoc );
+			g_pGame->RaiseInteractiveWarning( "Load failed: invalid save file." );
+			pPlayer = nullptr;
+			return false;
+		}
 
-			SaveGameHeaderSharedPtr pSaveGameHeader = std::make_shared< SaveGameHeader >( pStorageFile->filename );
-			if ( pSaveGameHeader->Read( xmlDoc ) )
-			{
-				pStorageFile->pSaveGameHeader = pSaveGameHeader;
-				it++;
-			}
-			else
+		loaded = pPlayer->Restore( document.GetSnapshot() );
+	}
+	else
+	{
+		tinyxml2::XMLDocument xmlDoc;
+		if ( XmlRead( filename, xmlDoc ) == false || xmlDoc.FirstChildElement() == nullptr )
+		{
+			pPlayer = nullptr;
+			return false;
+		}
+
+		for ( tinyxml2::XMLElement* pElement = xmlDoc.FirstChildElement()->FirstChildElement(); pElement != nullptr; pElement = pElement->NextSiblingElement() )
+		{
+			if ( std::string( pElement->Value() ) == "Player" )
 			{
-				it = pSaveGameStorage->m_StorageFiles.erase( it );
+				loaded = pPlayer->Read( pElement );
+				break;
 			}
 		}
 	}
 
-	pSaveGameStorage->m_Ready.store( true );
+	if ( loaded == false )
+	{
+		g_pGame->RaiseInteractiveWarning( "Invalid save file." );
+		pPlayer = nullptr;
+	}
 
-	return 0;
+	return loaded;
+}
+
+bool SaveGameStorage::IsSaveGameFile( const std::filesystem::path& filename )
+{
+	return BinarySaveDocument::IsBinarySave( filename ) || filename.extension() == ".xml";
 }
 
 bool SaveGameStorage::XmlRead( const std::filesystem::path& filename, tinyxml2::XMLDocument& xmlDoc )
@@ -330,7 +747,63 @@ bool SaveGameStorage::XmlRead( const std::filesystem::path& filename, tinyxml2::
 	return true;
 }
 
-void SaveGameStorage::UpdateStorageFiles( const std::filesystem::path& filename, tinyxml2::XMLDocument& xmlDoc )
+bool SaveGameStorage::BinaryRead( const std::filesystem::path& filename, BinarySaveDocument& document )
+{
+	std::vector<uint8_t> data;
+
+#if USE_STEAM
+	if ( m_CloudStorageActive )
+	{
+		std::string steamFilename = ToString( filename );
+		const int fileSize = m_pSteamRemoteStorage->GetFileSize( steamFilename.c_str() );
+		if ( fileSize == 0 )
+		{
+			Genesis::Log::Warning() << "SteamWorks gave a file size of 0 for save game '" << steamFilename << "', skipping this save. This is likely a hiccup from Steam.";
+			return false;
+		}
+
+		data.resize( fileSize );
+		if ( m_pSteamRemoteStorage->FileRead( steamFilename.c_str(), data.data(), fileSize ) != fileSize )
+		{
+			return false;
+		}
+	}
+	else
+#endif // USE_STEAM
+	{
+		std::error_code errorCode;
+		const std::uintmax_t fileSize = std::filesystem::file_size( filename, errorCode );
+		std::ifstream file( filename, std::ios::in | std::ios::binary );
+		if ( errorCode || file.good() == false )
+		{
+			Genesis::Log::Warning() << "Couldn't open save game '" << ToString( filename ) << "'.";
+			return false;
+		}
+
+		data.resize( static_cast<size_t>( fileSize ) );
+		file.read( reinterpret_cast<char*>( data.data() ), static_cast<std::streamsize>( data.size() ) );
+		if ( file.gcount() != static_cast<std::streamsize>( data.size() ) )
+		{
+			Genesis::Log::Warning() << "Couldn't read save game '" << ToString( filename ) << "'.";
+			return false;
+		}
+	}
+
+	if ( document.Deserialise( data ) == false )
+	{
+		Genesis::Log::Warning() << "Save game '" << ToString( filename ) << "' couldn't be deserialised.";
+		return false;
+	}
+
+	return true;
+}
+
+void SaveGameStorage::RemoveStorageFile( const std::filesystem::path& filename )
+{
+	m_StorageFiles.remove_if( [ &filename ]( const std::shared_ptr< StorageFile >& pStorageFile ) { return pStorageFile->filename == filename; } );
+}
+
+void SaveGameStorage::UpdateStorageFiles( const std::filesystem::path& filename, const SaveGameHeader& saveGameHeader )
 {
 	std::shared_ptr< StorageFile > pActiveStorageFile = nullptr;
 	for ( auto& pStorageFile : m_StorageFiles )
@@ -346,34 +819,28 @@ void SaveGameStorage::UpdateStorageFiles( const std::filesystem::path& filename,
 	{
 		pActiveStorageFile = std::make_shared< StorageFile >();
 		pActiveStorageFile->filename = filename;
-		pActiveStorageFile->pSaveGameHeader = std::make_unique< SaveGameHeader >( filename );
 		m_StorageFiles.push_back( pActiveStorageFile );
 	}
 
-	SDL_assert( pActiveStorageFile->pSaveGameHeader != nullptr );
-	pActiveStorageFile->pSaveGameHeader->Read( xmlDoc );
-}
-
-void SaveGameStorage::CreateSaveGameData( tinyxml2::XMLDocument& xmlDoc, bool killSave )
-{
-	using namespace tinyxml2;
-	XMLElement* pRootElement = xmlDoc.NewElement( "Hyperscape" );
-	xmlDoc.InsertFirstChild( pRootElement );
-
-	bool result = true;
-	Xml::Write( xmlDoc, pRootElement, "Alive", !killSave );
-	result &= g_pGame->GetPlayer()->Write( xmlDoc, pRootElement );
-	result &= g_pGame->GetBlackboard()->Write( xmlDoc, pRootElement );
-
-	XMLElement* pFactionsElement = xmlDoc.NewElement( "Factions" );
-	pRootElement->LinkEndChild( pFactionsElement );
-
-	for ( int i = 0; i < static_cast<int>( FactionId::Count ); ++i )
+	// The header is updated in place, as the load menu may be holding on to it.
+	if ( pActiveStorageFile->pSaveGameHeader == nullptr )
 	{
-		g_pGame->GetFaction( static_cast< FactionId >( i ) )->Write( xmlDoc, pFactionsElement );
+		pActiveStorageFile->pSaveGameHeader = std::make_shared< SaveGameHeader >( saveGameHeader );
 	}
+	else
+	{
+		*pActiveStorageFile->pSaveGameHeader = saveGameHeader;
+	}
+
+	m_Generation++;
+}
 
-	SDL_assert( result );
+void SaveGameStorage::CreateSaveGameSnapshot( SaveGameSnapshot& snapshot, bool killSave )
+{
+	// Factions don't have any state to save yet.
+	snapshot.alive = !killSave;
+	g_pGame->GetPlayer()->Snapshot( snapshot );
+	g_pGame->GetBlackboard()->Snapshot( snapshot );
 }
 
 std::filesystem::path SaveGameStorage::GetSaveGameFileName() const
@@ -389,7 +856,7 @@ std::filesystem::path SaveGameStorage::GetSaveGameFileName() const
 std::filesystem::path SaveGameStorage::GetSaveGameFileName( const std::string& captainName, const std::string& shipName ) const
 {
 	std::stringstream ss;
-	ss << captainName << " - " << shipName << ".xml";
+	ss << captainName << " - " << shipName << BinarySaveDocument::GetExtension();
 	std::string filename( ss.str() );
 
 	// These characters aren't supported by the operative system. Having them as part of the filename would
@@ -435,9 +902,9 @@ bool SaveGameStorage::CreateSaveGameFolder( const std::filesystem::path& folder
 	return state;
 }
 
-bool SaveGameStorage::Exists( const std::string& captainName, const std::string& shipName ) const
+bool SaveGameStorage::Exists( const std::string& captainName, const std::string& shipName )
 {
-	while ( IsReady() == false ); // Sorry.
+	WaitForScan();
 
 	for ( auto& pStorageFile : m_StorageFiles )
 	{
@@ -466,7 +933,12 @@ void SaveGameStorage::GetSaveGameHeaders( SaveGameHeaderVector& saveGameHeaders
 
 bool SaveGameStorage::IsReady() const
 {
-	return m_Ready.load();
+	return m_Ready;
+}
+
+int SaveGameStorage::GetGeneration() const
+{
+	return m_Generation;
 }
 
 }
\ No newline at end of file
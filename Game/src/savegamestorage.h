@@ -19,10 +19,19 @@
 
 #include <atomic>
 #include <filesystem>
+#include <list>
+#include <string>
+#include <vector>
+
+#include <xml.h>
+
+#include "savegamebinary.h"
 
 namespace Hyperscape
 {
 
+class Player;
+GENESIS_DECLARE_SMART_PTR( Player );
 class SaveGameHeader;
 using SaveGameHeaderVector = std::vector< std::shared_ptr< SaveGameHeader > >;
 GENESIS_DECLARE_SMART_PTR( SaveGameHeader );
@@ -31,24 +40,35 @@ class SaveGameStorage
 {
 public:
 	SaveGameStorage();
+	~SaveGameStorage();
+	void Refresh(); // Rescans the save games in the background. Only files whose size or modification time changed have their header read again.
+	void Update();
 	void UpdateDebugUI();
-	bool SaveGame( bool killSave = false );
-	bool LoadGame( const std::filesystem::path& filename, tinyxml2::XMLDocument& xmlDoc );
+	void SaveGame( bool killSave = false ); // Snapshots the game state and queues it to be written by the save thread. The outcome is reported once the write completes.
+	bool LoadGame( const std::filesystem::path& filename, PlayerSharedPtr& pPlayer ); // Reads the player from either save format.
 
-	bool Exists( const std::string& captainName, const std::string& shipName ) const;
+	bool Exists( const std::string& captainName, const std::string& shipName );
 	void GetSaveGameHeaders( SaveGameHeaderVector& saveGameHeaders ) const;
 	bool IsReady() const;
+	int GetGeneration() const; // Changes whenever the list of save games does.
 
 private:
 	std::filesystem::path GetSaveGameFileName() const;
 	std::filesystem::path GetSaveGameFileName( const std::string& captainName, const std::string& shipName ) const;
-	static int sXmlReadThreadMain( void* pData );
+	static int sScanThreadMain( void* pData );
+	static int sWriteThreadMain( void* pData );
+	static bool IsSaveGameFile( const std::filesystem::path& filename );
 	bool XmlRead( const std::filesystem::path& filename, tinyxml2::XMLDocument& xmlDoc );
+	bool BinaryRead( const std::filesystem::path& filename, BinarySaveDocument& document );
 	bool CreateSaveGameFolder( const std::filesystem::path& folder );
-	void CreateSaveGameData( tinyxml2::XMLDocument& xmlDoc, bool killSave );
-	bool SaveToLocalStorage( tinyxml2::XMLDocument& xmlDoc, const std::filesystem::path& fullPath );
-	bool SaveToRemoteStorage( tinyxml2::XMLDocument& xmlDoc );
-	void UpdateStorageFiles( const std::filesystem::path& filename, tinyxml2::XMLDocument& xmlDoc );
+	void CreateSaveGameSnapshot( SaveGameSnapshot& snapshot, bool killSave );
+	void WaitForPendingWrite();
+	void WaitForScan();
+	void FinishScan();
+	bool SaveToLocalStorage( const std::vector<uint8_t>& data, const std::filesystem::path& fullPath, std::string& error );
+	bool SaveToRemoteStorage( const std::vector<uint8_t>& data, const std::filesystem::path& filename, std::string& error );
+	void UpdateStorageFiles( const std::filesystem::path& filename, const SaveGameHeader& saveGameHeader );
+	void RemoveStorageFile( const std::filesystem::path& filename );
 
 #if USE_STEAM
 	ISteamRemoteStorage* m_pSteamRemoteStorage;
@@ -57,14 +77,56 @@ private:
 	struct StorageFile
 	{
 		std::filesystem::path filename;
+		std::uintmax_t fileSize = 0;
+		int64_t timestamp = 0;
 		SaveGameHeaderSharedPtr pSaveGameHeader;
 	};
 	using StorageFileList = std::list< std::shared_ptr< StorageFile > >;
+	StorageFileList ListStorageFiles() const;
+	bool ReadHeaderBlock( StorageFile& storageFile );
+
+	// A rescan of the save games. The scan thread reads the header of every file which changed and the main
+	// thread swaps the results in once it has finished. A scan superseded by a later Refresh() is cancelled:
+	// it stops at the next file and its results are dropped, so Refresh() never has to wait for it.
+	struct Scan
+	{
+		SaveGameStorage* pSaveGameStorage = nullptr;
+		StorageFileList storageFiles;
+		SDL_Thread* pThread = nullptr;
+		std::atomic_bool cancelled{ false };
+		std::atomic_bool finished{ false };
+		int headersReadFromBlock = 0;
+	};
+	using ScanUniquePtr = std::unique_ptr<Scan>;
+
 	StorageFileList m_StorageFiles;
 	bool m_DebugWindowOpen;
 	bool m_CloudStorageActive;
-	SDL_Thread*	m_pXmlReadThread;
-	std::atomic_bool m_Ready;
+	ScanUniquePtr m_pScan;
+	std::list<ScanUniquePtr> m_CancelledScans;
+	bool m_Ready;
+	int m_Generation;
+	int m_HeadersReused;
+	int m_HeadersReadFromBlock;
+
+	// A save which has been snapshotted on the main thread and is being serialised by the save thread.
+	// Nothing but the save thread touches it until m_WriteFinished is set. Steam isn't called from the
+	// save thread, so remote saves are only serialised there and written once the main thread picks them up.
+	struct PendingWrite
+	{
+		BinarySaveDocumentUniquePtr pDocument;
+		SaveGameHeaderSharedPtr pSaveGameHeader;
+		std::filesystem::path filename;
+		std::filesystem::path fullPath;			// Empty when saving to remote storage.
+		std::filesystem::path legacyFilename;	// XML save for the same captain and ship, superseded by this one.
+		std::vector<uint8_t> data;				// Serialised save, kept for remote storage.
+		bool serialised;
+		bool success;
+		std::string error;
+	};
+	std::unique_ptr<PendingWrite> m_pPendingWrite;
+	SDL_Thread* m_pWriteThread;
+	std::atomic_bool m_WriteFinished;
 };
 
 }
\ No newline at end of file
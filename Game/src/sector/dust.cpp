@@ -26,6 +26,7 @@
 #include <shaderuniform.h>
 #include <vertexbuffer.h>
 #include "dust.h"
+#include "misc/random.h"
 
 namespace Hyperscape
 {
@@ -45,9 +46,9 @@ Dust::Dust()
 	DustParticle particle;
 	for ( int i = 0; i < 256; ++i )
 	{
-		particle.x = (float)(rand() % 1000) / 1000.0f * 1200.0f - 600.0f;
-		particle.y = (float)(rand() % 1000) / 1000.0f * 1200.0f - 600.0f;
-		particle.z = (float)(rand() % 1000) / 1000.0f * 160.0f;
+		particle.x = Random::Next( -600.0f, 600.0f );
+		particle.y = Random::Next( -600.0f, 600.0f );
+		particle.z = Random::Next( 160.0f );
 		m_dustParticles.push_back( particle );
 	}
 }
@@ -92,8 +93,8 @@ void Dust::Render( const Genesis::SceneCameraSharedPtr& pCamera )
 	
 	const glm::vec2 size( 3.0f, 1.0f );
 	size_t numVertices = m_dustParticles.size() * 6;
-	PositionData posData;
-	UVData uvData;
+	FramePositionData posData( &FrameArena::Get() );
+	FrameUVData uvData( &FrameArena::Get() );
 	posData.reserve( numVertices );
 	uvData.reserve( numVertices );
 
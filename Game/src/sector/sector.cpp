@@ -20,7 +20,7 @@
 #include "achievements.h"
 #include "ammo/ammomanager.h"
 #include "entity/component.hpp"
-#include "entity/componentfactory.hpp"
+#include "entity/components/playercontrollercomponent.hpp"
 #include "entity/components/shipdetailscomponent.hpp"
 #include "entity/components/transformcomponent.hpp"
 #include "entity/entity.hpp"
@@ -35,6 +35,7 @@
 #include "menus/intelwindow.h"
 #include "menus/lootwindow.h"
 #include "menus/shiptweaks.h"
+#include "misc/random.h"
 #include "muzzleflash/muzzleflashmanager.h"
 #include "muzzleflash/muzzleflashmanagerrep.h"
 #include "particles/particlemanager.h"
@@ -116,6 +117,8 @@ Sector::Sector( System* pSystem, const glm::vec2& coordinates )
     g_pGame->SetCursorType( CursorType::Crosshair );
 
     m_pShipTweaks = std::make_unique<ShipTweaks>();
+    m_pAIScheduler = std::make_unique<AIScheduler>();
+    m_pNavigationField = std::make_unique<NavigationField>();
 
     m_pSidebarWindow = UI2::OpenWindow<SidebarWindow>();
 }
@@ -127,6 +130,12 @@ Sector::~Sector()
     delete m_pHyperspaceMenu;
     delete m_pDeathMenu;
     delete m_pLootWindow;
+
+    // The trail manager is deleted here rather than by its layer, so it must not stay registered.
+    if ( Genesis::FrameWork::GetScene() != nullptr )
+    {
+        Genesis::FrameWork::GetScene()->Unregister( m_pTrailManager );
+    }
     delete m_pTrailManager;
 
     if ( m_pParticleManager != nullptr )
@@ -165,8 +174,11 @@ bool Sector::Initialize()
 
     m_pPlayerFleetCamera = Genesis::FrameWork::GetScene()->GetCamera();
 
+    // Every trail looks the managers up when it is added to the scene, so they are registered
+    // rather than searched for.
     m_pTrailManager = new TrailManager();
     m_pSystem->GetLayer( LayerId::Ships )->AddSceneObject( m_pTrailManager );
+    Genesis::FrameWork::GetScene()->Register( m_pTrailManager );
     m_pTrailManagerRep = new TrailManagerRep( m_pTrailManager );
     m_pSystem->GetLayer( LayerId::Ships )->AddSceneObject( m_pTrailManagerRep );
 
@@ -194,6 +206,7 @@ bool Sector::Initialize()
 
     m_pSpriteManager = new SpriteManager();
     m_pSystem->GetLayer( LayerId::Ships )->AddSceneObject( m_pSpriteManager );
+    Genesis::FrameWork::GetScene()->Register( m_pSpriteManager );
 
     DamageTrackerDebugWindow::Register();
 
@@ -218,16 +231,14 @@ void Sector::CreatePlayerFleet()
 {
     m_pPlayerFleet = std::make_shared<Fleet>();
     m_pPlayerShip = CreateShip( "phaeton", "Obsidian Sword", glm::vec3( 0.0f, 0.0f, 0.0f ), m_pPlayerFleet );
-    m_pPlayerShip->AddComponent( ComponentFactory::Get()->Create( ComponentType::PlayerControllerComponent ) );
-    CreateShip( "dagger", "Absence of Gravitas", glm::vec3( 20.0f, 20.0f, -10.0f ), m_pPlayerFleet );
-    CreateShip( "dagger", "Gardenia", glm::vec3( 50.0f, -15.0f, -5.0f ), m_pPlayerFleet );
+    m_pPlayerShip->AddComponent<PlayerControllerComponent>();
+    CreateShips( "dagger", { { "Absence of Gravitas", glm::vec3( 20.0f, 20.0f, -10.0f ) }, { "Gardenia", glm::vec3( 50.0f, -15.0f, -5.0f ) } }, m_pPlayerFleet );
 }
 
 void Sector::CreateOtherFleet()
 {
     m_pOtherFleet = std::make_shared<Fleet>();
-    CreateShip( "dagger", "Red Claw Hunter", glm::vec3( 0.0f, 0.0f, 1000.0f ), m_pOtherFleet );
-    CreateShip( "dagger", "Red Claw Hunter", glm::vec3( 20.0f, 20.0f, 1000.0f - 10.0f ), m_pOtherFleet );
+    CreateShips( "dagger", { { "Red Claw Hunter", glm::vec3( 0.0f, 0.0f, 1000.0f ) }, { "Red Claw Hunter", glm::vec3( 20.0f, 20.0f, 1000.0f - 10.0f ) } }, m_pOtherFleet );
 }
 
 void Sector::CreateOtherFleetViewport()
@@ -240,26 +251,34 @@ void Sector::CreateOtherFleetViewport()
 }
 
 EntitySharedPtr Sector::CreateShip( const std::string& templateName, const std::string& shipName, const glm::vec3& position, FleetSharedPtr& pFleet )
+{
+    std::vector<EntitySharedPtr> ships = CreateShips( templateName, { { shipName, position } }, pFleet );
+    return ships.empty() ? nullptr : ships.front();
+}
+
+// Ships sharing a template are created as a batch, so the component pools only grow once.
+std::vector<EntitySharedPtr> Sector::CreateShips( const std::string& templateName, const std::vector<ShipSpawn>& spawns, FleetSharedPtr& pFleet )
 {
     SDL_assert( pFleet );
-    EntitySharedPtr pShipEntity = EntityFactory::Get()->Create( templateName );
-    if ( pShipEntity )
+    std::vector<EntitySharedPtr> shipEntities = EntityFactory::Get()->Create( templateName, spawns.size() );
+    if ( shipEntities.size() != spawns.size() )
     {
+        Genesis::Log::Error() << "Failed to create ship based on template '" << templateName << "'.";
+        return {};
+    }
+
+    for ( size_t i = 0; i < spawns.size(); ++i )
+    {
+        EntitySharedPtr& pShipEntity = shipEntities[ i ];
         m_pSystem->GetLayer( LayerId::Ships )->AddSceneObject( pShipEntity.get(), false );
         m_Entities.push_back( pShipEntity );
         pFleet->AddShip( pShipEntity );
-        pShipEntity->GetComponent<TransformComponent>()->SetTransform( glm::translate( position ) );
-
-        pShipEntity->AddComponent( ComponentFactory::Get()->Create( ComponentType::ShipDetailsComponent ) );
-        pShipEntity->GetComponent<ShipDetailsComponent>()->SetShipName( shipName );
+        pShipEntity->GetComponent<TransformComponent>()->SetTransform( glm::translate( spawns[ i ].position ) );
 
-        return pShipEntity;
-    }
-    else
-    {
-        Genesis::Log::Error() << "Failed to create ship based on template '" << templateName << "'.";
-        return nullptr;
+        pShipEntity->AddComponent<ShipDetailsComponent>()->SetShipName( spawns[ i ].name );
     }
+
+    return shipEntities;
 }
 
 void Sector::SelectPlaylist()
@@ -291,6 +310,9 @@ void Sector::Update( float delta )
 #endif
 
     m_pLootWindow->Update( delta );
+    m_pAIScheduler->Update( delta );
+
+    m_pNavigationField->Update( delta );
 
     // Draw axis.
     static bool sDrawAxis = false;
@@ -357,6 +379,7 @@ void Sector::DeleteRemovedShips()
     {
         m_pSystem->GetLayer( LayerId::Ships )->RemoveSceneObject( pShip );
         m_ShipList.remove( pShip );
+        m_pNavigationField->RemoveShip( pShip );
     }
 
     m_ShipsToRemove.clear();
@@ -422,7 +445,7 @@ bool Sector::GetFleetSpawnPosition( Faction* pFleetFaction, float& x, float& y )
     }
     else
     {
-        int idx = rand() % m_AvailableSpawnPoints.size();
+        int idx = static_cast<int>( Random::Next( static_cast<uint32_t>( m_AvailableSpawnPoints.size() ) ) );
         int selectedSpawnPoint = m_AvailableSpawnPoints[ idx ];
         m_AvailableSpawnPoints.erase( m_AvailableSpawnPoints.begin() + idx );
 
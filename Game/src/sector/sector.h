@@ -18,6 +18,8 @@
 #pragma once
 
 #include "faction/faction.h"
+#include "ship/controller/aischeduler.h"
+#include "ship/controller/navigationfield.h"
 #include "ship/moduleinfo.h"
 #include "ship/ship.fwd.h"
 
@@ -85,6 +87,8 @@ public:
     MuzzleflashManager* GetMuzzleflashManager() const;
     const ShipList& GetShipList() const;
     ShipTweaks* GetShipTweaks() const;
+    AIScheduler* GetAIScheduler() const;
+    NavigationField* GetNavigationField() const;
     const glm::vec2& GetCoordinates() const;
     Entity* GetPlayerShip() const;
 
@@ -105,7 +109,13 @@ private:
     void DebugDrawFleetSpawnPositions();
     void SelectPlaylist();
 
+    struct ShipSpawn
+    {
+        std::string name;
+        glm::vec3 position;
+    };
     EntitySharedPtr CreateShip( const std::string& templateName, const std::string& shipName, const glm::vec3& position, FleetSharedPtr& pFleet );
+    std::vector<EntitySharedPtr> CreateShips( const std::string& templateName, const std::vector<ShipSpawn>& spawns, FleetSharedPtr& pFleet );
 
     System* m_pSystem;
     glm::vec2 m_Coordinates;
@@ -144,6 +154,8 @@ private:
     unsigned int m_AdditionalWavesSpawned;
 
     ShipTweaksUniquePtr m_pShipTweaks;
+    AISchedulerUniquePtr m_pAIScheduler;
+    NavigationFieldUniquePtr m_pNavigationField;
     std::vector<EntitySharedPtr> m_Entities;
     EntitySharedPtr m_pPlayerShip;
 
@@ -192,6 +204,16 @@ inline ShipTweaks* Sector::GetShipTweaks() const
     return m_pShipTweaks.get();
 }
 
+inline AIScheduler* Sector::GetAIScheduler() const
+{
+    return m_pAIScheduler.get();
+}
+
+inline NavigationField* Sector::GetNavigationField() const
+{
+    return m_pNavigationField.get();
+}
+
 inline const glm::vec2& Sector::GetCoordinates() const
 {
     return m_Coordinates;
@@ -201,14 +201,11 @@ void AddonQuantumStateAlternator::PlaySFX()
 	{
 		using namespace Genesis;
 
-		Sound::SoundInstanceSharedPtr pSoundInstance = FrameWork::GetSoundManager()->CreateSoundInstance( m_pSFX );
-		if ( pSoundInstance != nullptr )
-		{
-			const glm::vec3& worldTranslation = m_pModule->GetWorldPosition();
-			const glm::vec3 position( worldTranslation );
-			pSoundInstance->Set3DAttributes( &position );
-			pSoundInstance->SetMinimumDistance( 300.0f );
-		}
+		Sound::SoundRequest request;
+		request.pResource = m_pSFX;
+		request.position = m_pModule->GetWorldPosition();
+		request.minimumDistance = 300.0f;
+		FrameWork::GetSoundManager()->QueueSound( request );
 	}
 }
 
@@ -187,14 +187,13 @@ void AddonEngineDisruptor::UpdateShockwave( float delta )
 			}
 #endif
 
-			Genesis::Physics::RayTestResultVector rayTestResults;
+			Genesis::Physics::RayTestResultVector rayTestResults( &Genesis::FrameArena::Get() );
 			g_pGame->GetPhysicsSimulation()->RayTest( p1, p2, rayTestResults );
 
 			for ( auto& result : rayTestResults )
 			{
-				// If it's a compound shape, then the ShipCollisionInfo is in the child shape.
-				Genesis::Physics::ShapeSharedPtr pShape = !result.GetChildShape().expired() ? result.GetChildShape().lock() : result.GetShape().lock();
-				ShipCollisionInfo* pCollisionInfo = reinterpret_cast< ShipCollisionInfo* >( pShape->GetUserData() );
+				// If it's a compound shape, then the ShipCollisionInfo is the user data of the child that was hit.
+				ShipCollisionInfo* pCollisionInfo = reinterpret_cast< ShipCollisionInfo* >( result.GetUserData() );
 				if ( pCollisionInfo->GetType() == ShipCollisionType::Module )
 				{
 					pCollisionInfo->GetShip()->DisruptEngines();
@@ -210,14 +209,11 @@ void AddonEngineDisruptor::PlaySFX()
 	{
 		using namespace Genesis;
 
-		Sound::SoundInstanceSharedPtr pSoundInstance = FrameWork::GetSoundManager()->CreateSoundInstance( m_pSFX );
-		if ( pSoundInstance != nullptr )
-		{
-			const glm::vec3& worldTranslation = m_pModule->GetWorldPosition();
-			const glm::vec3 position( worldTranslation );
-			pSoundInstance->Set3DAttributes( &position );
-			pSoundInstance->SetMinimumDistance( 300.0f );
-		}
+		Sound::SoundRequest request;
+		request.pResource = m_pSFX;
+		request.position = m_pModule->GetWorldPosition();
+		request.minimumDistance = 300.0f;
+		FrameWork::GetSoundManager()->QueueSound( request );
 	}
 }
 
@@ -196,7 +196,7 @@ void AddonParticleAccelerator::UpdateLaser( float delta )
 
 void AddonParticleAccelerator::CalculateVectors( glm::vec3& source, glm::vec3& target, glm::vec3& right ) const
 {
-	glm::mat4x4 moduleWorldTransform = m_pOwner->GetRigidBody()->GetWorldTransform();
+	glm::mat4x4 moduleWorldTransform = m_pOwner->GetTransform();
 	glm::vec3 emitterLocalTranslation = m_pModule->GetLocalPosition() + m_EmitterOffset;
 	glm::mat4x4 emitterLocalTransform = glm::translate( emitterLocalTranslation );
 
@@ -222,15 +222,14 @@ float AddonParticleAccelerator::ProcessCollision( bool appliesDamage, float delt
 
 	CalculateVectors( source, target, right );
 	
-	Genesis::Physics::RayTestResultVector rayTestResults;
+	Genesis::Physics::RayTestResultVector rayTestResults( &Genesis::FrameArena::Get() );
 	g_pGame->GetPhysicsSimulation()->RayTest( source, target, rayTestResults );
 	float hitFraction = 1.0f;
 
 	for ( auto& result : rayTestResults )
 	{
-		// If it's a compound shape, then the ShipCollisionInfo is in the child shape.
-		Genesis::Physics::ShapeSharedPtr pShape = !result.GetChildShape().expired() ? result.GetChildShape().lock() : result.GetShape().lock();
-		ShipCollisionInfo* pCollisionInfo = reinterpret_cast< ShipCollisionInfo* >( pShape->GetUserData() );
+		// If it's a compound shape, then the ShipCollisionInfo is the user data of the child that was hit.
+		ShipCollisionInfo* pCollisionInfo = reinterpret_cast< ShipCollisionInfo* >( result.GetUserData() );
 		if ( pCollisionInfo == nullptr || pCollisionInfo->GetShip() == m_pOwner )
 		{
 			continue;
@@ -291,13 +290,11 @@ void AddonParticleAccelerator::PlaySFX()
 	{
 		using namespace Genesis;
 
-		Sound::SoundInstanceSharedPtr pSoundInstance = FrameWork::GetSoundManager()->CreateSoundInstance( m_pSFX );
-		if ( pSoundInstance != nullptr )
-		{
-			const glm::vec3& worldTranslation = m_pModule->GetWorldPosition();
-			pSoundInstance->Set3DAttributes( &worldTranslation );
-			pSoundInstance->SetMinimumDistance( 750.0f );
-		}
+		Sound::SoundRequest request;
+		request.pResource = m_pSFX;
+		request.position = m_pModule->GetWorldPosition();
+		request.minimumDistance = 750.0f;
+		FrameWork::GetSoundManager()->QueueSound( request );
 	}
 }
 
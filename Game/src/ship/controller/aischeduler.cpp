@@ -0,0 +1,153 @@
+// Copyright 2026 Pedro Nunes
+//
+// This file is part of Hyperscape.
+//
+// Hyperscape is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Hyperscape is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Hyperscape. If not, see <http://www.gnu.org/licenses/>.
+
+#include <genesis.h>
+#include <imgui/imgui.h>
+#include <imgui/imgui_impl.h>
+#include <math/misc.h>
+
+#include "ship/controller/aischeduler.h"
+
+namespace Hyperscape
+{
+
+// Minimum time between decisions, in seconds, indexed by [decision][priority].
+static const float sDecisionIntervals[ static_cast<size_t>( AIDecision::Count ) ][ static_cast<size_t>( AIPriority::Count ) ] =
+{
+	{ 6.0f, 4.0f, 2.5f, 1.0f },		// Retarget
+	{ 0.5f, 0.25f, 0.1f, 0.05f },	// Navigation
+	{ 0.5f, 0.2f, 0.05f, 0.0f }		// FireControl
+};
+
+// How much of the frame's budget each decision takes. Retargeting goes through every ship
+// in the sector and navigation can need up to two ray tests, while a firing solution is fairly cheap.
+static const int sDecisionCosts[ static_cast<size_t>( AIDecision::Count ) ] = { 4, 2, 1 };
+
+// Requests which have waited for this many times their interval (or at least the minimum deadline)
+// are granted even if over budget. A decision which has never been made is always overdue.
+static const float sDeadlineMultiplier = 4.0f;
+static const float sMinimumDeadline = 0.2f;
+
+static const int sDefaultBudget = 64;
+
+AIScheduler::AIScheduler() :
+m_Budget( sDefaultBudget ),
+m_CriticalReserve( 0 ),
+m_CurrentFrame{},
+m_LastFrame{},
+m_HistoryIndex( 0 ),
+m_DebugUIOpen( false )
+{
+	m_BudgetHistory.fill( 0.0f );
+	Genesis::ImGuiImpl::RegisterDevMenu( "Sector", "AI scheduler", &m_DebugUIOpen );
+}
+
+AIScheduler::~AIScheduler()
+{
+	Genesis::ImGuiImpl::UnregisterDevMenu( "Sector", "AI scheduler" );
+}
+
+void AIScheduler::Update( float delta )
+{
+	m_LastFrame = m_CurrentFrame;
+	m_CurrentFrame = FrameStats{};
+	m_CriticalReserve = gMin( m_LastFrame.criticalDemand, m_Budget );
+
+	m_BudgetHistory[ m_HistoryIndex ] = static_cast<float>( m_LastFrame.budgetUsed );
+	m_HistoryIndex = ( m_HistoryIndex + 1 ) % sHistorySize;
+
+	UpdateDebugUI();
+}
+
+bool AIScheduler::Request( AIDecision decision, AIPriority priority, float timeSinceLastDecision )
+{
+	const float interval = GetInterval( decision, priority );
+	if ( timeSinceLastDecision < interval )
+	{
+		return false;
+	}
+
+	const int cost = sDecisionCosts[ static_cast<size_t>( decision ) ];
+	const bool critical = ( priority == AIPriority::Critical );
+	if ( critical )
+	{
+		m_CurrentFrame.criticalDemand += cost;
+	}
+
+	// Whatever is left of the critical reserve can't be used by lower priority requests.
+	const int reserved = critical ? 0 : gMax( 0, m_CriticalReserve - m_CurrentFrame.criticalUsed );
+	const bool withinBudget = ( m_CurrentFrame.budgetUsed + cost + reserved <= m_Budget );
+	const bool forced = ( timeSinceLastDecision >= gMax( interval * sDeadlineMultiplier, sMinimumDeadline ) );
+	if ( withinBudget == false && forced == false )
+	{
+		m_CurrentFrame.deferred++;
+		return false;
+	}
+
+	if ( withinBudget == false )
+	{
+		m_CurrentFrame.forced++;
+	}
+
+	m_CurrentFrame.budgetUsed += cost;
+	if ( critical )
+	{
+		m_CurrentFrame.criticalUsed += cost;
+	}
+	m_CurrentFrame.decisions[ static_cast<size_t>( decision ) ]++;
+	return true;
+}
+
+float AIScheduler::GetInterval( AIDecision decision, AIPriority priority ) const
+{
+	return sDecisionIntervals[ static_cast<size_t>( decision ) ][ static_cast<size_t>( priority ) ];
+}
+
+void AIScheduler::UpdateDebugUI()
+{
+#ifndef _FINAL
+	if ( m_DebugUIOpen )
+	{
+		ImGui::SetNextWindowSize( ImVec2( 400.0f, 300.0f ) );
+		ImGui::Begin( "AI scheduler", &m_DebugUIOpen );
+
+		ImGui::SliderInt( "Budget per frame", &m_Budget, 4, 256 );
+		ImGui::PlotHistogram( "Budget used", m_BudgetHistory.data(), static_cast<int>( sHistorySize ), static_cast<int>( m_HistoryIndex ), nullptr, 0.0f, static_cast<float>( m_Budget ), ImVec2( 0.0f, 80.0f ) );
+
+		ImGui::Columns( 2 );
+		ImGui::Text( "Budget used" ); ImGui::NextColumn();
+		ImGui::Text( "%d / %d", m_LastFrame.budgetUsed, m_Budget ); ImGui::NextColumn();
+		ImGui::Text( "Deferred" ); ImGui::NextColumn();
+		ImGui::Text( "%d", m_LastFrame.deferred ); ImGui::NextColumn();
+		ImGui::Text( "Over budget" ); ImGui::NextColumn();
+		ImGui::Text( "%d", m_LastFrame.forced ); ImGui::NextColumn();
+		ImGui::Text( "Critical" ); ImGui::NextColumn();
+		ImGui::Text( "%d (%d reserved)", m_LastFrame.criticalUsed, m_CriticalReserve ); ImGui::NextColumn();
+		ImGui::Text( "Retarget" ); ImGui::NextColumn();
+		ImGui::Text( "%d", m_LastFrame.decisions[ static_cast<size_t>( AIDecision::Retarget ) ] ); ImGui::NextColumn();
+		ImGui::Text( "Navigation" ); ImGui::NextColumn();
+		ImGui::Text( "%d", m_LastFrame.decisions[ static_cast<size_t>( AIDecision::Navigation ) ] ); ImGui::NextColumn();
+		ImGui::Text( "Fire control" ); ImGui::NextColumn();
+		ImGui::Text( "%d", m_LastFrame.decisions[ static_cast<size_t>( AIDecision::FireControl ) ] ); ImGui::NextColumn();
+		ImGui::Columns( 1 );
+
+		ImGui::End();
+	}
+#endif
+}
+
+}
@@ -0,0 +1,126 @@
+// Copyright 2026 Pedro Nunes
+//
+// This file is part of Hyperscape.
+//
+// Hyperscape is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Hyperscape is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Hyperscape. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <array>
+#include <memory>
+
+namespace Hyperscape
+{
+
+class AIScheduler;
+using AISchedulerUniquePtr = std::unique_ptr<AIScheduler>;
+
+// The expensive decisions an AI controller can make. Anything not listed here
+// (such as steering towards an already decided goal) is cheap enough to run every frame.
+enum class AIDecision
+{
+	Retarget,		// Looking for the closest hostile ship.
+	Navigation,		// Obstacle checks through the navigation feelers.
+	FireControl,	// Firing solutions for every weapon.
+
+	Count
+};
+
+// How important a ship currently is, which determines how often it gets to make decisions.
+enum class AIPriority
+{
+	Low,			// Far away from the player and not engaged.
+	Medium,
+	High,			// Engaged with a target or close to the player.
+	Critical,		// Recently damaged. Critical requests have part of the budget reserved for them.
+
+	Count
+};
+
+
+///////////////////////////////////////////////////////////////////////////////
+// AIScheduler
+// Spreads the AI controllers' expensive decisions across frames. Each decision
+// has a minimum interval depending on the ship's priority and a cost which is
+// taken from a per-frame budget. Requests which don't fit in the budget are
+// deferred to a later frame, unless they have been waiting for too long.
+// Critical requests count against the budget like any other, but they jump
+// the queue: as much of the budget as they needed in the previous frame is
+// kept aside for them, so lower priority requests can't use it up first.
+///////////////////////////////////////////////////////////////////////////////
+
+class AIScheduler
+{
+public:
+					AIScheduler();
+					~AIScheduler();
+
+	// Starts a new frame, resetting the budget.
+	void			Update( float delta );
+
+	// Returns true if the decision can be made this frame. If so, the caller is
+	// expected to make it and reset its time since the last decision.
+	bool			Request( AIDecision decision, AIPriority priority, float timeSinceLastDecision );
+
+	float			GetInterval( AIDecision decision, AIPriority priority ) const;
+	int				GetBudget() const;
+	int				GetBudgetUsed() const;		// Budget used in the last complete frame.
+	int				GetDeferred() const;		// Requests deferred in the last complete frame.
+	int				GetForced() const;			// Requests granted over budget in the last complete frame.
+
+private:
+	struct FrameStats
+	{
+		int budgetUsed;
+		int deferred;
+		int forced;
+		int criticalUsed;
+		int criticalDemand;		// Cost of all the critical requests which were due, whether granted or not.
+		std::array<int, static_cast<size_t>( AIDecision::Count )> decisions;
+	};
+
+	void			UpdateDebugUI();
+
+	int				m_Budget;
+	int				m_CriticalReserve;
+	FrameStats		m_CurrentFrame;
+	FrameStats		m_LastFrame;
+
+	static const size_t sHistorySize = 120;
+	std::array<float, sHistorySize> m_BudgetHistory;
+	size_t			m_HistoryIndex;
+	bool			m_DebugUIOpen;
+};
+
+inline int AIScheduler::GetBudget() const
+{
+	return m_Budget;
+}
+
+inline int AIScheduler::GetBudgetUsed() const
+{
+	return m_LastFrame.budgetUsed;
+}
+
+inline int AIScheduler::GetDeferred() const
+{
+	return m_LastFrame.deferred;
+}
+
+inline int AIScheduler::GetForced() const
+{
+	return m_LastFrame.forced;
+}
+
+}
@@ -26,35 +26,61 @@
 
 #include "game.hpp"
 #include "menus/shiptweaks.h"
+#include "misc/random.h"
+#include "ship/damagetracker.h"
 #include "ship/ship.h"
 #include "ship/hyperspacecore.h"
 #include "sector/sector.h"
 #include "player.h"
 
 #include "ship/controller/controllerai.h"
+#include "ship/controller/navigationfield.h"
 
 namespace Hyperscape
 {
 
+// For how long a ship is considered to be under fire after taking damage.
+static const float sRecentDamageDuration = 3.0f;
+
+// Distances to the player's ship which affect the ship's decision priority.
+static const float sHighPriorityDistance = 1500.0f;
+static const float sMediumPriorityDistance = 4000.0f;
+
 ControllerAI::ControllerAI( Ship* pShip ): Controller( pShip ),
 m_pTargetShip( nullptr ),
-m_TargetTimer( 0.0f ),
 m_AccuracyTimer( 0.0f ),
 m_MinimumWeaponRange( FLT_MAX ),
 m_PowerToAddons( false ),
 m_HasWeapons( false ),
 m_PatrolTimer( 0.0f ),
-m_AlternatorTimer( 5.0f )
+m_AlternatorTimer( 5.0f ),
+m_Priority( AIPriority::Medium ),
+m_RecentDamageTimer( 0.0f ),
+m_LastTotalDamage( 0.0f ),
+m_FeelerCollision( false ),
+m_PreviousHeading( 0.0f ),
+m_DecidedHeading( 0.0f ),
+m_HasDecidedHeading( false )
 {
     // We just give a random patrol point at the start, with additional patrol points being
     // generated once we reach the first one.
     GenerateNextPatrolPoint();
 
 	ResetAlternatorTimer();
+
+	// A decision which has never been made is overdue, so a new ship gets its first decisions
+	// (such as acquiring a target) on its first update regardless of the budget.
+	m_TimeSinceDecision.fill( FLT_MAX );
 }
 
 void ControllerAI::Update( float delta )
 {
+	for ( float& timeSinceDecision : m_TimeSinceDecision )
+	{
+		timeSinceDecision += delta;
+	}
+
+	UpdatePriority( delta );
 	ManageAddons( delta );
 	AcquireTarget( delta );
 	FireControl();
@@ -84,7 +110,7 @@ void ControllerAI::Update( float delta )
 void ControllerAI::ResetAlternatorTimer()
 {
 	// Between 5 and 10s.
-	m_AlternatorTimer = static_cast< float >( 5000 + rand() % 5000 ) / 1000.0f;
+	m_AlternatorTimer = Random::Next( 5.0f, 10.0f );
 }
 
 void ControllerAI::HandleOrders( float delta )
@@ -92,17 +118,133 @@ void ControllerAI::HandleOrders( float delta )
 
 }
 
-// Tries to acquire the closest hostile target. It checks if there is a closer ship every couple of seconds.
-void ControllerAI::AcquireTarget( float delta )
+void ControllerAI::UpdatePriority( float delta )
 {
-	m_TargetTimer -= delta;
+	// Ships which are being shot at need to react quickly.
+	DamageTracker* pDamageTracker = GetShip()->GetDamageTracker();
+	if ( pDamageTracker != nullptr )
+	{
+		const float totalDamage = pDamageTracker->GetTotalDamage();
+		if ( totalDamage > m_LastTotalDamage )
+		{
+			m_LastTotalDamage = totalDamage;
+			m_RecentDamageTimer = sRecentDamageDuration;
+		}
+	}
 
-	if ( m_pTargetShip != nullptr && 
-		 m_pTargetShip->IsTerminating() == false &&
-		 m_pTargetShip->IsDestroyed() == false && 
-		 m_TargetTimer > 0.0f )
+	m_RecentDamageTimer = gMax( 0.0f, m_RecentDamageTimer - delta );
+	if ( m_RecentDamageTimer > 0.0f )
+	{
+		m_Priority = AIPriority::Critical;
 		return;
+	}
 
+	float distanceToPlayer = FLT_MAX;
+	Ship* pPlayerShip = g_pGame->GetPlayer()->GetShip();
+	if ( pPlayerShip != nullptr )
+	{
+		distanceToPlayer = glm::distance( GetShip()->GetTowerPosition(), pPlayerShip->GetTowerPosition() );
+	}
+
+	bool engaged = false;
+	if ( m_pTargetShip != nullptr && m_HasWeapons && m_MinimumWeaponRange < FLT_MAX )
+	{
+		engaged = glm::distance( GetShip()->GetTowerPosition(), m_pTargetShip->GetTowerPosition() ) < m_MinimumWeaponRange * 1.5f;
+	}
+
+	if ( engaged || distanceToPlayer < sHighPriorityDistance )
+	{
+		m_Priority = AIPriority::High;
+	}
+	else if ( m_pTargetShip != nullptr || distanceToPlayer < sMediumPriorityDistance )
+	{
+		m_Priority = AIPriority::Medium;
+	}
+	else
+	{
+		m_Priority = AIPriority::Low;
+	}
+}
+
+// Wraps an angle in radians to [-pi, pi].
+static float WrapAngle( float angle )
+{
+	angle = fmodf( angle, Genesis::kPi * 2.0f );
+	if ( angle > Genesis::kPi )
+	{
+		angle -= Genesis::kPi * 2.0f;
+	}
+	else if ( angle < -Genesis::kPi )
+	{
+		angle += Genesis::kPi * 2.0f;
+	}
+	return angle;
+}
+
+// Interpolates between two angles in radians, going the shortest way around.
+static float LerpAngle( float from, float to, float t )
+{
+	return WrapAngle( from + WrapAngle( to - from ) * t );
+}
+
+// Asks the sector's scheduler whether this decision can be made in this frame.
+bool ControllerAI::RequestDecision( AIDecision decision )
+{
+	return RequestDecision( decision, m_Priority );
+}
+
+bool ControllerAI::RequestDecision( AIDecision decision, AIPriority priority )
+{
+	float& timeSinceDecision = m_TimeSinceDecision[ static_cast<size_t>( decision ) ];
+	Sector* pSector = g_pGame->GetCurrentSector();
+	if ( pSector == nullptr || pSector->GetAIScheduler()->Request( decision, priority, timeSinceDecision ) )
+	{
+		// After the first decision, the next one is staggered so ships which were spawned together
+		// don't keep making their decisions in the same frame.
+		if ( timeSinceDecision == FLT_MAX && pSector != nullptr )
+		{
+			timeSinceDecision = -gRand( 0.0f, 0.5f ) * pSector->GetAIScheduler()->GetInterval( decision, priority );
+		}
+		else
+		{
+			timeSinceDecision = 0.0f;
+		}
+		return true;
+	}
+	else
+	{
+		return false;
+	}
+}
+
+// How far the steering is from the previous heading into the one from the last navigation decision.
+float ControllerAI::GetNavigationBlend() const
+{
+	Sector* pSector = g_pGame->GetCurrentSector();
+	const float interval = ( pSector == nullptr ) ? 0.0f : pSector->GetAIScheduler()->GetInterval( AIDecision::Navigation, m_Priority );
+	const float timeSinceDecision = m_TimeSinceDecision[ static_cast<size_t>( AIDecision::Navigation ) ];
+	if ( interval <= 0.0f || timeSinceDecision >= interval )
+	{
+		return 1.0f;
+	}
+	return gMax( 0.0f, timeSinceDecision / interval );
+}
+
+// Tries to acquire the closest hostile target. How often it checks if there is a closer ship depends on
+// the ship's priority, but a ship which has lost its target will look for a new one as soon as possible.
+void ControllerAI::AcquireTarget( float delta )
+{
+	const bool hasValidTarget = ( m_pTargetShip != nullptr && m_pTargetShip->IsTerminating() == false && m_pTargetShip->IsDestroyed() == false );
+	if ( RequestDecision( AIDecision::Retarget, hasValidTarget ? m_Priority : AIPriority::Critical ) == false )
+	{
+		if ( hasValidTarget == false )
+		{
+			m_pTargetShip = nullptr;
+		}
+		return;
+	}
+
+	Ship* pPreviousTargetShip = m_pTargetShip;
 	m_pTargetShip = nullptr;
 
 	float minDistance = FLT_MAX;
@@ -125,7 +267,15 @@ void ControllerAI::AcquireTarget( float delta )
 		}
 	}
 
-	m_TargetTimer = gRand( 3.5f, 5.0f );
+	// Any firing solutions we have are for the previous target, so a new one is needed as soon as possible.
+	if ( m_pTargetShip != pPreviousTargetShip )
+	{
+		for ( FiringSolution& solution : m_FiringSolutions )
+		{
+			solution.valid = false;
+		}
+		m_TimeSinceDecision[ static_cast<size_t>( AIDecision::FireControl ) ] = FLT_MAX;
+	}
 }
 
 void ControllerAI::FireControl()
@@ -150,8 +300,21 @@ void ControllerAI::FireControl()
 		}
 	}
 
-	for ( auto& pWeaponModule : GetShip()->GetWeaponModules() )
+	const WeaponModuleList& weaponModules = GetShip()->GetWeaponModules();
+	if ( m_FiringSolutions.size() != weaponModules.size() )
+	{
+		m_FiringSolutions.assign( weaponModules.size(), FiringSolution{ false, glm::vec2( 0.0f ) } );
+	}
+
+	if ( GetTargetShip() != nullptr && RequestDecision( AIDecision::FireControl ) )
+	{
+		SolveFireControl();
+	}
+
+	size_t weaponIndex = 0;
+	for ( auto& pWeaponModule : weaponModules )
 	{
+		const FiringSolution& solution = m_FiringSolutions[ weaponIndex++ ];
 		Weapon* pWeapon = pWeaponModule->GetWeapon();
 		if ( pWeapon == nullptr )
 		{
@@ -186,15 +349,14 @@ void ControllerAI::FireControl()
 
 			//g_pGame->GetDebugRender()->DrawLine( pWeapon->GetWorldTransform().getTranslation(), GetTargetShip()->GetTowerPosition(), glm::vec3( 1.0f, 0.0f, 0.0f ) );
 
-			float projectileSpeed = pWeapon->GetInfo()->GetSpeed();
+			if ( solution.valid == false )
+				continue;
 
+			// The lead from the last firing solution is applied to the target's current position, so the
+			// weapons keep tracking the target in the frames between solutions.
 			glm::vec2 targetPosition( GetTargetShip()->GetTowerPosition() );
-			glm::vec2 predictedPosition;
+			glm::vec2 predictedPosition = targetPosition + solution.lead;
 			glm::vec2 weaponPosition( glm::column( pWeapon->GetWorldTransform(), 3 ) );
-			if ( projectileSpeed > 0.0f && PredictTarget( weaponPosition, predictedPosition, projectileSpeed ) == false )
-				continue;
-			else if ( projectileSpeed <= 0.0f )
-				predictedPosition = targetPosition;
 
 			// Slowly move the target back and forth to avoid always having the ships firing with deadly accuracy at the same point
 			glm::vec2 finalTargetPosition;
@@ -235,6 +397,40 @@ void ControllerAI::FireControl()
 	}
 }
 
+// Calculates where each weapon needs to aim to hit the target, relative to the target's current position.
+void ControllerAI::SolveFireControl()
+{
+	const glm::vec2 targetPosition( GetTargetShip()->GetTowerPosition() );
+	size_t weaponIndex = 0;
+	for ( auto& pWeaponModule : GetShip()->GetWeaponModules() )
+	{
+		FiringSolution& solution = m_FiringSolutions[ weaponIndex++ ];
+		solution.valid = false;
+
+		Weapon* pWeapon = pWeaponModule->GetWeapon();
+		if ( pWeapon == nullptr || pWeaponModule->IsDestroyed() )
+		{
+			continue;
+		}
+
+		const float projectileSpeed = pWeapon->GetInfo()->GetSpeed();
+		if ( projectileSpeed <= 0.0f )
+		{
+			solution.valid = true;
+			solution.lead = glm::vec2( 0.0f );
+			continue;
+		}
+
+		glm::vec2 predictedPosition;
+		glm::vec2 weaponPosition( glm::column( pWeapon->GetWorldTransform(), 3 ) );
+		if ( PredictTarget( weaponPosition, predictedPosition, projectileSpeed ) )
+		{
+			solution.valid = true;
+			solution.lead = predictedPosition - targetPosition;
+		}
+	}
+}
+
 bool ControllerAI::PredictTarget( const glm::vec2& src, glm::vec2& result, float projectileSpeed )
 {
 	if ( GetTargetShip() == nullptr )
@@ -386,10 +582,83 @@ bool ControllerAI::MoveToPosition( const glm::vec2& position, float goalRadius,
 		}
 	}
 
-	glm::vec3 forward( glm::column( GetShip()->GetRigidBody()->GetWorldTransform(), 1 ) );
+	glm::vec3 forward( glm::column( GetShip()->GetTransform(), 1 ) );
 	const glm::vec3& shipPosition = GetShip()->GetTowerPosition();
 
-	// Create two feelers in front of the ship to see if the position we are navigating to is blocked
+    const float distanceToGoal = glm::distance( shipPosition, glm::vec3( position, 0.0f ) );
+    const bool goalReached = ( distanceToGoal <= goalRadius );
+	const bool courseCorrection = IsCourseCorrectionRequired( 
+		glm::vec2( forward ),
+		glm::vec2( shipPosition ),
+		position,
+		distanceToGoal );
+
+	// The feelers and the heading are only decided when the scheduler allows it. In-between, the ship
+	// keeps the result of the last feeler check and steers towards a heading blended from the previous
+	// decision into the last one.
+	const float currentHeading = LerpAngle( m_PreviousHeading, m_DecidedHeading, GetNavigationBlend() );
+	if ( RequestDecision( AIDecision::Navigation ) )
+	{
+		m_FeelerCollision = CheckFeelers( forward, shipPosition );
+
+		glm::vec3 targetDirection( position.x, position.y, 0.0f );
+		if ( goalReached && glm::length( orientationAtGoal ) > glm::epsilon<float>() )
+		{
+			targetDirection = glm::vec3( orientationAtGoal, 0.0f );
+		}
+		else
+		{
+			targetDirection = glm::normalize( targetDirection - shipPosition );
+		}
+
+		const float decidedHeading = atan2( targetDirection.y, targetDirection.x );
+		m_PreviousHeading = m_HasDecidedHeading ? currentHeading : decidedHeading;
+		m_DecidedHeading = decidedHeading;
+		m_HasDecidedHeading = true;
+	}
+	const bool feelerCollision = m_FeelerCollision;
+
+    if ( feelerCollision || courseCorrection )
+	{
+		GetShip()->SetThrust( ShipThrust::None );
+	}
+	else
+	{
+        GetShip()->SetThrust( goalReached ? ShipThrust::None : ShipThrust::Forward );
+    }
+
+	// Adjust turning
+	const float heading = LerpAngle( m_PreviousHeading, m_DecidedHeading, GetNavigationBlend() );
+	const float theta = WrapAngle( heading - atan2( forward.y, forward.x ) );
+
+	// Don't bother adjusting angle if we're within a few degrees of our target.
+	// Also, if our angular velocity exceeds theta, then we let the dampers kick in for angular velocity (turn == 0).
+	// Doing this allows us not to overshoot the target.
+	const float threshold = 2.0f * Genesis::kDegToRad;
+	ShipSteer steering = ShipSteer::None;
+	if ( fabsf( glm::length( GetShip()->GetRigidBody()->GetAngularVelocity() ) ) < fabsf( theta ) )
+	{
+		if ( theta > threshold ) 
+		{
+			steering = ShipSteer::Left;
+		}
+		else if ( theta < -threshold )
+		{
+			steering = ShipSteer::Right;
+		}
+	}
+
+	GetShip()->SetSteer( steering );
+
+    return goalReached;
+}
+
+// Create two feelers in front of the ship to see if the position we are navigating to is blocked.
+// The sector's navigation field is sampled along each feeler first, and a ray test is only needed
+// to confirm the hit if the field reports another ship in the way.
+// Returns true if any of the feelers hit another ship.
+bool ControllerAI::CheckFeelers( const glm::vec3& forward, const glm::vec3& shipPosition )
+{
 	// To prevent having the rays intersect the owning ship, we start the rays from the front of the ship
 
 	// Figure out how many slots there are between the logical center of the ship (the tower) and the
@@ -409,22 +678,29 @@ bool ControllerAI::MoveToPosition( const glm::vec2& position, float goalRadius,
 	bool feelerCollision = false;
 
 	Genesis::Physics::Simulation* pSimulation = g_pGame->GetPhysicsSimulation();
+	NavigationField* pNavigationField = g_pGame->GetCurrentSector()->GetNavigationField();
 	const bool drawNavigation = g_pGame->GetCurrentSector()->GetShipTweaks()->GetDrawNavigation();
 	for ( int i = 0; i < 2; ++i )
 	{
 		glm::vec3 feeler( forward.x * cs - forward.y * sn, forward.x * sn + forward.y * cs, 0.0f ); // rotates the feeler from the forward vector
 		feeler = feeler * 70.0f + feelerStartPosition;
 
-		Genesis::Physics::RayTestResultVector rayTestResults;
-		pSimulation->RayTest( feelerStartPosition, feeler, rayTestResults );
-
-		std::size_t numResults = rayTestResults.size();
 		bool hasHit = false;
-		for ( auto& result : rayTestResults )
+		const bool mightHit = pNavigationField->IsSegmentBlocked( glm::vec2( feelerStartPosition ), glm::vec2( feeler ), GetShip() );
+		pNavigationField->RecordRayTest( mightHit );
+		if ( mightHit )
+		{
+			pSimulation->RayTest( feelerStartPosition, feeler, m_RayTestResults );
+		}
+		else
 		{
-			// If it's a compound shape, then the ShipCollisionInfo is in the child shape.
-			Genesis::Physics::ShapeSharedPtr pShape = !result.GetChildShape().expired() ? result.GetChildShape().lock() : result.GetShape().lock();
-			ShipCollisionInfo* pCollisionInfo = reinterpret_cast< ShipCollisionInfo* >( pShape->GetUserData() );
+			m_RayTestResults.clear();
+		}
+
+		for ( auto& result : m_RayTestResults )
+		{
+			// If it's a compound shape, then the ShipCollisionInfo is the user data of the child that was hit.
+			ShipCollisionInfo* pCollisionInfo = reinterpret_cast< ShipCollisionInfo* >( result.GetUserData() );
 			if ( pCollisionInfo->GetType() == ShipCollisionType::Module && pCollisionInfo->GetShip() != GetShip() )
 			{
 				hasHit = true;
@@ -441,64 +717,7 @@ bool ControllerAI::MoveToPosition( const glm::vec2& position, float goalRadius,
 		sn = -sn; // causes the other feeler to the right of the forward vector
 	}
 
-    const float distanceToGoal = glm::distance( shipPosition, glm::vec3( position, 0.0f ) );
-    const bool goalReached = ( distanceToGoal <= goalRadius );
-	const bool courseCorrection = IsCourseCorrectionRequired( 
-		glm::vec2( forward ),
-		glm::vec2( shipPosition ),
-		position,
-		distanceToGoal );
-
-    if ( feelerCollision || courseCorrection )
-	{
-		GetShip()->SetThrust( ShipThrust::None );
-	}
-	else
-	{
-        GetShip()->SetThrust( goalReached ? ShipThrust::None : ShipThrust::Forward );
-    }
-
-	// Adjust turning
-	glm::vec3 targetDirection( position.x, position.y, 0.0f );
-	if ( goalReached && glm::length( orientationAtGoal ) > glm::epsilon<float>() )
-	{
-		targetDirection = glm::vec3( orientationAtGoal, 0.0f );
-	}
-	else
-	{
-		targetDirection = glm::normalize( targetDirection - shipPosition );
-	}
-
-	float theta = atan2( targetDirection.y, targetDirection.x ) - atan2( forward.y, forward.x );
-	if ( theta > Genesis::kPi ) 
-	{
-		theta -= Genesis::kPi * 2.0f;
-	}
-	else if ( theta < -Genesis::kPi )
-	{
-		theta += Genesis::kPi * 2.0f;
-	}
-
-	// Don't bother adjusting angle if we're within a few degrees of our target.
-	// Also, if our angular velocity exceeds theta, then we let the dampers kick in for angular velocity (turn == 0).
-	// Doing this allows us not to overshoot the target.
-	const float threshold = 2.0f * Genesis::kDegToRad;
-	ShipSteer steering = ShipSteer::None;
-	if ( fabsf( glm::length( GetShip()->GetRigidBody()->GetAngularVelocity() ) ) < fabsf( theta ) )
-	{
-		if ( theta > threshold ) 
-		{
-			steering = ShipSteer::Left;
-		}
-		else if ( theta < -threshold )
-		{
-			steering = ShipSteer::Right;
-		}
-	}
-
-	GetShip()->SetSteer( steering );
-
-    return goalReached;
+	return feelerCollision;
 }
 
 bool ControllerAI::IsCourseCorrectionRequired( const glm::vec2& shipForward, const glm::vec2& shipPosition, const glm::vec2& goalPosition, float distanceToGoal ) const
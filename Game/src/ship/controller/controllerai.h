@@ -17,6 +17,15 @@
 
 #pragma once
 
+#include <array>
+#include <vector>
+
+#include <glm/vec2.hpp>
+#include <glm/vec3.hpp>
+
+#include <physics/simulation.h>
+
+#include "ship/controller/aischeduler.h"
 #include "ship/controller/controller.h"
 
 namespace Hyperscape
@@ -27,7 +36,13 @@ class Ship;
 
 ///////////////////////////////////////////////////////////////////////////////
 // ControllerAI
-// Base class for AI controlled ships, implementing shared behaviours
+// Base class for AI controlled ships, implementing shared behaviours.
+// The expensive decisions (retargeting, obstacle checks and firing solutions)
+// are requested from the sector's AIScheduler, with the results of the last
+// decision being reused in the frames in-between. Obstacle checks sample the
+// sector's NavigationField and only ray test when it reports a possible hit.
+// The heading decided by the last navigation check is blended into over the
+// navigation interval, so steering stays smooth however rarely it is decided.
 ///////////////////////////////////////////////////////////////////////////////
 
 class ControllerAI: public Controller
@@ -48,8 +63,20 @@ protected:
 	virtual void	HandleOrders( float delta );
 
 private:
+	struct FiringSolution
+	{
+		bool		valid;
+		glm::vec2	lead;			// Offset from the target's position to the predicted intercept point.
+	};
+
+	void			UpdatePriority( float delta );
+	bool			RequestDecision( AIDecision decision );
+	bool			RequestDecision( AIDecision decision, AIPriority priority );
+	float			GetNavigationBlend() const;
 	void			AcquireTarget( float delta );
 	void			FireControl();
+	void			SolveFireControl();
+	bool			CheckFeelers( const glm::vec3& forward, const glm::vec3& shipPosition );
 	bool			PredictTarget( const glm::vec2& src, glm::vec2& result, float projectileSpeed );
 	void			ManageAddons( float delta );
 	int				SolveQuadratic( float a, float b, float c, float& solA, float& solB ) const;
@@ -58,7 +85,6 @@ private:
 	void			ResetAlternatorTimer();
 
 	Ship*			m_pTargetShip;
-	float			m_TargetTimer;
 	float			m_AccuracyTimer;
 	float			m_MinimumWeaponRange;
 	bool			m_PowerToAddons;		// At times we need to stop fire to get enough energy to use addons
@@ -66,6 +92,17 @@ private:
     float           m_PatrolTimer;
     glm::vec2       m_PatrolPosition;
 	float			m_AlternatorTimer;
+
+	AIPriority		m_Priority;
+	std::array<float, static_cast<size_t>( AIDecision::Count )> m_TimeSinceDecision;
+	float			m_RecentDamageTimer;
+	float			m_LastTotalDamage;
+	bool			m_FeelerCollision;
+	float			m_PreviousHeading;		// Heading being steered towards before the last navigation decision, in radians.
+	float			m_DecidedHeading;		// Heading chosen by the last navigation decision, in radians.
+	bool			m_HasDecidedHeading;
+	Genesis::Physics::RayTestResultVector m_RayTestResults;	// Kept around so the feelers don't allocate on every check.
+	std::vector<FiringSolution> m_FiringSolutions;	// One per weapon module, in the same order as the ship's weapon modules.
 };
 
 inline Ship* ControllerAI::GetTargetShip() const
@@ -0,0 +1,292 @@
+// Copyright 2026 Pedro Nunes
+//
+// This file is part of Hyperscape.
+//
+// Hyperscape is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Hyperscape is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Hyperscape. If not, see <http://www.gnu.org/licenses/>.
+
+#include <algorithm>
+
+#include <genesis.h>
+#include <imgui/imgui.h>
+#include <imgui/imgui_impl.h>
+#include <render/debugrender.h>
+
+#include "game.hpp"
+#include "sector/sector.h"
+#include "ship/module.h"
+#include "ship/ship.h"
+
+#include "ship/controller/navigationfield.h"
+
+namespace Hyperscape
+{
+
+// The field covers the playable area and the boundary surrounding it.
+// Anything outside of the field is considered to be unblocked.
+static const float sFieldExtent = 16000.0f;
+static const float sCellSize = 50.0f;
+
+// Distance between samples when checking a segment. Smaller than a cell so no cell can be skipped.
+static const float sSegmentSampleDistance = sCellSize * 0.5f;
+
+NavigationField::NavigationField() :
+m_Size( static_cast<int>( sFieldExtent / sCellSize ) ),
+m_Restamps( 0 ),
+m_RestampsLastFrame( 0 ),
+m_RayTests( 0 ),
+m_RayTestsLastFrame( 0 ),
+m_RayTestsSkipped( 0 ),
+m_RayTestsSkippedLastFrame( 0 ),
+m_DebugUIOpen( false ),
+m_DebugDraw( false )
+{
+	m_Occupancy.resize( static_cast<size_t>( m_Size * m_Size ), 0 );
+	Genesis::ImGuiImpl::RegisterDevMenu( "Sector", "Navigation field", &m_DebugUIOpen );
+}
+
+NavigationField::~NavigationField()
+{
+	Genesis::ImGuiImpl::UnregisterDevMenu( "Sector", "Navigation field" );
+}
+
+void NavigationField::Update( float delta )
+{
+	m_RestampsLastFrame = m_Restamps;
+	m_RayTestsLastFrame = m_RayTests;
+	m_RayTestsSkippedLastFrame = m_RayTestsSkipped;
+	m_Restamps = 0;
+	m_RayTests = 0;
+	m_RayTestsSkipped = 0;
+
+	for ( Ship* pShip : g_pGame->GetCurrentSector()->GetShipList() )
+	{
+		if ( pShip->GetRigidBody() == nullptr || pShip->GetTowerModule() == nullptr )
+		{
+			continue;
+		}
+
+		const glm::vec2 position( pShip->GetTowerPosition() );
+		glm::vec3 topLeft, bottomRight;
+		pShip->GetBoundingBox( topLeft, bottomRight );
+
+		FootprintMap::iterator it = m_Footprints.find( pShip );
+		Footprint footprint;
+		if ( it == m_Footprints.end() )
+		{
+			ToCell( position, footprint.x, footprint.y );
+			footprint.radius = CalculateFootprintRadius( pShip );
+			Stamp( footprint, 1 );
+			m_Footprints[ pShip ] = TrackedShip{ footprint, position, topLeft, bottomRight };
+			m_Restamps++;
+			continue;
+		}
+
+		TrackedShip& trackedShip = it->second;
+		const bool sizeChanged = ( trackedShip.boundingBoxTopLeft != topLeft || trackedShip.boundingBoxBottomRight != bottomRight );
+		if ( trackedShip.position == position && sizeChanged == false )
+		{
+			continue;
+		}
+
+		ToCell( position, footprint.x, footprint.y );
+		footprint.radius = sizeChanged ? CalculateFootprintRadius( pShip ) : trackedShip.footprint.radius;
+		if ( trackedShip.footprint.x != footprint.x || trackedShip.footprint.y != footprint.y || trackedShip.footprint.radius != footprint.radius )
+		{
+			Stamp( trackedShip.footprint, -1 );
+			Stamp( footprint, 1 );
+			trackedShip.footprint = footprint;
+			m_Restamps++;
+		}
+		trackedShip.position = position;
+		trackedShip.boundingBoxTopLeft = topLeft;
+		trackedShip.boundingBoxBottomRight = bottomRight;
+	}
+
+	UpdateDebugUI();
+	DebugDraw();
+}
+
+void NavigationField::RemoveShip( Ship* pShip )
+{
+	FootprintMap::iterator it = m_Footprints.find( pShip );
+	if ( it != m_Footprints.end() )
+	{
+		Stamp( it->second.footprint, -1 );
+		m_Footprints.erase( it );
+	}
+}
+
+bool NavigationField::IsBlocked( const glm::vec2& position, const Ship* pIgnoreShip ) const
+{
+	int x, y;
+	if ( ToCell( position, x, y ) == false )
+	{
+		return false;
+	}
+
+	int occupancy = m_Occupancy[ y * m_Size + x ];
+	if ( occupancy > 0 && pIgnoreShip != nullptr )
+	{
+		FootprintMap::const_iterator it = m_Footprints.find( pIgnoreShip );
+		if ( it != m_Footprints.cend() && IsInFootprint( it->second.footprint, x, y ) )
+		{
+			occupancy--;
+		}
+	}
+
+	return ( occupancy > 0 );
+}
+
+bool NavigationField::IsSegmentBlocked( const glm::vec2& from, const glm::vec2& to, const Ship* pIgnoreShip ) const
+{
+	const float length = glm::distance( from, to );
+	const int samples = static_cast<int>( length / sSegmentSampleDistance ) + 1;
+	for ( int i = 0; i <= samples; ++i )
+	{
+		const float t = static_cast<float>( i ) / static_cast<float>( samples );
+		if ( IsBlocked( from + ( to - from ) * t, pIgnoreShip ) )
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+void NavigationField::RecordRayTest( bool performed )
+{
+	if ( performed )
+	{
+		m_RayTests++;
+	}
+	else
+	{
+		m_RayTestsSkipped++;
+	}
+}
+
+float NavigationField::GetCellSize() const
+{
+	return sCellSize;
+}
+
+bool NavigationField::ToCell( const glm::vec2& position, int& x, int& y ) const
+{
+	const float halfExtent = sFieldExtent / 2.0f;
+	x = static_cast<int>( floorf( ( position.x + halfExtent ) / sCellSize ) );
+	y = static_cast<int>( floorf( ( position.y + halfExtent ) / sCellSize ) );
+	return ( x >= 0 && x < m_Size && y >= 0 && y < m_Size );
+}
+
+glm::vec2 NavigationField::ToPosition( int x, int y ) const
+{
+	const float halfExtent = sFieldExtent / 2.0f;
+	return glm::vec2( ( static_cast<float>( x ) + 0.5f ) * sCellSize - halfExtent, ( static_cast<float>( y ) + 0.5f ) * sCellSize - halfExtent );
+}
+
+// The footprint is a circle around the ship's tower which encloses the ship's bounding box,
+// so it doesn't need to be restamped when the ship rotates. Returns the radius in cells.
+int NavigationField::CalculateFootprintRadius( Ship* pShip ) const
+{
+	glm::vec3 topLeft, bottomRight;
+	pShip->GetBoundingBox( topLeft, bottomRight );
+	const glm::vec2 towerLocalPosition( pShip->GetTowerModule()->GetLocalPosition() );
+	const float radius = std::max(
+		std::max( glm::distance( towerLocalPosition, glm::vec2( topLeft.x, topLeft.y ) ), glm::distance( towerLocalPosition, glm::vec2( bottomRight.x, topLeft.y ) ) ),
+		std::max( glm::distance( towerLocalPosition, glm::vec2( topLeft.x, bottomRight.y ) ), glm::distance( towerLocalPosition, glm::vec2( bottomRight.x, bottomRight.y ) ) ) ) + sModuleHalfWidth;
+
+	return static_cast<int>( ceilf( radius / sCellSize ) );
+}
+
+void NavigationField::Stamp( const Footprint& footprint, int value )
+{
+	const int x1 = std::max( footprint.x - footprint.radius, 0 );
+	const int x2 = std::min( footprint.x + footprint.radius, m_Size - 1 );
+	const int y1 = std::max( footprint.y - footprint.radius, 0 );
+	const int y2 = std::min( footprint.y + footprint.radius, m_Size - 1 );
+	for ( int y = y1; y <= y2; ++y )
+	{
+		for ( int x = x1; x <= x2; ++x )
+		{
+			if ( IsInFootprint( footprint, x, y ) )
+			{
+				uint16_t& occupancy = m_Occupancy[ y * m_Size + x ];
+				SDL_assert( value > 0 || occupancy > 0 );
+				occupancy = static_cast<uint16_t>( occupancy + value );
+			}
+		}
+	}
+}
+
+bool NavigationField::IsInFootprint( const Footprint& footprint, int x, int y ) const
+{
+	const int dx = x - footprint.x;
+	const int dy = y - footprint.y;
+	return ( dx * dx + dy * dy <= footprint.radius * footprint.radius );
+}
+
+void NavigationField::UpdateDebugUI()
+{
+#ifndef _FINAL
+	if ( m_DebugUIOpen )
+	{
+		ImGui::SetNextWindowSize( ImVec2( 400.0f, 200.0f ) );
+		ImGui::Begin( "Navigation field", &m_DebugUIOpen );
+
+		ImGui::Checkbox( "Draw occupied cells", &m_DebugDraw );
+
+		ImGui::Columns( 2 );
+		ImGui::Text( "Grid" ); ImGui::NextColumn();
+		ImGui::Text( "%d x %d, %.0f per cell", m_Size, m_Size, sCellSize ); ImGui::NextColumn();
+		ImGui::Text( "Tracked ships" ); ImGui::NextColumn();
+		ImGui::Text( "%d", static_cast<int>( m_Footprints.size() ) ); ImGui::NextColumn();
+		ImGui::Text( "Restamps" ); ImGui::NextColumn();
+		ImGui::Text( "%d", m_RestampsLastFrame ); ImGui::NextColumn();
+		ImGui::Text( "Ray tests" ); ImGui::NextColumn();
+		ImGui::Text( "%d", m_RayTestsLastFrame ); ImGui::NextColumn();
+		ImGui::Text( "Ray tests skipped" ); ImGui::NextColumn();
+		ImGui::Text( "%d", m_RayTestsSkippedLastFrame ); ImGui::NextColumn();
+		ImGui::Columns( 1 );
+
+		ImGui::End();
+	}
+#endif
+}
+
+void NavigationField::DebugDraw() const
+{
+#ifndef _FINAL
+	if ( m_DebugDraw == false )
+	{
+		return;
+	}
+
+	const float halfCellSize = sCellSize / 2.0f;
+	const glm::vec3 colour( 1.0f, 0.5f, 0.0f );
+	Genesis::Render::DebugRender* pDebugRender = Genesis::FrameWork::GetDebugRender();
+	for ( int y = 0; y < m_Size; ++y )
+	{
+		for ( int x = 0; x < m_Size; ++x )
+		{
+			if ( m_Occupancy[ y * m_Size + x ] > 0 )
+			{
+				const glm::vec2 centre = ToPosition( x, y );
+				pDebugRender->DrawLine( centre + glm::vec2( -halfCellSize, -halfCellSize ), centre + glm::vec2( halfCellSize, halfCellSize ), colour );
+				pDebugRender->DrawLine( centre + glm::vec2( -halfCellSize, halfCellSize ), centre + glm::vec2( halfCellSize, -halfCellSize ), colour );
+			}
+		}
+	}
+#endif
+}
+
+}
@@ -0,0 +1,118 @@
+// Copyright 2026 Pedro Nunes
+//
+// This file is part of Hyperscape.
+//
+// Hyperscape is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Hyperscape is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Hyperscape. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include <glm/vec2.hpp>
+#include <glm/vec3.hpp>
+
+namespace Hyperscape
+{
+
+class Ship;
+class NavigationField;
+using NavigationFieldUniquePtr = std::unique_ptr<NavigationField>;
+
+
+///////////////////////////////////////////////////////////////////////////////
+// NavigationField
+// Coarse occupancy grid covering the sector, which the AI controllers sample
+// to find out if there are other ships in their way without having to ray
+// test against the physics simulation.
+// Every ship stamps a circular footprint into the grid. Ships which haven't
+// moved since the last update are skipped after a position comparison, the
+// cell of a moving ship is a single lookup, and footprints are only
+// recalculated and restamped when a ship moves into a different cell or
+// changes size.
+// The field is deliberately conservative: a blocked sample means there might
+// be a ship there, which should then be confirmed with a short ray test.
+///////////////////////////////////////////////////////////////////////////////
+
+class NavigationField
+{
+public:
+						NavigationField();
+						~NavigationField();
+
+	// Restamps the footprints of any ships which have moved to a different cell.
+	void				Update( float delta );
+
+	// Must be called when a ship leaves the sector, so its footprint is cleared.
+	void				RemoveShip( Ship* pShip );
+
+	// Returns true if the cell containing the position is occupied by any ship other than pIgnoreShip.
+	bool				IsBlocked( const glm::vec2& position, const Ship* pIgnoreShip ) const;
+
+	// Returns true if any of the samples between the two positions are blocked, ignoring pIgnoreShip.
+	bool				IsSegmentBlocked( const glm::vec2& from, const glm::vec2& to, const Ship* pIgnoreShip ) const;
+
+	void				RecordRayTest( bool performed );	// Whether a blocked sample had to be confirmed with a ray test or was skipped.
+
+	float				GetCellSize() const;
+	int					GetRestampsLastFrame() const;
+
+private:
+	struct Footprint
+	{
+		int			x;
+		int			y;
+		int			radius;		// In cells.
+	};
+
+	// What the ship's footprint was last calculated from, so unchanged ships can be skipped.
+	struct TrackedShip
+	{
+		Footprint	footprint;
+		glm::vec2	position;
+		glm::vec3	boundingBoxTopLeft;
+		glm::vec3	boundingBoxBottomRight;
+	};
+	using FootprintMap = std::unordered_map<const Ship*, TrackedShip>;
+
+	bool				ToCell( const glm::vec2& position, int& x, int& y ) const;
+	glm::vec2			ToPosition( int x, int y ) const;
+	int					CalculateFootprintRadius( Ship* pShip ) const;
+	void				Stamp( const Footprint& footprint, int value );
+	bool				IsInFootprint( const Footprint& footprint, int x, int y ) const;
+	void				UpdateDebugUI();
+	void				DebugDraw() const;
+
+	int					m_Size;			// Number of cells along each side of the grid.
+	std::vector<uint16_t> m_Occupancy;	// Number of ship footprints overlapping each cell.
+	FootprintMap		m_Footprints;
+
+	int					m_Restamps;
+	int					m_RestampsLastFrame;
+	int					m_RayTests;
+	int					m_RayTestsLastFrame;
+	int					m_RayTestsSkipped;
+	int					m_RayTestsSkippedLastFrame;
+	bool				m_DebugUIOpen;
+	bool				m_DebugDraw;
+};
+
+inline int NavigationField::GetRestampsLastFrame() const
+{
+	return m_RestampsLastFrame;
+}
+
+}
@@ -61,6 +61,16 @@ float DamageTracker::GetDamage( FactionId id ) const
 	return m_Damage[ static_cast<int>( id ) ];
 }
 
+float DamageTracker::GetTotalDamage() const
+{
+	float total = 0.0f;
+	for ( float damage : m_Damage )
+	{
+		total += damage;
+	}
+	return total;
+}
+
 void DamageTracker::AddDamage( FactionId id, float amount )
 {
 	m_Damage[ static_cast<int>( id ) ] += amount;
@@ -41,6 +41,7 @@ public:
 
 	Ship* GetShip() const;
 	float GetDamage( FactionId id ) const;
+	float GetTotalDamage() const;
 	void AddDamage( FactionId id, float amount );
 	void GetHighestContributor( FactionId& id, float& amount ) const;
 	int GetID() const;
@@ -162,7 +162,7 @@ void HyperspaceGate::Update( float delta )
 	glm::vec3 hyperspaceGatePosLocal( halfPointX, m_BoundingBoxTopLeft.y, 0.0f );
 	glm::vec3 hyperspaceGateEndPosLocal( halfPointX, m_BoundingBoxBottomRight.y, 0.0f );
 
-	const glm::mat4x4& ownerTransform = m_pOwner->GetRigidBody()->GetWorldTransform();
+	const glm::mat4x4& ownerTransform = m_pOwner->GetTransform();
 	m_GatePosition = glm::vec3( ownerTransform * glm::vec4( hyperspaceGatePosLocal, 1.0f ) );
 
 	glm::vec3 hyperspaceGateEndPos;
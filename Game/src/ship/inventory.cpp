@@ -50,7 +50,7 @@ void Inventory::AddModule( const std::string& moduleName, unsigned int quantity
 			);
 		}
 
-		GameEventManager::Broadcast( new GameEventModuleAcquired( pModuleInfo, quantity, triggersNotification ) ); 
+		GameEventManager::Broadcast( GameEventModuleAcquired( pModuleInfo, quantity, triggersNotification ) );
 	}
 }
 
@@ -111,6 +111,34 @@ bool Inventory::Write( tinyxml2::XMLDocument& xmlDoc, tinyxml2::XMLElement* pRoo
 	return result;
 }
 
+void Inventory::Snapshot( SaveGameSnapshot& snapshot ) const
+{
+	snapshot.inventoryVersion = GetVersion();
+	snapshot.items.clear();
+	snapshot.items.reserve( m_Items.size() );
+	for ( auto& inventoryEntry : m_Items )
+	{
+		snapshot.items.push_back( { inventoryEntry.first, static_cast<int>( inventoryEntry.second.quantity ), static_cast<int>( inventoryEntry.second.cached ) } );
+	}
+
+	snapshot.hexGridVersion = m_HexGrid.GetVersion();
+	snapshot.modules.clear();
+
+	int x1, y1, x2, y2;
+	m_HexGrid.GetBoundingBox( x1, y1, x2, y2 );
+	for ( int x = x1; x <= x2; ++x )
+	{
+		for ( int y = y1; y <= y2; ++y )
+		{
+			ModuleInfo* pModuleInfo = m_HexGrid.Get( x, y );
+			if ( pModuleInfo != nullptr )
+			{
+				snapshot.modules.push_back( { x, y, pModuleInfo->GetName() } );
+			}
+		}
+	}
+}
+
 bool Inventory::Read( tinyxml2::XMLElement* pRootElement )
 {
 	int version = 1;
@@ -138,6 +166,35 @@ bool Inventory::Read( tinyxml2::XMLElement* pRootElement )
 	return state;
 }
 
+bool Inventory::Restore( const SaveGameSnapshot& snapshot )
+{
+	for ( const SaveGameItem& item : snapshot.items )
+	{
+		AddModule( item.moduleName, item.quantity, item.cached );
+	}
+
+	// As with ReadHexGridModuleInfo(), the grid stops loading at the first unknown module.
+	ModuleInfoManager* pModuleInfoManager = g_pGame->GetModuleInfoManager();
+	for ( const SaveGameModule& module : snapshot.modules )
+	{
+		ModuleInfo* pModuleInfo = pModuleInfoManager->GetModuleByName( module.moduleName );
+		if ( pModuleInfo == nullptr )
+		{
+			Genesis::Log::Warning() << "Unable to find module '" << module.moduleName << "', skipping.";
+			break;
+		}
+
+		m_HexGrid.Set( module.x, module.y, pModuleInfo );
+	}
+
+	if ( snapshot.inventoryVersion != GetVersion() )
+	{
+		UpgradeFromVersion( snapshot.inventoryVersion );
+	}
+
+	return m_HexGrid.GetUsedSlots() > 0;
+}
+
 void Inventory::UpgradeFromVersion( int version )
 {
     Genesis::Log::Info() << "Inventory::UpgradeFromVersion(): " << version << " -> " << GetVersion();
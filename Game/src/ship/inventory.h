@@ -26,6 +26,7 @@
 // clang-format on
 
 #include "ship/moduleinfo.h"
+#include "savegamesnapshot.h"
 #include "serialisable.h"
 
 struct ItemData
@@ -64,6 +65,8 @@ public:
 	int						GetModuleCount( const std::string& moduleName );
 	void					ClearCachedModules();
 	void					DeductCachedModules();
+	void					Snapshot( SaveGameSnapshot& snapshot ) const;
+	bool					Restore( const SaveGameSnapshot& snapshot ); // The counterpart of Read() for binary saves.
 
 	// Serialisable
 	virtual bool			Write( tinyxml2::XMLDocument& xmlDoc, tinyxml2::XMLElement* pRootElement ) override;
@@ -30,6 +30,7 @@
 #include <sound/soundmanager.h>
 
 #include "menus/shiptweaks.h"
+#include "misc/random.h"
 #include "particles/particlemanager.h"
 #include "particles/particleemitter.h"
 #include "ship/addon/addonenginedisruptor.h"
@@ -64,6 +65,7 @@ Module::Module( ModuleInfo* pInfo )
 	m_pModel = (Genesis::ResourceModel*)Genesis::FrameWork::GetResourceManager()->GetResource( pInfo->GetModel() );
 	m_HexGridSlotX = -1;
 	m_HexGridSlotY = -1;
+	m_TransformIndex = -1;
 	m_pDamageParticleEmitter = nullptr;
 	m_pDeathSFX = nullptr;
 	m_IsLinked = false;
@@ -95,7 +97,7 @@ void Module::Update( float delta )
 	if ( m_pDamageParticleEmitter != nullptr )
 	{
 		glm::vec3 moduleLocalPos = GetLocalPosition() + glm::vec3(0.0f, 0.0f, 10.0f);
-		glm::vec3 moduleWorldPos = glm::vec3( GetOwner()->GetRigidBody()->GetWorldTransform() * glm::vec4(moduleLocalPos, 1.0f) );
+		glm::vec3 moduleWorldPos = glm::vec3( GetOwner()->GetTransform() * glm::vec4(moduleLocalPos, 1.0f) );
 		m_pDamageParticleEmitter->SetPosition( moduleWorldPos );
 	}
 
@@ -236,11 +238,22 @@ glm::vec3 Module::GetLocalPosition( Ship* pShip, int x, int y )
 glm::vec3 Module::GetLocalPosition() const
 {
 	SDL_assert( m_HexGridSlotX != -1 && m_HexGridSlotY != -1 );
+	if ( m_pOwner != nullptr && m_pOwner->HasCachedModuleTransform( m_TransformIndex ) )
+	{
+		return m_pOwner->GetCachedModuleLocalPosition( m_TransformIndex );
+	}
+
 	return Module::GetLocalPosition( m_pOwner, m_HexGridSlotX, m_HexGridSlotY );
 }
 
 glm::vec3 Module::GetWorldPosition() const
 {
+	if ( m_pOwner != nullptr && m_pOwner->HasCachedModuleTransform( m_TransformIndex ) )
+	{
+		return m_pOwner->GetCachedModuleWorldPosition( m_TransformIndex );
+	}
+
+	// Modules added while the ship is being edited aren't part of the cache until the rigid body is recreated.
 	glm::vec3 moduleWorldPos = glm::vec3( GetOwner()->GetRigidBody()->GetWorldTransform() * glm::vec4( GetLocalPosition(), 1.0f) );
 	return moduleWorldPos;
 }
@@ -248,7 +261,7 @@ glm::vec3 Module::GetWorldPosition() const
 void Module::OnDeathEffect()
 {
 	glm::vec3 moduleLocalPos = GetLocalPosition() + glm::vec3(0.0f, 0.0f, 10.0f);
-	glm::vec3 moduleWorldPos = glm::vec3( GetOwner()->GetRigidBody()->GetWorldTransform() * glm::vec4( moduleLocalPos, 1.0f ) );
+	glm::vec3 moduleWorldPos = glm::vec3( GetOwner()->GetTransform() * glm::vec4( moduleLocalPos, 1.0f ) );
 
 	ParticleManager* pParticleManager = g_pGame->GetCurrentSector()->GetParticleManager();
 	ParticleEmitter* pEmitter = pParticleManager->GetAvailableEmitter();
@@ -281,7 +294,7 @@ void Module::OnDamageEffect()
 		};
 
 		glm::vec3 moduleLocalPos = GetLocalPosition() + glm::vec3(0.0f, 0.0f, 5.0f);
-		glm::vec3 moduleWorldPos = glm::vec3( GetOwner()->GetRigidBody()->GetWorldTransform() * glm::vec4( moduleLocalPos, 1.0f ) );
+		glm::vec3 moduleWorldPos = glm::vec3( GetOwner()->GetTransform() * glm::vec4( moduleLocalPos, 1.0f ) );
 
 		ParticleManager* pParticleManager = g_pGame->GetCurrentSector()->GetParticleManager();
 		m_pDamageParticleEmitter = pParticleManager->GetAvailableEmitter();
@@ -289,7 +302,7 @@ void Module::OnDamageEffect()
 		m_pDamageParticleEmitter->SetParticleCount( sInfiniteParticles );
 		m_pDamageParticleEmitter->SetEmissionDelay( 0.1f );
 		m_pDamageParticleEmitter->SetPosition( moduleWorldPos );
-		m_pDamageParticleEmitter->SetTextureAtlas( atlas[ rand() % sFxVariants ], 512, 512, 64 );
+		m_pDamageParticleEmitter->SetTextureAtlas( atlas[ Random::Next( static_cast<uint32_t>( sFxVariants ) ) ], 512, 512, 64 );
 		m_pDamageParticleEmitter->SetScale( 0.5f, 0.75f );
 		m_pDamageParticleEmitter->SetLifetime( 1.0f, 1.0f );
 		m_pDamageParticleEmitter->SetVelocity( glm::vec3( 0.0f, 0.0f, 100.0f ) );
@@ -302,7 +315,7 @@ void Module::LoadDeathSFX()
 	using namespace Genesis;
 
 	std::stringstream ss;
-	ss << "data/sfx/large_explosion_" << ( (rand() % 4) + 1 ) << ".wav";
+	ss << "data/sfx/large_explosion_" << Random::Next( 1u, 5u ) << ".wav";
 
 	m_pDeathSFX = (ResourceSound*)FrameWork::GetResourceManager()->GetResource( ss.str() );
 	if ( m_pDeathSFX != nullptr )
@@ -318,13 +331,11 @@ void Module::PlayDeathSFX()
 	{
 		using namespace Genesis;
 
-		Sound::SoundInstanceSharedPtr pSoundInstance = FrameWork::GetSoundManager()->CreateSoundInstance( m_pDeathSFX );
-		if ( pSoundInstance != nullptr )
-		{
-			const glm::vec3& worldTranslation = GetWorldPosition();
-			pSoundInstance->Set3DAttributes( &worldTranslation );
-			pSoundInstance->SetMinimumDistance( 400.0f );
-		}
+		Sound::SoundRequest request;
+		request.pResource = m_pDeathSFX;
+		request.position = GetWorldPosition();
+		request.minimumDistance = 400.0f;
+		FrameWork::GetSoundManager()->QueueSound( request );
 	}
 }
 
@@ -951,7 +962,7 @@ void TowerModule::OnDamageEffect()
 		};
 
 		glm::vec3 moduleLocalPos = GetLocalPosition() + glm::vec3( 0.0f, 0.0f, 5.0f );
-		glm::vec3 moduleWorldPos = glm::vec3( GetOwner()->GetRigidBody()->GetWorldTransform() * glm::vec4( moduleLocalPos, 1.0f ) );
+		glm::vec3 moduleWorldPos = glm::vec3( GetOwner()->GetTransform() * glm::vec4( moduleLocalPos, 1.0f ) );
 
 		ParticleManager* pParticleManager = g_pGame->GetCurrentSector()->GetParticleManager();
 		m_pDamageParticleEmitter = pParticleManager->GetAvailableEmitter();
@@ -959,7 +970,7 @@ void TowerModule::OnDamageEffect()
 		m_pDamageParticleEmitter->SetParticleCount( sInfiniteParticles );
 		m_pDamageParticleEmitter->SetEmissionDelay( 0.1f );
 		m_pDamageParticleEmitter->SetPosition( moduleWorldPos );
-		m_pDamageParticleEmitter->SetTextureAtlas( atlas[ rand() % sFxVariants ], 512, 512, 64 );
+		m_pDamageParticleEmitter->SetTextureAtlas( atlas[ Random::Next( static_cast<uint32_t>( sFxVariants ) ) ], 512, 512, 64 );
 		m_pDamageParticleEmitter->SetScale( 0.25f, 0.25f );
 		m_pDamageParticleEmitter->SetLifetime( 1.25f, 1.25f );
 		m_pDamageParticleEmitter->SetVelocity( glm::vec3( 0.0f, 0.0f, 50.0f ) );
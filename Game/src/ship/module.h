@@ -101,6 +101,7 @@ public:
 	void							Destroy();
 	inline void						GetHexGridSlot( int& slotX, int &slotY ) const;
 	inline void						SetHexGridSlot( int slotX, int slotY );
+	inline void						SetTransformIndex( int index );		// Index into the owner's transform cache, set when the ship's rigid body is created.
 	
 	virtual void					ApplyDamage( float amount, DamageType damageType, Ship* pDealtBy );
 	virtual void					Repair( float amount );
@@ -137,6 +138,7 @@ protected:
 	float							m_Health;
 	int								m_HexGridSlotX;
 	int								m_HexGridSlotY;
+	int								m_TransformIndex;
 	ParticleEmitter*				m_pDamageParticleEmitter;
 	Genesis::ResourceSound*			m_pDeathSFX;
 	bool							m_IsLinked;
@@ -158,6 +160,12 @@ inline void Module::SetHexGridSlot( int slotX, int slotY )
 {
 	m_HexGridSlotX = slotX;
 	m_HexGridSlotY = slotY;
+	m_TransformIndex = -1; // Until the owner's rigid body is recreated with this module in its new slot.
+}
+
+inline void Module::SetTransformIndex( int index )
+{
+	m_TransformIndex = index;
 }
 
 inline Ship* Module::GetOwner() const
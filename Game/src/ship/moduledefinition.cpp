@@ -0,0 +1,152 @@
+// Copyright 2026 Pedro Nunes
+//
+// This file is part of Hyperscape.
+//
+// Hyperscape is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Hyperscape is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Hyperscape. If not, see <http://www.gnu.org/licenses/>.
+
+#include <cstdlib>
+#include <cstring>
+
+#include <math/misc.h>
+#include <SDL.h>
+
+#include "ship/moduledefinition.h"
+
+namespace Hyperscape
+{
+
+///////////////////////////////////////////////////////////////////////////////
+// ModuleProperty
+///////////////////////////////////////////////////////////////////////////////
+
+ModuleProperty::ModuleProperty( const Genesis::Serialization::InfoDatabase& database, const Genesis::Serialization::InfoDatabaseElement& element ) :
+m_pDatabase( &database ),
+m_pElement( &element )
+{
+
+}
+
+const std::string& ModuleProperty::GetName() const
+{
+	return m_pDatabase->strings[ m_pElement->name ];
+}
+
+const char* ModuleProperty::GetText() const
+{
+	// Index 0 of the string table is the empty string, which is what elements without text use.
+	return ( m_pElement->text == 0 ) ? nullptr : m_pDatabase->strings[ m_pElement->text ].c_str();
+}
+
+const char* ModuleProperty::GetAttribute( const char* pName ) const
+{
+	for ( const Genesis::Serialization::InfoDatabaseAttribute& attribute : m_pElement->attributes )
+	{
+		if ( m_pDatabase->strings[ attribute.name ] == pName )
+		{
+			return m_pDatabase->strings[ attribute.value ].c_str();
+		}
+	}
+
+	return nullptr;
+}
+
+
+///////////////////////////////////////////////////////////////////////////////
+// ModuleDefinition
+///////////////////////////////////////////////////////////////////////////////
+
+ModuleDefinition::ModuleDefinition( const Genesis::Serialization::InfoDatabase& database, const Genesis::Serialization::InfoDatabaseElement& element )
+{
+	m_Properties.reserve( element.children.size() );
+	for ( const Genesis::Serialization::InfoDatabaseElement& child : element.children )
+	{
+		m_Properties.emplace_back( database, child );
+	}
+}
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Serialise
+///////////////////////////////////////////////////////////////////////////////
+
+bool Serialise( const ModuleProperty& property, const std::string& name, std::string& value )
+{
+	if ( name != property.GetName() || property.GetText() == nullptr )
+		return false;
+
+	value = property.GetText();
+	return true;
+}
+
+bool Serialise( const ModuleProperty& property, const std::string& name, int& value )
+{
+	if ( name != property.GetName() || property.GetText() == nullptr )
+		return false;
+
+	value = atoi( property.GetText() );
+	return true;
+}
+
+bool Serialise( const ModuleProperty& property, const std::string& name, float& value )
+{
+	if ( name != property.GetName() || property.GetText() == nullptr )
+		return false;
+
+	value = static_cast<float>( atof( property.GetText() ) );
+	return true;
+}
+
+bool Serialise( const ModuleProperty& property, const std::string& name, bool& value )
+{
+	if ( name != property.GetName() || property.GetText() == nullptr )
+		return false;
+
+	const char* pText = property.GetText();
+	if ( strcmp( pText, "True" ) == 0 || strcmp( pText, "true" ) == 0 )
+	{
+		value = true;
+	}
+	else if ( strcmp( pText, "False" ) == 0 || strcmp( pText, "false" ) == 0 )
+	{
+		value = false;
+	}
+	else
+	{
+		// Invalid value in the definition, defaulting to false.
+		SDL_assert( false );
+		value = false;
+	}
+
+	return true;
+}
+
+bool Serialise( const ModuleProperty& property, const std::string& name, Genesis::Colour& value )
+{
+	if ( name != property.GetName() )
+		return false;
+
+	auto channel = [ &property ]( const char* pChannel )
+	{
+		const char* pValue = property.GetAttribute( pChannel );
+		return ( pValue == nullptr ) ? 0.0f : gClamp<float>( static_cast<float>( atof( pValue ) ), 0.0f, 1.0f );
+	};
+
+	value.r = channel( "r" );
+	value.g = channel( "g" );
+	value.b = channel( "b" );
+	value.a = channel( "a" );
+	return true;
+}
+
+}
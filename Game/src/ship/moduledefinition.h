@@ -0,0 +1,80 @@
+// Copyright 2026 Pedro Nunes
+//
+// This file is part of Hyperscape.
+//
+// Hyperscape is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Hyperscape is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Hyperscape. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include <colour.h>
+#include <infodbserialization.hpp>
+
+namespace Hyperscape
+{
+
+///////////////////////////////////////////////////////////////////////////////
+// ModuleProperty
+// One of the child elements of a module's definition, such as <Name> or
+// <Rarity>. The database must have been validated before properties are
+// read from it.
+///////////////////////////////////////////////////////////////////////////////
+
+class ModuleProperty
+{
+public:
+							ModuleProperty( const Genesis::Serialization::InfoDatabase& database, const Genesis::Serialization::InfoDatabaseElement& element );
+
+	const std::string&		GetName() const;
+	const char*				GetText() const;							// nullptr if the element has no text.
+	const char*				GetAttribute( const char* pName ) const;	// nullptr if the element doesn't have the attribute.
+
+private:
+	const Genesis::Serialization::InfoDatabase* m_pDatabase;
+	const Genesis::Serialization::InfoDatabaseElement* m_pElement;
+};
+
+using ModulePropertyVector = std::vector< ModuleProperty >;
+
+
+///////////////////////////////////////////////////////////////////////////////
+// ModuleDefinition
+// Read-only view of a module's definition in an info database, which is
+// what the ModuleInfos are built from. The definitions are read straight
+// from the database, so loading the modules never builds an XML document.
+///////////////////////////////////////////////////////////////////////////////
+
+class ModuleDefinition
+{
+public:
+								ModuleDefinition( const Genesis::Serialization::InfoDatabase& database, const Genesis::Serialization::InfoDatabaseElement& element );
+
+	const ModulePropertyVector&	GetProperties() const { return m_Properties; }
+
+private:
+	ModulePropertyVector		m_Properties;
+};
+
+
+// Counterparts of Xml::Serialise() for module properties. If the property has the given name,
+// its text is parsed into the value and true is returned.
+bool Serialise( const ModuleProperty& property, const std::string& name, std::string& value );
+bool Serialise( const ModuleProperty& property, const std::string& name, int& value );
+bool Serialise( const ModuleProperty& property, const std::string& name, float& value );
+bool Serialise( const ModuleProperty& property, const std::string& name, bool& value );
+bool Serialise( const ModuleProperty& property, const std::string& name, Genesis::Colour& value );
+
+}
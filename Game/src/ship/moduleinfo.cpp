@@ -15,10 +15,15 @@
 // You should have received a copy of the GNU General Public License
 // along with Hyperscape. If not, see <http://www.gnu.org/licenses/>.
 
+#include <algorithm>
 #include <filesystem>
+#include <fstream>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
+#include <infodbcompiler.hpp>
+#include <infodbserialization.hpp>
 #include <math/misc.h>
 #include <resources/resourcesound.h>
 #include <xml.h>
@@ -27,6 +32,7 @@
 
 #include "game.hpp"
 #include "globals.h"
+#include "ship/moduledefinition.h"
 #include "ship/moduleinfo.h"
 #include "stringaux.h"
 #include "xmlaux.h"
@@ -58,60 +64,194 @@ Genesis::Colour ModuleRarityToColour( ModuleRarity rarity )
 		return Colour( 0.0f, 0.0f, 0.0f );
 }
 
+static bool Serialise( const ModuleProperty& property, const std::string& name, ModuleRarity& value )
+{
+	if ( name != property.GetName() || property.GetText() == nullptr )
+		return false;
+
+	static const std::string rarity[ static_cast<size_t>( ModuleRarity::Count ) ] = 
+	{
+		"Trash",
+		"Common",
+		"Uncommon",
+		"Rare",
+		"Artifact",
+		"Legendary"
+	};
+
+	for ( int i = 0; i < static_cast<int>( ModuleRarity::Count ); ++i )
+	{
+		if ( rarity[ i ] == property.GetText() )
+		{
+			value = static_cast<ModuleRarity>( i );
+			return true;
+		}
+	}
+
+	return false;
+}
+
+static bool Serialise( const ModuleProperty& property, const std::string& name, WeaponBehaviour& value )
+{
+	if ( name != property.GetName() || property.GetText() == nullptr )
+		return false;
+
+	std::string text( property.GetText() );
+	if ( text == "Fixed" )
+	{
+		value = WeaponBehaviour::Fixed;
+		return true;
+	}
+	else if ( text == "Turret" )
+	{
+		value = WeaponBehaviour::Turret;
+		return true;
+	}
+
+	return false;
+}
+
+static bool Serialise( const ModuleProperty& property, const std::string& name, TowerBonus& value )
+{
+	if ( name != property.GetName() || property.GetText() == nullptr )
+		return false;
+
+	std::string text( property.GetText() );
+	if ( text == "None" )
+	{
+		value = TowerBonus::None;
+		return true;
+	}
+	else if ( text == "Damage" )
+	{
+		value = TowerBonus::Damage;
+		return true;
+	}
+	else if ( text == "Movement" )
+	{
+		value = TowerBonus::Movement;
+		return true;
+	}
+	else if ( text == "Shields" )
+	{
+		value = TowerBonus::Shields;
+		return true;
+	}
+	else if ( text == "Sensors" )
+	{
+		value = TowerBonus::Sensors;
+		return true;
+	}
+	else if ( text == "HyperspaceImmunity" )
+	{
+		value = TowerBonus::HyperspaceImmunity;
+		return true;
+	}
+	else if ( text == "Ramming" )
+	{
+		value = TowerBonus::Ramming;
+		return true;
+	}
+
+	return false;
+}
+
 	
 ///////////////////////////////////////////////////////////////////////////////
 // ModuleInfoManager
 ///////////////////////////////////////////////////////////////////////////////
 
+static const std::filesystem::path sModuleDatabasePath( "data/xml/modules.idb" );
+static const std::filesystem::path sModuleSourceDirectory( "data/xml/modules" );
+
 ModuleInfoManager::ModuleInfoManager()
 {
-	using namespace tinyxml2;
+	Genesis::Serialization::InfoDatabase database;
+	if ( LoadDatabase( sModuleDatabasePath, sModuleSourceDirectory, database ) == false )
+	{
+		LoadXml( sModuleSourceDirectory, database );
+	}
 
-	// Run through all the files in data/xml/modules and load all the modules that are listed
-	for ( const auto& moduleFile : std::filesystem::directory_iterator( "data/xml/modules" ) )
-	{	
-		if ( moduleFile.path().extension() != ".xml" )
-		{
-			continue;
-		}
+	for ( const Genesis::Serialization::InfoDatabaseEntry& entry : database.entries )
+	{
+		AddModuleInfo( ModuleDefinition( database, entry.element ) );
+	}
 
-		FILE* fp = nullptr;
+	Genesis::Log::Info() << "Loaded " << m_Modules.size() << " modules.";
+}
 
-#ifdef _WIN32
-		errno_t err = _wfopen_s( &fp, moduleFile.path().c_str(), L"rb" );
-		SDL_assert_release( err == 0 );
-#else
-		fp = fopen( moduleFile.path().c_str(), "rb" );
-		SDL_assert_release( fp != nullptr );
-#endif
+bool ModuleInfoManager::LoadDatabase( const std::filesystem::path& databasePath, const std::filesystem::path& sourceDirectory, Genesis::Serialization::InfoDatabase& database )
+{
+	using namespace Genesis::Serialization;
 
-		tinyxml2::XMLDocument doc;
-		XMLError fileLoaded = doc.LoadFile( fp );
-		SDL_assert_release( fileLoaded == XML_SUCCESS );
+	std::ifstream file( databasePath, std::ios::in | std::ios::binary );
+	if ( file.good() == false )
+	{
+		Genesis::Log::Info() << "Module database " << databasePath << " not found, loading modules from XML.";
+		return false;
+	}
+
+	auto state = bitsery::quickDeserialization<bitsery::InputStreamAdapter>( file, database );
+	if ( state.first != bitsery::ReaderError::NoError || state.second != true || IsValid( database ) == false )
+	{
+		Genesis::Log::Warning() << "Module database " << databasePath << " is invalid, loading modules from XML.";
+		return false;
+	}
 
-		XMLElement* pRootElement = doc.FirstChildElement();
-		for (XMLElement* pModuleEntry = pRootElement->FirstChildElement(); pModuleEntry; pModuleEntry = pModuleEntry->NextSiblingElement()) 
+#ifndef _FINAL
+	// During development the XML files are the source of truth, so the database isn't used if any of them
+	// has been modified since it was compiled. Only the timestamps are checked, the files aren't read.
+	std::error_code errorCode;
+	const std::filesystem::file_time_type databaseTime = std::filesystem::last_write_time( databasePath, errorCode );
+	for ( const auto& sourceFile : std::filesystem::directory_iterator( sourceDirectory, errorCode ) )
+	{
+		if ( sourceFile.path().extension() == ".xml" && sourceFile.last_write_time( errorCode ) > databaseTime )
 		{
-			// Find the type of the module that needs to be created. Each type will load any elements that it needs.
-			ModuleType moduleType = ModuleType::Invalid;
+			Genesis::Log::Warning() << "Module database " << databasePath << " is stale, loading modules from XML.";
+			return false;
+		}
+	}
+#endif
 
-			for ( XMLElement* pElement = pModuleEntry->FirstChildElement(); pElement; pElement = pElement->NextSiblingElement() ) 
-			{
-				if ( strcmp( pElement->Value(), "Type" ) == 0 )
-				{
-					moduleType = StringToModuleType( pElement->GetText() );
-					break;
-				}
-			}
+	Genesis::Log::Info() << "Loading modules from " << databasePath;
+	return true;
+}
 
-			SDL_assert_release( moduleType != ModuleType::Invalid ); //If this asserts then we didn't find a "Type" tag in this module...
+void ModuleInfoManager::LoadXml( const std::filesystem::path& sourceDirectory, Genesis::Serialization::InfoDatabase& database )
+{
+	using namespace Genesis::Serialization;
 
-			ModuleInfo* pModule = CreateModuleInfo( moduleType, pModuleEntry );
-			m_Modules.insert( std::pair< std::string, ModuleInfo* >( pModule->GetName(), pModule ) );
+	// The files are compiled exactly as InfoDbComp would. A file which fails to compile is skipped,
+	// so only the modules it defines are missing.
+	InfoDatabaseCompiler compiler( database );
+	for ( const std::filesystem::path& moduleFile : InfoDatabaseCompiler::GetSourceFiles( sourceDirectory ) )
+	{
+		if ( compiler.CompileFile( moduleFile ) == false )
+		{
+			Genesis::Log::Error() << "Skipping the modules in " << moduleFile << ".";
 		}
+	}
+}
 
-		fclose( fp );
+void ModuleInfoManager::AddModuleInfo( const ModuleDefinition& definition )
+{
+	// Find the type of the module that needs to be created. Each type will load any elements that it needs.
+	ModuleType moduleType = ModuleType::Invalid;
+
+	for ( const ModuleProperty& property : definition.GetProperties() )
+	{
+		std::string type;
+		if ( Serialise( property, "Type", type ) )
+		{
+			moduleType = StringToModuleType( type );
+			break;
+		}
 	}
+
+	SDL_assert_release( moduleType != ModuleType::Invalid ); //If this asserts then we didn't find a "Type" tag in this module...
+
+	ModuleInfo* pModule = CreateModuleInfo( moduleType, definition );
+	m_Modules.insert( std::pair< std::string, ModuleInfo* >( pModule->GetName(), pModule ) );
 }
 
 ModuleInfoManager::~ModuleInfoManager()
@@ -134,16 +274,16 @@ ModuleType ModuleInfoManager::StringToModuleType( const std::string& str ) const
 	else return ModuleType::Invalid;
 }
 
-ModuleInfo* ModuleInfoManager::CreateModuleInfo( ModuleType moduleType, tinyxml2::XMLElement* pElement )
+ModuleInfo* ModuleInfoManager::CreateModuleInfo( ModuleType moduleType, const ModuleDefinition& definition )
 {
 	SDL_assert_release( moduleType != ModuleType::Invalid );
-	if ( moduleType == ModuleType::Engine )				return new EngineInfo( pElement );
-	else if ( moduleType == ModuleType::Armour )		return new ArmourInfo( pElement );
-	else if ( moduleType == ModuleType::Shield )		return new ShieldInfo( pElement );
-	else if ( moduleType == ModuleType::Weapon )		return new WeaponInfo( pElement );
-	else if ( moduleType == ModuleType::Reactor )		return new ReactorInfo( pElement );
-	else if ( moduleType == ModuleType::Addon )			return new AddonInfo( pElement );
-	else if ( moduleType == ModuleType::Tower )			return new TowerInfo( pElement );
+	if ( moduleType == ModuleType::Engine )				return new EngineInfo( definition );
+	else if ( moduleType == ModuleType::Armour )		return new ArmourInfo( definition );
+	else if ( moduleType == ModuleType::Shield )		return new ShieldInfo( definition );
+	else if ( moduleType == ModuleType::Weapon )		return new WeaponInfo( definition );
+	else if ( moduleType == ModuleType::Reactor )		return new ReactorInfo( definition );
+	else if ( moduleType == ModuleType::Addon )			return new AddonInfo( definition );
+	else if ( moduleType == ModuleType::Tower )			return new TowerInfo( definition );
 	else return nullptr;
 }
 
@@ -171,7 +311,7 @@ ModuleInfoVector ModuleInfoManager::GetAllModules() const
 // ModuleInfo
 ///////////////////////////////////////////////////////////////////////////////
 
-ModuleInfo::ModuleInfo( tinyxml2::XMLElement* pModuleElement ):
+ModuleInfo::ModuleInfo( const ModuleDefinition& definition ):
 m_Name( "" ),
 m_FullName( "" ),
 m_Description( "" ),
@@ -187,17 +327,17 @@ m_OverlayColour( 0.0f, 0.0f, 0.0f, 0.0f )
 
 	float extraHealth = 0.0f;
 
-	for ( tinyxml2::XMLElement* pElement = pModuleElement->FirstChildElement(); pElement; pElement = pElement->NextSiblingElement() ) 
+	for ( const ModuleProperty& property : definition.GetProperties() )
 	{
-		Xml::Serialise( pElement, "Name", m_Name );
-		Xml::Serialise( pElement, "FullName", m_FullName );
-		Xml::Serialise( pElement, "Description", m_Description );
-		Xml::Serialise( pElement, "ActivationCost", m_ActivationCost );
-		Xml::Serialise( pElement, "Model", m_Model );
-		Xml::Serialise( pElement, "ExtraHealth", extraHealth );
-		Xml::Serialise( pElement, "Rarity", m_Rarity );
-		Xml::Serialise( pElement, "OverlayColour", m_OverlayColour );
-        Xml::Serialise( pElement, "ContextualTip", m_ContextualTip );
+		Serialise( property, "Name", m_Name );
+		Serialise( property, "FullName", m_FullName );
+		Serialise( property, "Description", m_Description );
+		Serialise( property, "ActivationCost", m_ActivationCost );
+		Serialise( property, "Model", m_Model );
+		Serialise( property, "ExtraHealth", extraHealth );
+		Serialise( property, "Rarity", m_Rarity );
+		Serialise( property, "OverlayColour", m_OverlayColour );
+        Serialise( property, "ContextualTip", m_ContextualTip );
 	}
 
 	// Fallback for all modules which don't have a model yet
@@ -237,7 +377,7 @@ float ModuleInfo::GetHealth( const Ship* pShip ) const
 // EngineInfo
 ///////////////////////////////////////////////////////////////////////////////
 
-EngineInfo::EngineInfo( tinyxml2::XMLElement* pModuleElement ): ModuleInfo( pModuleElement ),
+EngineInfo::EngineInfo( const ModuleDefinition& definition ): ModuleInfo( definition ),
 m_Thrust( 0.0f ),
 m_Torque( 0.0f ),
 m_IsStabilised( false ),
@@ -249,13 +389,13 @@ m_ReducesHyperspaceChargeup( false )
 	m_Type = ModuleType::Engine; 
 	m_Icon = "data/ui/icons/engine.png";
 
-	for ( tinyxml2::XMLElement* pElement = pModuleElement->FirstChildElement(); pElement; pElement = pElement->NextSiblingElement() ) 
+	for ( const ModuleProperty& property : definition.GetProperties() )
 	{
-		Xml::Serialise( pElement, "Thrust", m_Thrust );
-		Xml::Serialise( pElement, "Torque", m_Torque );
+		Serialise( property, "Thrust", m_Thrust );
+		Serialise( property, "Torque", m_Torque );
 
 		std::string bonus;
-		if ( Xml::Serialise( pElement, "Bonus", bonus ) )
+		if ( Serialise( property, "Bonus", bonus ) )
 		{
 			if ( bonus == "Stabilised" )
 			{
@@ -305,7 +445,7 @@ bool EngineInfo::HasBonus( EngineBonus bonus ) const
 // ArmourInfo
 ///////////////////////////////////////////////////////////////////////////////
 
-ArmourInfo::ArmourInfo( tinyxml2::XMLElement* pModuleElement ): ModuleInfo( pModuleElement ),
+ArmourInfo::ArmourInfo( const ModuleDefinition& definition ): ModuleInfo( definition ),
 m_MassMultiplier( 1.0f ),
 m_KineticResistance( 0.0f ),
 m_EnergyResistance( 0.0f ),
@@ -317,13 +457,13 @@ m_RammingProw( false )
 	m_Type = ModuleType::Armour; 
 	m_Icon = "data/ui/icons/armour.png";
 
-	for ( tinyxml2::XMLElement* pElement = pModuleElement->FirstChildElement(); pElement; pElement = pElement->NextSiblingElement() ) 
+	for ( const ModuleProperty& property : definition.GetProperties() )
 	{
-		Xml::Serialise( pElement, "MassMultiplier", m_MassMultiplier );
-		Xml::Serialise( pElement, "KineticResistance", m_KineticResistance );
-		Xml::Serialise( pElement, "EnergyResistance", m_EnergyResistance );
-		Xml::Serialise( pElement, "Regenerative", m_Regenerative );
-		Xml::Serialise( pElement, "Ramming", m_RammingProw );
+		Serialise( property, "MassMultiplier", m_MassMultiplier );
+		Serialise( property, "KineticResistance", m_KineticResistance );
+		Serialise( property, "EnergyResistance", m_EnergyResistance );
+		Serialise( property, "Regenerative", m_Regenerative );
+		Serialise( property, "Ramming", m_RammingProw );
 	}
 
 	SDL_assert_release( m_KineticResistance >= 0.0f && m_KineticResistance <= 1.0f );
@@ -352,7 +492,7 @@ float ArmourInfo::GetMassMultiplier( Ship* pShip ) const
 // ShieldInfo
 ///////////////////////////////////////////////////////////////////////////////
 
-ShieldInfo::ShieldInfo( tinyxml2::XMLElement* pModuleElement ): ModuleInfo( pModuleElement ),
+ShieldInfo::ShieldInfo( const ModuleDefinition& definition ): ModuleInfo( definition ),
 m_Capacity( 0.0f ),
 m_PeakRecharge( 0.0f ),
 m_EnergyUsage( 0.0f ),
@@ -363,12 +503,12 @@ m_Overtuned( false )
 	m_Type = ModuleType::Shield;
 	m_Icon = "data/ui/icons/shield.png";
 
-	for ( tinyxml2::XMLElement* pElement = pModuleElement->FirstChildElement(); pElement; pElement = pElement->NextSiblingElement() ) 
+	for ( const ModuleProperty& property : definition.GetProperties() )
 	{
-		Xml::Serialise( pElement, "Capacity", m_Capacity );
-		Xml::Serialise( pElement, "PeakRechargeRate", m_PeakRecharge );
-		Xml::Serialise( pElement, "EnergyUsage", m_EnergyUsage );
-		Xml::Serialise( pElement, "Overtuned", m_Overtuned );
+		Serialise( property, "Capacity", m_Capacity );
+		Serialise( property, "PeakRechargeRate", m_PeakRecharge );
+		Serialise( property, "EnergyUsage", m_EnergyUsage );
+		Serialise( property, "Overtuned", m_Overtuned );
 	}
 
 	SDL_assert_release( m_Capacity > 0.0f );
@@ -398,7 +538,7 @@ float ShieldInfo::GetEnergyUsage( Ship* pShip ) const
 // TowerInfo
 ///////////////////////////////////////////////////////////////////////////////
 
-TowerInfo::TowerInfo( tinyxml2::XMLElement* pModuleElement ): ModuleInfo( pModuleElement ),
+TowerInfo::TowerInfo( const ModuleDefinition& definition ): ModuleInfo( definition ),
 m_BonusType( TowerBonus::None ),
 m_BonusMagnitude( 0.0f )
 {
@@ -407,11 +547,11 @@ m_BonusMagnitude( 0.0f )
 	m_Type = ModuleType::Tower; 
 	m_Icon = "data/ui/icons/bridge.png";
 
-	for ( tinyxml2::XMLElement* pElement = pModuleElement->FirstChildElement(); pElement; pElement = pElement->NextSiblingElement() ) 
+	for ( const ModuleProperty& property : definition.GetProperties() )
 	{
-		Xml::Serialise( pElement, "BonusMagnitude", m_BonusMagnitude );
-		Xml::Serialise( pElement, "Bonus", m_BonusType );
-		Xml::Serialise( pElement, "ShortDescription", m_ShortDescription );
+		Serialise( property, "BonusMagnitude", m_BonusMagnitude );
+		Serialise( property, "Bonus", m_BonusType );
+		Serialise( property, "ShortDescription", m_ShortDescription );
 	}
 
 	SDL_assert_release( m_BonusMagnitude >= 0.0f );
@@ -427,7 +567,7 @@ Module* TowerInfo::CreateModule()
 // WeaponInfo
 ///////////////////////////////////////////////////////////////////////////////
 
-WeaponInfo::WeaponInfo( tinyxml2::XMLElement* pModuleElement ): ModuleInfo( pModuleElement ),
+WeaponInfo::WeaponInfo( const ModuleDefinition& definition ): ModuleInfo( definition ),
 m_Behaviour( WeaponBehaviour::Invalid ),
 m_System( WeaponSystem::Invalid ),
 m_Rof( 0.0f ),
@@ -454,32 +594,32 @@ m_MuzzleflashScale( 1.0f )
 	std::string onFireSFX;
 	std::string onHitSFX;
 
-	for ( tinyxml2::XMLElement* pElement = pModuleElement->FirstChildElement(); pElement; pElement = pElement->NextSiblingElement() ) 
-	{
-		Xml::Serialise( pElement, "WeaponModel", m_WeaponModel );
-		Xml::Serialise( pElement, "Rof", m_Rof );
-		Xml::Serialise( pElement, "Damage", m_Damage );
-		Xml::Serialise( pElement, "Burst", m_Burst );
-		Xml::Serialise( pElement, "RayLength", m_RayLength );
-		Xml::Serialise( pElement, "Speed", m_Speed );
-		Xml::Serialise( pElement, "Range", m_Range );
-		Xml::Serialise( pElement, "Behaviour", m_Behaviour );
-		Xml::Serialise( pElement, "Tracking", m_Tracking );
-		Xml::Serialise( pElement, "Swarm", m_IsSwarm );
-		Xml::Serialise( pElement, "BeamWidth", m_BeamWidth );
-		Xml::Serialise( pElement, "BeamLifetime", m_BeamLifetime );
-		Xml::Serialise( pElement, "BeamColourR", m_BeamColour.r );
-		Xml::Serialise( pElement, "BeamColourG", m_BeamColour.g );
-		Xml::Serialise( pElement, "BeamColourB", m_BeamColour.b );
-		Xml::Serialise( pElement, "OnFireSFX", onFireSFX );
-		Xml::Serialise( pElement, "OnHitSFX", onHitSFX );
-		Xml::Serialise( pElement, "OnHitSFXDistance", m_OnHitSFXDistance );
-		Xml::Serialise( pElement, "MuzzleflashScale", m_MuzzleflashScale );
-		Xml::Serialise( pElement, "MuzzleflashColourR", m_MuzzleflashColour.r );
-		Xml::Serialise( pElement, "MuzzleflashColourG", m_MuzzleflashColour.g );
-		Xml::Serialise( pElement, "MuzzleflashColourB", m_MuzzleflashColour.b );
-
-		if ( strcmp( pElement->Value(), "System" ) == 0 )
+	for ( const ModuleProperty& property : definition.GetProperties() )
+	{
+		Serialise( property, "WeaponModel", m_WeaponModel );
+		Serialise( property, "Rof", m_Rof );
+		Serialise( property, "Damage", m_Damage );
+		Serialise( property, "Burst", m_Burst );
+		Serialise( property, "RayLength", m_RayLength );
+		Serialise( property, "Speed", m_Speed );
+		Serialise( property, "Range", m_Range );
+		Serialise( property, "Behaviour", m_Behaviour );
+		Serialise( property, "Tracking", m_Tracking );
+		Serialise( property, "Swarm", m_IsSwarm );
+		Serialise( property, "BeamWidth", m_BeamWidth );
+		Serialise( property, "BeamLifetime", m_BeamLifetime );
+		Serialise( property, "BeamColourR", m_BeamColour.r );
+		Serialise( property, "BeamColourG", m_BeamColour.g );
+		Serialise( property, "BeamColourB", m_BeamColour.b );
+		Serialise( property, "OnFireSFX", onFireSFX );
+		Serialise( property, "OnHitSFX", onHitSFX );
+		Serialise( property, "OnHitSFXDistance", m_OnHitSFXDistance );
+		Serialise( property, "MuzzleflashScale", m_MuzzleflashScale );
+		Serialise( property, "MuzzleflashColourR", m_MuzzleflashColour.r );
+		Serialise( property, "MuzzleflashColourG", m_MuzzleflashColour.g );
+		Serialise( property, "MuzzleflashColourB", m_MuzzleflashColour.b );
+
+		if ( property.GetName() == "System" )
 		{
 			const std::string systems[ static_cast<size_t>( WeaponSystem::Count ) ] = {
 				"Projectile",
@@ -494,7 +634,7 @@ m_MuzzleflashScale( 1.0f )
 
 			for ( int i = 0; i < static_cast<int>( WeaponSystem::Count ); ++i )
 			{
-				if ( strcmp( pElement->GetText(), systems[ i ].c_str() ) == 0 )
+				if ( strcmp( property.GetText(), systems[ i ].c_str() ) == 0 )
 				{
 					m_System = static_cast<WeaponSystem>( i );
 					break;
@@ -585,7 +725,7 @@ float WeaponInfo::GetActivationCost( Ship* pShip ) const
 // ReactorInfo
 ///////////////////////////////////////////////////////////////////////////////
 
-ReactorInfo::ReactorInfo( tinyxml2::XMLElement* pModuleElement ): ModuleInfo( pModuleElement ),
+ReactorInfo::ReactorInfo( const ModuleDefinition& definition ): ModuleInfo( definition ),
 m_Capacity( 0.0f ),
 m_RechargeRate( 0.0f )
 {
@@ -594,10 +734,10 @@ m_RechargeRate( 0.0f )
 	m_Type = ModuleType::Reactor; 
 	m_Icon = "data/ui/icons/reactor.png";
 
-	for ( tinyxml2::XMLElement* pElement = pModuleElement->FirstChildElement(); pElement; pElement = pElement->NextSiblingElement() ) 
+	for ( const ModuleProperty& property : definition.GetProperties() )
 	{
-		Xml::Serialise( pElement, "Capacity", m_Capacity );
-		Xml::Serialise( pElement, "RechargeRate", m_RechargeRate );
+		Serialise( property, "Capacity", m_Capacity );
+		Serialise( property, "RechargeRate", m_RechargeRate );
 	}
 
 	SDL_assert_release( m_Capacity > 0.0f );
@@ -614,7 +754,7 @@ Module* ReactorInfo::CreateModule()
 // AddonInfo
 ///////////////////////////////////////////////////////////////////////////////
 
-AddonInfo::AddonInfo( tinyxml2::XMLElement* pModuleElement ): ModuleInfo( pModuleElement ),
+AddonInfo::AddonInfo( const ModuleDefinition& definition ): ModuleInfo( definition ),
 m_Category( AddonCategory::Invalid ),
 m_ActivationType( AddonActivationType::Invalid ),
 m_Cooldown( 0.0f )
@@ -624,60 +764,60 @@ m_Cooldown( 0.0f )
 	m_Type = ModuleType::Addon; 
 	m_Icon = "data/ui/icons/addon.png";
 
-	for ( tinyxml2::XMLElement* pElement = pModuleElement->FirstChildElement(); pElement; pElement = pElement->NextSiblingElement() ) 
+	for ( const ModuleProperty& property : definition.GetProperties() )
 	{
-		if ( strcmp( pElement->Value(), "Category" ) == 0 && pElement->GetText() != nullptr )
+		if ( property.GetName() == "Category" && property.GetText() != nullptr )
 		{	
-			if ( strcmp( pElement->GetText(), "ModuleRepairer" ) == 0 )
+			if ( strcmp( property.GetText(), "ModuleRepairer" ) == 0 )
 			{
 				m_Category = AddonCategory::ModuleRepairer;
 				m_Icon = "data/ui/icons/armourrepairer.png";
 			}
-			else if ( strcmp( pElement->GetText(), "HangarBay" ) == 0 ) 
+			else if ( strcmp( property.GetText(), "HangarBay" ) == 0 ) 
 			{
 				m_Category = AddonCategory::HangarBay;
 			}
-			else if ( strcmp( pElement->GetText(), "DroneBay" ) == 0 ) 
+			else if ( strcmp( property.GetText(), "DroneBay" ) == 0 ) 
 			{
 				m_Category = AddonCategory::DroneBay;
 			}
-			else if ( strcmp( pElement->GetText(), "MissileInterceptor" ) == 0 )
+			else if ( strcmp( property.GetText(), "MissileInterceptor" ) == 0 )
 			{
 				m_Category = AddonCategory::MissileInterceptor;
 				m_Icon = "data/ui/icons/intercept.png";
 			}
-			else if ( strcmp( pElement->GetText(), "ParticleAccelerator" ) == 0 )
+			else if ( strcmp( property.GetText(), "ParticleAccelerator" ) == 0 )
 			{
 				m_Category = AddonCategory::ParticleAccelerator;
 				m_Icon = "data/ui/icons/particle_accelerator.png";
 			}
-			else if ( strcmp( pElement->GetText(), "PhaseBarrier" ) == 0 )
+			else if ( strcmp( property.GetText(), "PhaseBarrier" ) == 0 )
 			{
 				m_Category = AddonCategory::PhaseBarrier;
 				m_Icon = "data/ui/icons/phasebarrier.png";
 			}
-			else if ( strcmp( pElement->GetText(), "FuelInjector" ) == 0 ) 
+			else if ( strcmp( property.GetText(), "FuelInjector" ) == 0 ) 
 			{
 				m_Category = AddonCategory::FuelInjector;
 			}
-			else if ( strcmp( pElement->GetText(), "EngineDisruptor" ) == 0 )
+			else if ( strcmp( property.GetText(), "EngineDisruptor" ) == 0 )
 			{
 				m_Category = AddonCategory::EngineDisruptor;
 			}
-			else if ( strcmp( pElement->GetText(), "QuantumStateAlternator" ) == 0 )
+			else if ( strcmp( property.GetText(), "QuantumStateAlternator" ) == 0 )
 			{
 				m_Category = AddonCategory::QuantumStateAlternator;
 				m_Icon = "data/ui/icons/quantum_alternator.png";
 			}
 		}
-		else if ( strcmp( pElement->Value(), "ActivationType" ) == 0 && pElement->GetText() != nullptr )
+		else if ( property.GetName() == "ActivationType" && property.GetText() != nullptr )
 		{
-			if ( strcmp( pElement->GetText(), "Trigger" ) == 0 ) m_ActivationType = AddonActivationType::Trigger;
-			else if ( strcmp( pElement->GetText(), "Toggle" ) == 0 ) m_ActivationType = AddonActivationType::Toggle;
+			if ( strcmp( property.GetText(), "Trigger" ) == 0 ) m_ActivationType = AddonActivationType::Trigger;
+			else if ( strcmp( property.GetText(), "Toggle" ) == 0 ) m_ActivationType = AddonActivationType::Toggle;
 		}
 
-		Xml::Serialise( pElement, "Cooldown", m_Cooldown );
-		Xml::Serialise( pElement, "Parameter", m_Parameter );
+		Serialise( property, "Cooldown", m_Cooldown );
+		Serialise( property, "Parameter", m_Parameter );
 	}
 
 	if ( m_Cooldown <= 0.0f )
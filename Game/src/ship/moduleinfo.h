@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <filesystem>
 #include <string>
 #include <map>
 #include <vector>
@@ -36,12 +37,18 @@ namespace Genesis
 
 class ResourceSound;
 
+namespace Serialization
+{
+struct InfoDatabase;
+}
+
 }
 
 namespace Hyperscape
 {
 
 class Module;
+class ModuleDefinition;
 class ModuleInfo;
 class Ship;
 
@@ -82,7 +89,10 @@ Genesis::Colour ModuleRarityToColour( ModuleRarity rarity );
 // Keeps a map of all the Modules that can be equipped in a ship.
 // The data from the ModuleInfoManager remains valid from the start of the game 
 // until it is closed.
-// The modules are loaded from all the XML files in Data/Xml/Modules/
+// The modules are loaded from the info database compiled by InfoDbComp from
+// all the XML files in Data/Xml/Modules/. If the database is missing, invalid
+// or (development builds only) older than the XML files, they are compiled
+// in memory instead, so the modules are always built from a database.
 ///////////////////////////////////////////////////////////////////////////////
 
 typedef std::map< std::string, ModuleInfo* > ModuleMap;
@@ -97,8 +107,11 @@ public:
 	ModuleInfoVector GetAllModules() const;
 
 private:
+	bool LoadDatabase( const std::filesystem::path& databasePath, const std::filesystem::path& sourceDirectory, Genesis::Serialization::InfoDatabase& database );
+	void LoadXml( const std::filesystem::path& sourceDirectory, Genesis::Serialization::InfoDatabase& database );
+	void AddModuleInfo( const ModuleDefinition& definition );
 	ModuleType StringToModuleType( const std::string& str ) const;
-	ModuleInfo* CreateModuleInfo( ModuleType moduleType, tinyxml2::XMLElement* pElement );
+	ModuleInfo* CreateModuleInfo( ModuleType moduleType, const ModuleDefinition& definition );
 	ModuleMap m_Modules;
 };
 
@@ -112,7 +125,7 @@ private:
 class ModuleInfo
 {
 public:
-							ModuleInfo( tinyxml2::XMLElement* pElement );
+							ModuleInfo( const ModuleDefinition& definition );
 	virtual					~ModuleInfo() {};
 
 	const std::string&		GetName()			const { return m_Name; }
@@ -159,7 +172,7 @@ enum class EngineBonus
 class EngineInfo: public ModuleInfo
 {
 public:
-						EngineInfo( tinyxml2::XMLElement* pElement );
+						EngineInfo( const ModuleDefinition& definition );
 	virtual				~EngineInfo() {};
 
 	virtual Module*		CreateModule();
@@ -184,7 +197,7 @@ private:
 class SensorInfo: public ModuleInfo
 {
 public:
-						SensorInfo( tinyxml2::XMLElement* pElement );
+						SensorInfo( const ModuleDefinition& definition );
 	virtual				~SensorInfo() {};
 	virtual Module*		CreateModule();
 };
@@ -197,7 +210,7 @@ public:
 class ArmourInfo: public ModuleInfo
 {
 public:
-						ArmourInfo( tinyxml2::XMLElement* pElement );
+						ArmourInfo( const ModuleDefinition& definition );
 	virtual				~ArmourInfo() {};
 	virtual Module*		CreateModule();
 
@@ -223,7 +236,7 @@ private:
 class ShieldInfo: public ModuleInfo
 {
 public:
-						ShieldInfo( tinyxml2::XMLElement* pElement );
+						ShieldInfo( const ModuleDefinition& definition );
 	virtual				~ShieldInfo() {};
 	virtual Module*		CreateModule();
 
@@ -278,7 +291,7 @@ enum class DamageType
 class WeaponInfo: public ModuleInfo
 {
 public:
-								WeaponInfo( tinyxml2::XMLElement* pElement );
+								WeaponInfo( const ModuleDefinition& definition );
 	virtual						~WeaponInfo() {};
 	virtual Module*				CreateModule();
 
@@ -338,7 +351,7 @@ private:
 class ReactorInfo: public ModuleInfo
 {
 public:
-						ReactorInfo( tinyxml2::XMLElement* pElement );
+						ReactorInfo( const ModuleDefinition& definition );
 	virtual				~ReactorInfo() {};
 	virtual Module*		CreateModule();
 
@@ -379,7 +392,7 @@ enum class AddonActivationType
 class AddonInfo: public ModuleInfo
 {
 public:
-						AddonInfo( tinyxml2::XMLElement* pElement );
+						AddonInfo( const ModuleDefinition& definition );
 	virtual				~AddonInfo() {};
 	virtual Module*		CreateModule();
 
@@ -414,7 +427,7 @@ enum class TowerBonus
 class TowerInfo: public ModuleInfo
 {
 public:
-						TowerInfo( tinyxml2::XMLElement* pElement );
+						TowerInfo( const ModuleDefinition& definition );
 	virtual				~TowerInfo() {};
 	virtual Module*		CreateModule();
 
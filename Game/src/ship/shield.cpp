@@ -210,7 +210,7 @@ void Shield::Update( float delta )
 
 	if ( m_State != ShieldState::Deactivated )
 	{
-		m_pGhost->SetWorldTransform( m_pOwner->GetRigidBody()->GetWorldTransform() );
+		m_pGhost->SetWorldTransform( m_pOwner->GetTransform() );
 	}
 }
 
@@ -25,6 +25,7 @@
 #include "menus/intelwindow.h"
 #include "menus/shiptweaks.h"
 #include "misc/mathaux.h"
+#include "misc/random.h"
 #include "particles/particleemitter.h"
 #include "particles/particlemanager.h"
 #include "player.h"
@@ -80,6 +81,8 @@ Ship::Ship()
     , m_pRigidBody(nullptr)
     , m_Energy(0.0f)
     , m_EnergyCapacity(0.0f)
+    , m_Transform(1.0f)
+    , m_TransformCacheDirty(true)
     , m_DockingState(DockingState::Undocked)
     , m_pShipyard(nullptr)
     , m_EditLock(false)
@@ -326,7 +329,7 @@ void Ship::Initialise()
     }
 
     using namespace std::placeholders;
-    auto collisionCallbackFn = std::bind(&Ship::OnCollision, this, _1, _2, _3, _4, _5);
+    auto collisionCallbackFn = std::bind(&Ship::OnCollision, this, _1, _2, _3, _4, _5, _6, _7);
     m_CollisionCallbackHandle = g_pGame->GetPhysicsSimulation()->RegisterCollisionCallback(collisionCallbackFn);
 }
 
@@ -420,9 +423,6 @@ void Ship::CreateRigidBody()
         DestroyRigidBody();
     }
 
-    // The ship has a single compound shape which will contain shapes for each individual module.
-    m_pCompoundShape = std::make_shared<CompoundShape>();
-
     // Calculate the ship's mass and centre of mass.
     m_CentreOfMass = glm::vec3(0.0f);
     float mass = 0.0f;
@@ -456,6 +456,11 @@ void Ship::CreateRigidBody()
     m_CentreOfMass /= mass;
 
     // Create the actual physics shapes, as they have to be offset by the centre of mass.
+    // Every module uses the same cylinder, which is shared with all other ships. Each module is
+    // identified by its collision info, which is the user data of its child in the compound shape.
+    CylinderShapeSharedPtr pModuleShape = g_pGame->GetPhysicsSimulation()->GetShapeCache()->GetCylinderShape(CylinderShapeAxis::Z, sModuleWidth, sModuleWidth, 40.0f);
+    CompoundShapeChildren childShapes;
+    childShapes.reserve(m_ModuleHexGrid.GetUsedSlots());
     for (int x = x1; x <= x2; ++x)
     {
         for (int y = y1; y <= y2; ++y)
@@ -463,18 +468,18 @@ void Ship::CreateRigidBody()
             Module* pModule = m_ModuleHexGrid.Get(x, y);
             if (pModule != nullptr)
             {
-                CylinderShapeSharedPtr pShape = std::make_shared<CylinderShape>(CylinderShapeAxis::Z, sModuleWidth, sModuleWidth, 40.0f);
-                pShape->SetUserData(pModule->GetCollisionInfo());
-
                 glm::vec3 modulePos = pModule->GetLocalPosition();
-                m_pCompoundShape->AddChildShape(pShape, glm::translate(modulePos - m_CentreOfMass));
-                pModule->SetPhysicsShape(pShape);
+                childShapes.emplace_back(pModuleShape, glm::translate(modulePos - m_CentreOfMass), pModule->GetCollisionInfo());
+                pModule->SetPhysicsShape(pModuleShape);
 
                 m_Modules.push_back(pModule);
             }
         }
     }
 
+    // The ship has a single compound shape which will contain shapes for each individual module.
+    m_pCompoundShape = std::make_shared<CompoundShape>(childShapes);
+
     CalculateBoundingBox();
 
     // If we have a shield, we want an additional shape. The shield needs to know the shape index for damage handling purposes.
@@ -504,6 +509,20 @@ void Ship::CreateRigidBody()
     // The ship can only move in the XY plane and can only rotate around the Z axis.
     m_pRigidBody->SetLinearFactor(glm::vec3(1.0f, 1.0f, 0.0f));
     m_pRigidBody->SetAngularFactor(glm::vec3(0.0f, 0.0f, 1.0f));
+
+    // Now that the rigid body has a centre of mass, the module's local positions can be cached.
+    const size_t moduleCount = m_Modules.size();
+    m_ModuleLocalPositions.resize(moduleCount);
+    m_ModuleWorldPositions.resize(moduleCount);
+    for (size_t i = 0; i < moduleCount; ++i)
+    {
+        int x, y;
+        m_Modules[i]->GetHexGridSlot(x, y);
+        m_ModuleLocalPositions[i] = Module::GetLocalPosition(this, x, y);
+        m_Modules[i]->SetTransformIndex(static_cast<int>(i));
+    }
+    m_TransformCacheDirty = true;
+    UpdateTransformCache();
 }
 
 void Ship::DestroyRigidBody()
@@ -521,10 +540,47 @@ void Ship::DestroyRigidBody()
     }
 
     m_Modules.clear();
+    m_ModuleLocalPositions.clear();
+    m_ModuleWorldPositions.clear();
+    m_TransformCacheDirty = true;
+}
+
+void Ship::UpdateTransformCache()
+{
+    if (m_pRigidBody == nullptr)
+    {
+        m_Transform = glm::mat4x4(1.0f);
+        return;
+    }
+
+    const glm::mat4x4 transform = m_pRigidBody->GetWorldTransform();
+    if (m_TransformCacheDirty == false && transform == m_Transform)
+    {
+        return;
+    }
+
+    m_Transform = transform;
+    m_TransformCacheDirty = false;
+
+    // The transform is rigid, so every module can be moved with a rotation and a translation
+    // rather than going through the full matrix.
+    const glm::mat3x3 rotation(transform);
+    const glm::vec3 translation(transform[3]);
+    const size_t moduleCount = m_ModuleLocalPositions.size();
+    const glm::vec3* pLocalPositions = m_ModuleLocalPositions.data();
+    glm::vec3* pWorldPositions = m_ModuleWorldPositions.data();
+    for (size_t i = 0; i < moduleCount; ++i)
+    {
+        pWorldPositions[i] = rotation * pLocalPositions[i] + translation;
+    }
 }
 
 void Ship::Update(float delta)
 {
+    // Everything the ship updates (modules, weapons, shield, controller) reads the cached transform,
+    // so it needs to be refreshed before any of them run.
+    UpdateTransformCache();
+
     // It is still possible for the ship to be updated once after the sector is deleted
     if (g_pGame->GetCurrentSector() == nullptr)
     {
@@ -552,11 +608,7 @@ void Ship::Update(float delta)
     TowerModule* pTowerModule = GetTowerModule();
     if (pTowerModule != nullptr)
     {
-        // Local HexGrid coordinates to local space
-        glm::vec3 moduleLocalPos = pTowerModule->GetLocalPosition();
-
-        // Local space to world space
-        m_TowerPosition = glm::vec3(m_pRigidBody->GetWorldTransform() * glm::vec4(moduleLocalPos, 1.0f));
+        m_TowerPosition = pTowerModule->GetWorldPosition();
 
         if (IsDestroyed() == false)
             m_pController->Update(delta);
@@ -655,7 +707,7 @@ void Ship::UpdateEngines(float delta)
                 if (pTrail != nullptr)
                 {
                     glm::vec3 moduleLocalPos = pEngine->GetLocalPosition() + pEngine->GetTrailOffset();
-                    glm::vec3 moduleWorldPos = glm::vec3(GetRigidBody()->GetWorldTransform() * glm::vec4(moduleLocalPos, 1.0f));
+                    glm::vec3 moduleWorldPos = glm::vec3(GetTransform() * glm::vec4(moduleLocalPos, 1.0f));
                     pTrail->AddPoint(moduleWorldPos);
                 }
             }
@@ -841,7 +893,7 @@ void Ship::Render()
 
     glEnable(GL_DEPTH_TEST);
 
-    glm::mat4 modelTransform = GetRigidBody()->GetWorldTransform();
+    glm::mat4 modelTransform = GetTransform();
     if (GetHyperspaceCore() != nullptr)
     {
         GetHyperspaceCore()->GetHyperspaceGate()->Render(modelTransform);
@@ -970,7 +1022,7 @@ void Ship::SetSharedShaderParameters(Module* pModule, Genesis::Material* pMateri
     //        glm::vec3 hyperspaceClipPosition(m_pHyperspaceCore->GetHyperspaceGate()->GetGatePosition());
     //        m_pUniforms->Set(ShipShaderUniform::Clip, glm::vec4(hyperspaceClipPosition, 0.0f));
 
-    //        glm::vec4 hyperspaceClipDirection = glm::column(GetRigidBody()->GetWorldTransform(), 1);
+    //        glm::vec4 hyperspaceClipDirection = glm::column(GetTransform(), 1);
     //        m_pUniforms->Set(ShipShaderUniform::ClipForward, hyperspaceClipDirection);
     //    }
 
@@ -1053,7 +1105,7 @@ void Ship::DamageShield(WeaponSystem weaponSystem, DamageType damageType, float
 
     const glm::vec3 shipPosition = GetRigidBody()->GetPosition();
     const glm::vec3 dir = shipPosition - hitPosition;
-    const glm::vec3 shipForward(glm::column(GetRigidBody()->GetWorldTransform(), 1));
+    const glm::vec3 shipForward(glm::column(GetTransform(), 1));
     const float angle = atan2f(dir.y, dir.x) - atan2f(shipForward.y, shipForward.x) - Genesis::kPi2;
 
     m_pShield->ApplyDamage(displayDamage, frameDamage, angle, weaponSystem, damageType, pDealtBy);
@@ -1141,7 +1193,7 @@ void Ship::CalculateRammingDamage(const Ship* pRammingShip, const Ship* pRammedS
 }
 
 void Ship::OnCollision(Genesis::Physics::RigidBody* pRigidBodyA, Genesis::Physics::RigidBody* pRigidBodyB, Genesis::Physics::ShapeWeakPtr pShapeA, Genesis::Physics::ShapeWeakPtr pShapeB,
-                       const glm::vec3& hitPosition)
+                       void* pUserDataA, void* pUserDataB, const glm::vec3& hitPosition)
 {
     // Is this collision relevant to us?
     if (pRigidBodyA != GetRigidBody() && pRigidBodyB != GetRigidBody())
@@ -1170,21 +1222,25 @@ void Ship::OnCollision(Genesis::Physics::RigidBody* pRigidBodyA, Genesis::Physic
     const Genesis::Physics::RigidBody* pOtherRigidBody = (pRigidBodyA == GetRigidBody()) ? pRigidBodyB : pRigidBodyA;
     const Genesis::Physics::ShapeWeakPtr pOtherShape = (pRigidBodyA == GetRigidBody()) ? pShapeB : pShapeA;
     const Genesis::Physics::ShapeWeakPtr pOurShape = (pRigidBodyA == GetRigidBody()) ? pShapeA : pShapeB;
-    auto extractModuleFn = [](const Genesis::Physics::ShapeWeakPtr pShape) -> Module*
+    void* pOtherUserData = (pRigidBodyA == GetRigidBody()) ? pUserDataB : pUserDataA;
+    void* pOurUserData = (pRigidBodyA == GetRigidBody()) ? pUserDataA : pUserDataB;
+
+    // Module shapes are shared, so the module is identified by the user data of the child shape we've hit.
+    auto extractModuleFn = [](const Genesis::Physics::ShapeWeakPtr pShape, void* pUserData) -> Module*
     {
-        if (pShape.expired())
+        if (pShape.expired() || pUserData == nullptr)
         {
             return nullptr;
         }
         else
         {
-            ShipCollisionInfo* pShipCollisionInfo = reinterpret_cast<ShipCollisionInfo*>(pShape.lock()->GetUserData());
+            ShipCollisionInfo* pShipCollisionInfo = reinterpret_cast<ShipCollisionInfo*>(pUserData);
             SDL_assert(pShipCollisionInfo->GetType() == ShipCollisionType::Module);
             return pShipCollisionInfo->GetModule();
         }
     };
-    Module* pOtherModule = extractModuleFn(pOtherShape);
-    Module* pOurModule = extractModuleFn(pOurShape);
+    Module* pOtherModule = extractModuleFn(pOtherShape, pOtherUserData);
+    Module* pOurModule = extractModuleFn(pOurShape, pOurUserData);
     if (pOtherModule == nullptr || pOtherModule->GetOwner() == nullptr || pOurModule == nullptr)
     {
         return;
@@ -1334,7 +1390,7 @@ void Ship::OnModuleDestroyed(Module* pModule)
         CompoundShapeSharedPtr pCompoundShape = std::static_pointer_cast<CompoundShape>(pShape);
         if (pModule->GetPhysicsShape() != nullptr)
         {
-            pCompoundShape->RemoveChildShape(pModule->GetPhysicsShape());
+            pCompoundShape->RemoveChildShapeByUserData(pModule->GetCollisionInfo());
             pModule->SetPhysicsShape(nullptr);
         }
     }
@@ -1437,11 +1493,11 @@ void Ship::SpawnLoot()
     }
     else
     {
-        const int s = rand() % matchingModules.size();
+        const int s = static_cast<int>(Random::Next(static_cast<uint32_t>(matchingModules.size())));
         ModuleInfo* pSelectedModuleInfo = matchingModules[s];
         if (pSelectedModuleInfo->GetType() == ModuleType::Armour)
         {
-            const int quantity = 3 + rand() % 2;
+            const int quantity = static_cast<int>(Random::Next(3u, 5u));
             g_pGame->GetPlayer()->GetInventory()->AddModule(pSelectedModuleInfo->GetName(), quantity, 0, true);
         }
         else
@@ -1530,18 +1586,6 @@ bool Ship::IsFlagship() const
     return m_pShipInfo ? m_pShipInfo->IsFlagship() : false;
 }
 
-glm::mat4x4 Ship::GetTransform() const
-{
-    if (m_pRigidBody == nullptr)
-    {
-        return glm::mat4x4(1.0f);
-    }
-    else
-    {
-        return m_pRigidBody->GetWorldTransform();
-    }
-}
-
 void Ship::RammingSpeed()
 {
     using namespace Genesis;
@@ -1597,7 +1641,7 @@ glm::vec3 Ship::GetCentre(TransformSpace transformSpace) const
     }
     else if (transformSpace == TransformSpace::World)
     {
-        glm::mat4x4 shipTransform = GetRigidBody()->GetWorldTransform();
+        glm::mat4x4 shipTransform = GetTransform();
         glm::vec3 shipCentre = glm::vec3(shipTransform * glm::vec4(bbCentre, 1.0f));
         return shipCentre;
     }
@@ -177,11 +177,16 @@ public:
 	void							DamageModule( WeaponSystem weaponSystem, DamageType damageType, float damageAmount, int burst, Ship* pDealtBy, Module* pModule, float delta );
 	void							DamageShield( Weapon* pWeapon, float delta, const glm::vec3& hitPosition ); // Damages the Shield.
 	void							DamageShield( WeaponSystem weaponSystem, DamageType damageType, float damageAmount, int burst, Ship* pDealtBy, float delta, const glm::vec3& hitPosition );
-	void							OnCollision( Genesis::Physics::RigidBody* pRigidBodyA, Genesis::Physics::RigidBody* pRigidBodyB, Genesis::Physics::ShapeWeakPtr pShapeA, Genesis::Physics::ShapeWeakPtr pShapeB, const glm::vec3& hitPosition );
+	void							OnCollision( Genesis::Physics::RigidBody* pRigidBodyA, Genesis::Physics::RigidBody* pRigidBodyB, Genesis::Physics::ShapeWeakPtr pShapeA, Genesis::Physics::ShapeWeakPtr pShapeB, void* pUserDataA, void* pUserDataB, const glm::vec3& hitPosition );
 
 	inline TowerModule*				GetTowerModule() const;								// Should always be valid unless we are editing the ship. Also, by design, a Ship can only have one TowerModule.
 	inline const glm::vec3&			GetTowerPosition() const;							// The Tower's world position. Use this for targetting, as this is the most important part of a ship.
-    glm::mat4x4                     GetTransform() const;
+	inline const glm::mat4x4&		GetTransform() const;								// The rigid body's world transform, as of the last UpdateTransformCache().
+
+	void							UpdateTransformCache();								// Called at the start of Ship::Update(). Only does any work if the rigid body has moved.
+	inline bool						HasCachedModuleTransform( int index ) const;
+	inline const glm::vec3&			GetCachedModuleLocalPosition( int index ) const;
+	inline const glm::vec3&			GetCachedModuleWorldPosition( int index ) const;
 
 	inline void						SetThrust( ShipThrust thrust );						// Used by Controllers to move the Ship
 	inline void						SetSteer( ShipSteer direction );					// User by Controllers to steer the Ship
@@ -203,6 +208,7 @@ public:
 
 	HyperspaceCore*					GetHyperspaceCore() const;
 	Controller*						GetController() const;
+	DamageTracker*					GetDamageTracker() const;
 
 	void							OnModuleDestroyed( Module* pModule );
 	void							OnShipDestroyed();
@@ -296,6 +302,13 @@ protected:
 
 	ModuleVector					m_Modules; // Used for collision detection purposes! Do not change type / reorder
 
+	// Transform cache. The module positions are indexed by each module's transform index, which matches
+	// its position in m_Modules. They are rebuilt whenever the rigid body is recreated.
+	glm::mat4x4						m_Transform;
+	std::vector<glm::vec3>			m_ModuleLocalPositions;
+	std::vector<glm::vec3>			m_ModuleWorldPositions;
+	bool							m_TransformCacheDirty;
+
 	glm::vec3						m_TowerPosition;
 
 	DockingState					m_DockingState;
@@ -435,6 +448,26 @@ inline const glm::vec3& Ship::GetTowerPosition() const
 	return m_TowerPosition;
 }
 
+inline const glm::mat4x4& Ship::GetTransform() const
+{
+	return m_Transform;
+}
+
+inline bool Ship::HasCachedModuleTransform( int index ) const
+{
+	return index >= 0 && index < static_cast<int>( m_ModuleWorldPositions.size() );
+}
+
+inline const glm::vec3& Ship::GetCachedModuleLocalPosition( int index ) const
+{
+	return m_ModuleLocalPositions[ index ];
+}
+
+inline const glm::vec3& Ship::GetCachedModuleWorldPosition( int index ) const
+{
+	return m_ModuleWorldPositions[ index ];
+}
+
 inline const WeaponModuleList& Ship::GetWeaponModules() const
 {
 	return m_WeaponModules; 
@@ -475,6 +508,11 @@ inline Controller* Ship::GetController() const
 	return m_pController;
 }
 
+inline DamageTracker* Ship::GetDamageTracker() const
+{
+	return m_pDamageTracker;
+}
+
 inline const ModuleVector& Ship::GetModules() const
 {
 	return m_Modules;
@@ -144,7 +144,7 @@ void Weapon::Update( float delta )
 	}
 
 	// Rotate turret to target
-	glm::mat4x4 ownerTransform = m_pOwner->GetRigidBody()->GetWorldTransform();
+	glm::mat4x4 ownerTransform = m_pOwner->GetTransform();
 	glm::vec3 ownerForward( glm::column( ownerTransform, 1 ) );
 	float ownerAngle = atan2f( ownerForward.x, ownerForward.y );
 
@@ -256,7 +256,7 @@ void Weapon::FireContinuous( float delta )
 	if ( m_pCurrentAmmo == nullptr )
 	{
 		m_pCurrentAmmo = g_pGame->GetCurrentSector()->GetAmmoManager()->Create( this );
-        m_pContinuousSFX = PlayFireSFX();
+        m_pContinuousSFX = CreateContinuousFireSFX();
 	}
 
 	// We have a maximum amount of time a continuous firing weapon can be active, so we don't have
@@ -273,7 +273,31 @@ void Weapon::FireContinuous( float delta )
 	}
 }
 
-Genesis::Sound::SoundInstanceSharedPtr Weapon::PlayFireSFX()
+// Makes the player's ship sound more important and not get drowned by other ships firing
+float Weapon::GetFireSFXMinimumDistance() const
+{
+	return ( g_pGame->GetPlayer()->GetShip() == m_pOwner ) ? 750.0f : 400.0f;
+}
+
+void Weapon::PlayFireSFX()
+{
+	using namespace Genesis;
+
+	ResourceSound* pSFX = GetInfo()->GetOnFireSFX();
+	if ( pSFX != nullptr )
+	{
+		Sound::SoundRequest request;
+		request.pResource = pSFX;
+		request.position = glm::vec3( glm::column( m_WorldTransform, 3 ) );
+		request.minimumDistance = GetFireSFXMinimumDistance();
+		request.priority = ( g_pGame->GetPlayer()->GetShip() == m_pOwner ) ? Sound::SoundPriority::High : Sound::SoundPriority::Normal;
+		FrameWork::GetSoundManager()->QueueSound( request );
+	}
+}
+
+// Continuous fire needs to stop its sound when the weapon stops firing, so it keeps the instance
+// instead of going through the voice manager.
+Genesis::Sound::SoundInstanceSharedPtr Weapon::CreateContinuousFireSFX()
 {
 	using namespace Genesis;
 
@@ -285,18 +309,8 @@ Genesis::Sound::SoundInstanceSharedPtr Weapon::PlayFireSFX()
 		{
 			const glm::vec3 position( glm::column( m_WorldTransform, 3 ) );
 			pSoundInstance->Set3DAttributes( &position );
-
-			// Makes the player's ship sound more important and not get drowned by other ships firing
-			if ( g_pGame->GetPlayer()->GetShip() == m_pOwner )
-            {
-				pSoundInstance->SetMinimumDistance( 750.0f );
-            }
-			else
-            {
-				pSoundInstance->SetMinimumDistance( 400.0f );
-            }
-
-            return pSoundInstance;
+			pSoundInstance->SetMinimumDistance( GetFireSFXMinimumDistance() );
+			return pSoundInstance;
 		}
 	}
 
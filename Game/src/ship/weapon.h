@@ -85,7 +85,9 @@ protected:
 	void					        FireSwarm( float delta );
 	void					        FireContinuous( float delta );
 
-	Genesis::Sound::SoundInstanceSharedPtr PlayFireSFX();
+	void					        PlayFireSFX();
+	Genesis::Sound::SoundInstanceSharedPtr CreateContinuousFireSFX();
+	float					        GetFireSFXMinimumDistance() const;
 	void					        SetupMuzzles();
 	void					        AddMuzzle( const glm::vec3& position );
 
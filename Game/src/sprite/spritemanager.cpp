@@ -62,9 +62,9 @@ void SpriteManager::Update( float delta )
 
 	const glm::vec3& cameraPosition = GetScene()->GetCamera()->GetPosition();
 
-	PositionData posData;
-	UVData uvData;
-	ColourData colourData;
+	FramePositionData posData( &FrameArena::Get() );
+	FrameUVData uvData( &FrameArena::Get() );
+	FrameColourData colourData( &FrameArena::Get() );
 
 	size_t numVertices = m_Sprites.size() * 6;
 	posData.reserve( numVertices );
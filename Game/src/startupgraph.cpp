@@ -0,0 +1,206 @@
+// Copyright 2026 Pedro Nunes
+//
+// This file is part of Hyperscape.
+//
+// Hyperscape is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Hyperscape is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Hyperscape. If not, see <http://www.gnu.org/licenses/>.
+
+#include "startupgraph.h"
+
+#include <SDL.h>
+#include <algorithm>
+#include <iomanip>
+#include <log.hpp>
+#include <sstream>
+#include <thread>
+
+namespace Hyperscape
+{
+
+// Most of the startup tasks are pinned to the main thread, so there's no point in having many workers.
+static const int sMaxWorkerThreads = 4;
+
+StartupGraph::StartupGraph()
+    : m_CompletedTasks( 0 )
+    , m_WorkerCount( 0 )
+    , m_TotalTime( 0.0f )
+{
+}
+
+StartupGraph::TaskId StartupGraph::Add( const std::string& name, Affinity affinity, TaskFunction function, std::initializer_list<TaskId> dependencies /* = {} */ )
+{
+    const TaskId taskId = m_Tasks.size();
+
+    Task task;
+    task.name = name;
+    task.affinity = affinity;
+    task.function = function;
+    task.pendingDependencies = dependencies.size();
+    task.thread = -1;
+    task.startTime = 0.0f;
+    task.duration = 0.0f;
+    m_Tasks.push_back( task );
+
+    for ( TaskId dependency : dependencies )
+    {
+        SDL_assert( dependency < taskId ); // Dependencies must be added before their dependents.
+        m_Tasks[ dependency ].dependents.push_back( taskId );
+    }
+
+    return taskId;
+}
+
+void StartupGraph::Run()
+{
+    m_StartTime = Clock::now();
+    m_CompletedTasks = 0;
+
+    const size_t anyThreadTasks = std::count_if( m_Tasks.begin(), m_Tasks.end(), []( const Task& task ) { return task.affinity == Affinity::AnyThread; } );
+    const int hardwareThreads = static_cast<int>( std::thread::hardware_concurrency() );
+    m_WorkerCount = std::min( { sMaxWorkerThreads, std::max( hardwareThreads - 1, 1 ), static_cast<int>( anyThreadTasks ) } );
+
+    for ( TaskId taskId = 0; taskId < m_Tasks.size(); ++taskId )
+    {
+        if ( m_Tasks[ taskId ].pendingDependencies == 0 )
+        {
+            ( m_Tasks[ taskId ].affinity == Affinity::MainThread ? m_MainThreadQueue : m_AnyThreadQueue ).push_back( taskId );
+        }
+    }
+
+    std::vector<std::thread> workers;
+    workers.reserve( m_WorkerCount );
+    for ( int i = 1; i <= m_WorkerCount; ++i )
+    {
+        workers.emplace_back( &StartupGraph::WorkerThreadMain, this, i );
+    }
+
+    // The main thread runs its own tasks first, but it will also pick up tasks from the shared
+    // queue rather than sit idle while it waits for the workers to unblock its next task.
+    while ( true )
+    {
+        TaskId taskId;
+        {
+            std::unique_lock<std::mutex> lock( m_Mutex );
+            m_Condition.wait( lock, [ this ] { return m_CompletedTasks == m_Tasks.size() || m_MainThreadQueue.empty() == false || m_AnyThreadQueue.empty() == false; } );
+            if ( TryPopTask( 0, taskId ) == false )
+            {
+                break;
+            }
+        }
+        Execute( 0, taskId );
+    }
+
+    for ( std::thread& worker : workers )
+    {
+        worker.join();
+    }
+
+    m_TotalTime = std::chrono::duration<float, std::milli>( Clock::now() - m_StartTime ).count();
+}
+
+void StartupGraph::WorkerThreadMain( int thread )
+{
+    while ( true )
+    {
+        TaskId taskId;
+        {
+            std::unique_lock<std::mutex> lock( m_Mutex );
+            m_Condition.wait( lock, [ this ] { return m_CompletedTasks == m_Tasks.size() || m_AnyThreadQueue.empty() == false; } );
+            if ( TryPopTask( thread, taskId ) == false )
+            {
+                return;
+            }
+        }
+        Execute( thread, taskId );
+    }
+}
+
+// Must be called with m_Mutex locked. Returns false once there is nothing left to do.
+bool StartupGraph::TryPopTask( int thread, TaskId& taskId )
+{
+    if ( thread == 0 && m_MainThreadQueue.empty() == false )
+    {
+        taskId = m_MainThreadQueue.front();
+        m_MainThreadQueue.pop_front();
+        return true;
+    }
+    else if ( m_AnyThreadQueue.empty() == false )
+    {
+        taskId = m_AnyThreadQueue.front();
+        m_AnyThreadQueue.pop_front();
+        return true;
+    }
+    else
+    {
+        return false;
+    }
+}
+
+void StartupGraph::Execute( int thread, TaskId taskId )
+{
+    Task& task = m_Tasks[ taskId ];
+    const Clock::time_point startTime = Clock::now();
+    task.function();
+    const Clock::time_point endTime = Clock::now();
+
+    std::lock_guard<std::mutex> lock( m_Mutex );
+    task.thread = thread;
+    task.startTime = std::chrono::duration<float, std::milli>( startTime - m_StartTime ).count();
+    task.duration = std::chrono::duration<float, std::milli>( endTime - startTime ).count();
+
+    for ( TaskId dependent : task.dependents )
+    {
+        Task& dependentTask = m_Tasks[ dependent ];
+        SDL_assert( dependentTask.pendingDependencies > 0 );
+        if ( --dependentTask.pendingDependencies == 0 )
+        {
+            ( dependentTask.affinity == Affinity::MainThread ? m_MainThreadQueue : m_AnyThreadQueue ).push_back( dependent );
+        }
+    }
+
+    m_CompletedTasks++;
+    m_Condition.notify_all();
+}
+
+void StartupGraph::LogTimings() const
+{
+    std::vector<const Task*> tasks;
+    tasks.reserve( m_Tasks.size() );
+    float serialTime = 0.0f;
+    for ( const Task& task : m_Tasks )
+    {
+        tasks.push_back( &task );
+        serialTime += task.duration;
+    }
+    std::sort( tasks.begin(), tasks.end(), []( const Task* pA, const Task* pB ) { return pA->duration > pB->duration; } );
+
+    std::stringstream summary;
+    summary << std::fixed << std::setprecision( 1 ) << "Startup took " << m_TotalTime << "ms (" << serialTime << "ms of work, " << m_WorkerCount << " worker threads):";
+    Genesis::Log::Info() << summary.str();
+    for ( const Task* pTask : tasks )
+    {
+        std::stringstream ss;
+        ss << std::fixed << std::setprecision( 1 ) << "    " << std::left << std::setw( 24 ) << pTask->name << std::right << std::setw( 8 ) << pTask->duration << "ms, started at " << pTask->startTime << "ms on ";
+        if ( pTask->thread == 0 )
+        {
+            ss << "main thread";
+        }
+        else
+        {
+            ss << "worker " << pTask->thread;
+        }
+        Genesis::Log::Info() << ss.str();
+    }
+}
+
+} // namespace Hyperscape
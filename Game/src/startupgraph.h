@@ -0,0 +1,95 @@
+// Copyright 2026 Pedro Nunes
+//
+// This file is part of Hyperscape.
+//
+// Hyperscape is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Hyperscape is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Hyperscape. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <initializer_list>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace Hyperscape
+{
+
+///////////////////////////////////////////////////////////////////////////////
+// StartupGraph
+// Runs the game's initialisation steps as a graph of tasks with declared
+// dependencies. Tasks which can run on any thread are spread across a small
+// pool of worker threads, while tasks pinned to the main thread (anything
+// touching the GL context or other main thread only systems) run on the
+// thread which calls Run(). A task only starts once all its dependencies have
+// finished, and dependencies must be added before their dependents, so the
+// graph can't contain cycles.
+///////////////////////////////////////////////////////////////////////////////
+
+class StartupGraph
+{
+public:
+    enum class Affinity
+    {
+        MainThread,
+        AnyThread
+    };
+
+    using TaskId = size_t;
+    using TaskFunction = std::function<void()>;
+
+    StartupGraph();
+
+    TaskId Add( const std::string& name, Affinity affinity, TaskFunction function, std::initializer_list<TaskId> dependencies = {} );
+
+    // Runs every task, returning once they have all finished. Must be called from the main thread.
+    void Run();
+
+    // Logs how long each task took and which thread it ran on.
+    void LogTimings() const;
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Task
+    {
+        std::string name;
+        Affinity affinity;
+        TaskFunction function;
+        std::vector<TaskId> dependents;
+        size_t pendingDependencies;
+        int thread; // 0 is the main thread, workers start at 1.
+        float startTime; // In milliseconds since the start of Run().
+        float duration;
+    };
+
+    void WorkerThreadMain( int thread );
+    bool TryPopTask( int thread, TaskId& taskId );
+    void Execute( int thread, TaskId taskId );
+
+    std::vector<Task> m_Tasks;
+    std::deque<TaskId> m_MainThreadQueue;
+    std::deque<TaskId> m_AnyThreadQueue;
+    size_t m_CompletedTasks;
+    int m_WorkerCount;
+    float m_TotalTime;
+    Clock::time_point m_StartTime;
+    std::mutex m_Mutex;
+    std::condition_variable m_Condition;
+};
+
+} // namespace Hyperscape
@@ -24,6 +24,7 @@
 // clang-format on
 
 #include "system/astronomicalobject/orbit.hpp"
+#include "system/blackbody.hpp"
 #include "ui2/ui2.hpp"
 
 namespace Hyperscape
@@ -84,30 +85,22 @@ const glm::vec2& AstronomicalObject::GetSignalCoordinates() const
 
 void AstronomicalObject::AddBlackBodySignal(double temperature) 
 {
-    // Calculate the spectral radiance assuming the astronomical object is a black body, using Planck's law.
-    // https://www.fxsolver.com/browse/formulas/Planck's+law+(+by+wavelength)
-    Wavelength onenm = 1.0_nm;
-    static const double h = 6.62607015 * pow(10.0, -34.0); // Planck's constant.
-    static const double c = 299792458.0; // Speed of light.
-    static const double e = 2.71828182845904523536;
-    static const double kb = 1.3806488 * pow(10, -23.0); // Boltzmann constant.
-    static const double unitConversion = pow(10.0, -12.0); // From watt per steradian per square metre per metre to kilowatt per steradian per square metre per nanometre.
-
+    // The spectral radiance assumes the astronomical object is a black body, using Planck's law.
+    // Spectra are shared between all objects with the same temperature, so each object only applies its own noise.
+    BlackBody::SpectrumSharedPtr pSpectrum = BlackBody::Get(temperature);
+    const BlackBody::Spectrum& spectrum = *pSpectrum;
+    std::uniform_real_distribution<float> dist(0.9f, 1.1f);
     for (size_t i = 0; i < m_SignalData.sNumEntries; i++)
     {
-        const double wavelength = m_SignalData.Wavelengths[i];
-        if (wavelength > 0.0)
+        const double noise = dist(m_RandomEngine);
+        if (m_SignalData.Wavelengths[i] > 0.0)
         {
-            const double radiance = (2.0 * h * c * c) / pow(wavelength, 5.0) / (pow(e, (h * c) / (wavelength * kb * temperature)) - 1.0) * unitConversion;
-            m_SignalData.Intensities[i] = radiance;
+            m_SignalData.Intensities[i] = spectrum[i] * noise;
+        }
+        else
+        {
+            m_SignalData.Intensities[i] *= noise;
         }
-    }
-
-    // Add some noise to the signal.
-    std::uniform_real_distribution<float> dist(0.9f, 1.1f);
-    for (size_t i = 0; i < m_SignalData.sNumEntries; i++)
-    {
-        m_SignalData.Intensities[i] *= dist(m_RandomEngine);
     }
 }
 
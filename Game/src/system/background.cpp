@@ -18,7 +18,6 @@
 #include "system/background.hpp"
 
 #include "game.hpp"
-#include "misc/random.h"
 #include "player.h"
 
 #include <algorithm>
@@ -40,7 +39,7 @@ namespace Hyperscape
 // Background
 ///////////////////////////////////////////////////////////////////////////////
 
-Background::Background( const std::string& seed )
+Background::Background( const std::string& image, bool anchoredBottomLeft )
     : m_pShader( nullptr )
     , m_AmbientColour( 1.0 )
     , m_Size( 512.0f )
@@ -53,7 +52,7 @@ Background::Background( const std::string& seed )
 
     ResourceManager* pResourceManager = FrameWork::GetResourceManager();
     m_pShader = pResourceManager->GetResource<ResourceShader*>( "data/shaders/sectorbackground.glsl" );
-    ResourceImage* pBackground = pResourceManager->GetResource<ResourceImage*>( "data/backgrounds/background1.jpg" );
+    ResourceImage* pBackground = pResourceManager->GetResource<ResourceImage*>( image );
     const glm::vec2 screenSize( static_cast<float>( Configuration::GetScreenWidth() ), static_cast<float>( Configuration::GetScreenHeight() ) );
     const glm::vec2 imageSize( static_cast<float>( pBackground->GetWidth() ), static_cast<float>( pBackground->GetHeight() ) );
     m_Size = glm::max( glm::max( screenSize.x, screenSize.y ), glm::max( imageSize.x, imageSize.y ) );
@@ -62,7 +61,7 @@ Background::Background( const std::string& seed )
     pBackgroundSampler->Set( pBackground, GL_TEXTURE0 );
 
     CreateGeometry();
-    SetupCameraAnchors();
+    SetupCameraAnchors( anchoredBottomLeft );
     CalculateCameraOffsets();
 }
 
@@ -77,10 +76,10 @@ void Background::CreateGeometry()
     m_pVertexBuffer->CreateTexturedQuad( 0.0f, 0.0f, m_Size, m_Size );
 }
 
-void Background::SetupCameraAnchors()
+void Background::SetupCameraAnchors( bool anchoredBottomLeft )
 {
     // The primary anchor is always bottom left or top right, while the secondary anchor is diagonally opposite.
-    m_PrimaryCameraAnchor = ( Random::Next() % 2 == 0 ) ? Anchor::BottomLeft : Anchor::TopLeft;
+    m_PrimaryCameraAnchor = anchoredBottomLeft ? Anchor::BottomLeft : Anchor::TopLeft;
     m_SecondaryCameraAnchor = ( m_PrimaryCameraAnchor == Anchor::BottomLeft ) ? Anchor::TopRight : Anchor::BottomRight;
 }
 
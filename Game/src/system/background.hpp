@@ -35,7 +35,7 @@ namespace Hyperscape
 class Background : public Genesis::SceneObject
 {
 public:
-    Background(const std::string& seed);
+    Background(const std::string& image, bool anchoredBottomLeft);
     virtual ~Background() override;
     virtual void Update(float delta) override;
     virtual void Render( const Genesis::SceneCameraSharedPtr& pCamera ) override;
@@ -52,7 +52,7 @@ private:
     };
 
     void CreateGeometry();
-    void SetupCameraAnchors();
+    void SetupCameraAnchors(bool anchoredBottomLeft);
     void CalculateCameraOffsets();
     glm::mat4x4 AnchorToOffset( const Anchor& anchor ) const;
 
@@ -0,0 +1,272 @@
+// Copyright 2026 Pedro Nunes
+//
+// This file is part of Hyperscape.
+//
+// Hyperscape is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Hyperscape is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Hyperscape. If not, see <http://www.gnu.org/licenses/>.
+
+#include "system/blackbody.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+// SSE2 is part of x64, so this only falls back to the scalar path on other architectures.
+#if defined(__SSE2__) || defined(_M_X64)
+#define BLACKBODY_SSE2 1
+#include <emmintrin.h>
+#else
+#define BLACKBODY_SSE2 0
+#endif
+
+namespace Hyperscape
+{
+
+const double BlackBody::sTemperatureQuantum = 1.0;
+
+// Once full, the cache is cleared rather than growing unbounded. Spectra already handed out remain valid.
+static const size_t sMaxCachedSpectra = 256;
+
+// Radiances below this are many orders of magnitude below anything which can be seen on the spectrograph.
+static const double sNegligibleRadiance = 1.0e-250;
+
+// Above this exp() would overflow, and the radiance is 0 for all intents and purposes.
+static const double sMaxExponent = 709.0;
+
+static const double h = 6.62607015e-34; // Planck's constant.
+static const double c = 299792458.0; // Speed of light.
+static const double kb = 1.3806488e-23; // Boltzmann constant.
+static const double unitConversion = 1.0e-12; // From watt per steradian per square metre per metre to kilowatt per steradian per square metre per nanometre.
+
+std::mutex BlackBody::m_CacheMutex;
+std::unordered_map<long, BlackBody::SpectrumSharedPtr> BlackBody::m_Cache;
+
+// exp(x) - 1 for 0 <= x <= sMaxExponent.
+// x is split into k * ln(2) + r, with |r| <= ln(2) / 2, so exp(x) - 1 = 2^k * (exp(r) - 1) + (2^k - 1).
+// exp(r) - 1 is a Taylor polynomial which is accurate to a double's precision in that range, and unlike
+// exp(x) - 1 it doesn't lose precision to cancellation for the very long wavelengths where x is tiny.
+// k is rounded by adding 1.5 * 2^52, which leaves no fractional bits in the mantissa: the addition
+// itself rounds, and the integer ends up in the lowest bits of the mantissa. As 0 <= k <= 1023, shifting
+// those bits into the exponent builds 2^k directly. Unlike std::floor this needs neither SSE4.1 nor a call.
+static const double sLn2 = 0.6931471805599453;
+static const double sInvLn2 = 1.4426950408889634;
+static const double sRoundingMagic = 6755399441055744.0;
+
+// 1/12! down to 1/1!, for Horner's method.
+static const double sTaylorCoefficients[] = {
+    1.0 / 479001600.0,
+    1.0 / 39916800.0,
+    1.0 / 3628800.0,
+    1.0 / 362880.0,
+    1.0 / 40320.0,
+    1.0 / 5040.0,
+    1.0 / 720.0,
+    1.0 / 120.0,
+    1.0 / 24.0,
+    1.0 / 6.0,
+    1.0 / 2.0,
+    1.0
+};
+
+#if BLACKBODY_SSE2
+
+static inline __m128d ExpMinusOne(__m128d x)
+{
+    const __m128d roundingMagic = _mm_set1_pd(sRoundingMagic);
+    const __m128d shifted = _mm_add_pd(_mm_mul_pd(x, _mm_set1_pd(sInvLn2)), roundingMagic);
+    const __m128d k = _mm_sub_pd(shifted, roundingMagic);
+    const __m128d r = _mm_sub_pd(x, _mm_mul_pd(k, _mm_set1_pd(sLn2)));
+
+    __m128d p = _mm_setzero_pd();
+    for (double coefficient : sTaylorCoefficients)
+    {
+        p = _mm_add_pd(_mm_mul_pd(p, r), _mm_set1_pd(coefficient));
+    }
+    const __m128d expMinusOneR = _mm_mul_pd(p, r);
+
+    const __m128i bits = _mm_slli_epi64(_mm_add_epi64(_mm_castpd_si128(shifted), _mm_set1_epi64x(1023)), 52);
+    const __m128d twoToK = _mm_castsi128_pd(bits);
+
+    return _mm_add_pd(_mm_mul_pd(twoToK, expMinusOneR), _mm_sub_pd(twoToK, _mm_set1_pd(1.0)));
+}
+
+#else
+
+static inline double ExpMinusOne(double x)
+{
+    const double shifted = x * sInvLn2 + sRoundingMagic;
+    const double k = shifted - sRoundingMagic;
+    const double r = x - k * sLn2;
+
+    double p = 0.0;
+    for (double coefficient : sTaylorCoefficients)
+    {
+        p = p * r + coefficient;
+    }
+    const double expMinusOneR = p * r;
+
+    uint64_t bits;
+    memcpy(&bits, &shifted, sizeof(double));
+    bits = (bits + 1023) << 52;
+    double twoToK;
+    memcpy(&twoToK, &bits, sizeof(double));
+
+    return twoToK * expMinusOneR + (twoToK - 1.0);
+}
+
+#endif
+
+BlackBody::Constants::Constants()
+{
+    const SignalData signalData;
+    for (size_t i = 0; i < SignalData::sNumEntries; i++)
+    {
+        const double wavelength = signalData.Wavelengths[i];
+        if (wavelength > 0.0)
+        {
+            a[i] = (2.0 * h * c * c) / std::pow(wavelength, 5.0) * unitConversion;
+            b[i] = (h * c) / (wavelength * kb);
+        }
+        else
+        {
+            a[i] = 0.0;
+            b[i] = 0.0;
+        }
+    }
+}
+
+const BlackBody::Constants& BlackBody::GetConstants()
+{
+    static const Constants constants;
+    return constants;
+}
+
+BlackBody::SpectrumSharedPtr BlackBody::Get(double temperatureKelvin)
+{
+    const long key = std::lround(temperatureKelvin / sTemperatureQuantum);
+
+    {
+        std::lock_guard<std::mutex> lock(m_CacheMutex);
+        auto it = m_Cache.find(key);
+        if (it != m_Cache.end())
+        {
+            return it->second;
+        }
+    }
+
+    // Evaluated outside the lock, as it is the expensive part. If two threads race for
+    // the same temperature, both spectra are identical and either can end up cached.
+    std::shared_ptr<Spectrum> pSpectrum = std::make_shared<Spectrum>();
+    Evaluate(static_cast<double>(key) * sTemperatureQuantum, *pSpectrum);
+
+    std::lock_guard<std::mutex> lock(m_CacheMutex);
+    if (m_Cache.size() >= sMaxCachedSpectra)
+    {
+        m_Cache.clear();
+    }
+    m_Cache[key] = pSpectrum;
+    return pSpectrum;
+}
+
+void BlackBody::Evaluate(double temperatureKelvin, Spectrum& spectrum)
+{
+    const Constants& constants = GetConstants();
+    const double* pA = constants.a.data();
+    const double* pB = constants.b.data();
+    double* pResult = spectrum.data();
+    const double invTemperature = 1.0 / temperatureKelvin;
+
+    // Entries without a wavelength have a == 0, and would otherwise be 0 / 0.
+#if BLACKBODY_SSE2
+    static_assert(SignalData::sNumEntries % 2 == 0, "Evaluate() processes two entries at a time.");
+    const __m128d invTemperature2 = _mm_set1_pd(invTemperature);
+    const __m128d maxExponent = _mm_set1_pd(sMaxExponent);
+    for (size_t i = 0; i < SignalData::sNumEntries; i += 2)
+    {
+        const __m128d a = _mm_loadu_pd(pA + i);
+        const __m128d x = _mm_mul_pd(_mm_loadu_pd(pB + i), invTemperature2);
+        const __m128d radiance = _mm_div_pd(a, ExpMinusOne(_mm_min_pd(x, maxExponent)));
+        const __m128d valid = _mm_and_pd(_mm_cmple_pd(x, maxExponent), _mm_cmpneq_pd(a, _mm_setzero_pd()));
+        _mm_storeu_pd(pResult + i, _mm_and_pd(valid, radiance));
+    }
+#else
+    for (size_t i = 0; i < SignalData::sNumEntries; i++)
+    {
+        const double x = pB[i] * invTemperature;
+        const double radiance = pA[i] / ExpMinusOne(std::min(x, sMaxExponent));
+        pResult[i] = (x > sMaxExponent || pA[i] == 0.0) ? 0.0 : radiance;
+    }
+#endif
+}
+
+void BlackBody::EvaluateReference(double temperatureKelvin, Spectrum& spectrum)
+{
+    const SignalData signalData;
+    for (size_t i = 0; i < SignalData::sNumEntries; i++)
+    {
+        const double wavelength = signalData.Wavelengths[i];
+        if (wavelength > 0.0)
+        {
+            spectrum[i] = (2.0 * h * c * c) / std::pow(wavelength, 5.0) / std::expm1((h * c) / (wavelength * kb * temperatureKelvin)) * unitConversion;
+        }
+        else
+        {
+            spectrum[i] = 0.0;
+        }
+    }
+}
+
+double BlackBody::GetMaximumRelativeError(double temperatureKelvin)
+{
+    Spectrum spectrum;
+    Spectrum reference;
+    Evaluate(temperatureKelvin, spectrum);
+    EvaluateReference(temperatureKelvin, reference);
+
+    double maximumError = 0.0;
+    for (size_t i = 0; i < SignalData::sNumEntries; i++)
+    {
+        if (reference[i] > sNegligibleRadiance)
+        {
+            maximumError = std::max(maximumError, std::abs(spectrum[i] - reference[i]) / reference[i]);
+        }
+        else if (spectrum[i] > sNegligibleRadiance)
+        {
+            maximumError = std::max(maximumError, 1.0);
+        }
+    }
+    return maximumError;
+}
+
+void BlackBody::Accumulate(const double* const* pSpectra, const double* pScales, size_t spectrumCount, double* pResult)
+{
+    static const size_t sBlockSize = 128;
+
+    std::fill_n(pResult, SignalData::sNumEntries, 0.0);
+    for (size_t blockStart = 0; blockStart < SignalData::sNumEntries; blockStart += sBlockSize)
+    {
+        const size_t blockEnd = std::min(blockStart + sBlockSize, SignalData::sNumEntries);
+        for (size_t j = 0; j < spectrumCount; j++)
+        {
+            const double* pSpectrum = pSpectra[j];
+            const double scale = pScales[j];
+            for (size_t i = blockStart; i < blockEnd; i++)
+            {
+                pResult[i] += pSpectrum[i] * scale;
+            }
+        }
+    }
+}
+
+} // namespace Hyperscape
@@ -0,0 +1,82 @@
+// Copyright 2026 Pedro Nunes
+//
+// This file is part of Hyperscape.
+//
+// Hyperscape is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Hyperscape is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Hyperscape. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <array>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#include "system/signaldata.hpp"
+
+namespace Hyperscape
+{
+
+///////////////////////////////////////////////////////////////////////////////
+// BlackBody
+// Synthesises black body spectra on SignalData's wavelength grid.
+// Every SignalData uses the same grid, so the wavelength dependent terms of
+// Planck's law are only calculated once. The remaining exponential is
+// evaluated with a branchless polynomial, two entries at a time with SSE2,
+// rather than calling pow() for every entry.
+// Spectra are cached by temperature (quantised to sTemperatureQuantum), so
+// objects sharing a temperature share the spectrum. Access is thread safe.
+///////////////////////////////////////////////////////////////////////////////
+
+class BlackBody
+{
+public:
+    using Spectrum = std::array<double, SignalData::sNumEntries>;
+    using SpectrumSharedPtr = std::shared_ptr<const Spectrum>;
+
+    // Spectral radiance in kilowatt per steradian per square metre per nanometre.
+    // Entries which don't have a wavelength in SignalData are 0.
+    static SpectrumSharedPtr Get(double temperatureKelvin);
+
+    // Uncached evaluation, used by Get().
+    static void Evaluate(double temperatureKelvin, Spectrum& spectrum);
+
+    // Straightforward scalar evaluation of Planck's law, used as the reference for Evaluate()'s accuracy.
+    static void EvaluateReference(double temperatureKelvin, Spectrum& spectrum);
+
+    // Largest relative error of Evaluate() against EvaluateReference(), ignoring radiances too small to matter.
+    static double GetMaximumRelativeError(double temperatureKelvin);
+
+    // result[i] = sum of pSpectra[j][i] * pScales[j]. The spectra are summed in blocks which fit
+    // in the cache, rather than walking the whole result once per spectrum.
+    static void Accumulate(const double* const* pSpectra, const double* pScales, size_t spectrumCount, double* pResult);
+
+    static const double sTemperatureQuantum;
+
+private:
+    struct Constants
+    {
+        Constants();
+
+        // Planck's law as radiance = a / (exp(b / temperature) - 1).
+        Spectrum a;
+        Spectrum b;
+    };
+
+    static const Constants& GetConstants();
+
+    static std::mutex m_CacheMutex;
+    static std::unordered_map<long, SpectrumSharedPtr> m_Cache;
+};
+
+} // namespace Hyperscape
@@ -19,35 +19,31 @@
 
 #include "system/system.hpp"
 
-// clang-format off
-#include <externalheadersbegin.hpp>
-#include <xxhash64.h>
-#include <externalheadersend.hpp>
-// clang-format on
-
 #include <scene/scene.h>
 #include <genesis.h>
 
 #include "sector/sectorinfo.h"
 #include "sector/sector.h"
-#include "system/astronomicalobject/orbit.hpp"
-#include "system/astronomicalobject/planet.hpp"
-#include "system/astronomicalobject/star.hpp"
 #include "system/background.hpp"
-#include "system/wormhole.hpp"
+#include "system/systemgenerator.hpp"
 
 namespace Hyperscape
 {
 
 System::System(const std::string& seed, bool demoMode /* = false*/)
-    : m_Seed(seed)
+    : System(SystemGenerator::Generate(seed), demoMode)
+{
+}
+
+System::System(SystemContentsUniquePtr pContents, bool demoMode /* = false*/)
+    : m_Seed(pContents->seed)
     , m_DemoMode(demoMode)
+    , m_RandomEngine(pContents->randomEngine)
+    , m_AstronomicalObjects(std::move(pContents->astronomicalObjects))
+    , m_SignalSources(std::move(pContents->signalSources))
 {
-    InitializeRandomEngine();
     InitializeLayers();
-    InitializeBackground();
-    GenerateAstronomicalObjects();
-    GenerateWormholes();
+    InitializeBackground(*pContents);
 }
    
 System::~System()
@@ -104,12 +100,6 @@ Sector* System::GetCurrentSector()
     return m_pCurrentSector.get();
 }
 
-void System::InitializeRandomEngine() 
-{
-    uint64_t seedHash = XXHash64::hash(m_Seed.data(), m_Seed.length(), 0);
-    m_RandomEngine = SystemRandomEngine(seedHash);
-}
-
 void System::InitializeLayers()
 {
     Genesis::SceneSharedPtr pScene = Genesis::FrameWork::GetScene();
@@ -122,102 +112,12 @@ void System::InitializeLayers()
     m_Layers[static_cast<size_t>(LayerId::Debug)] = pScene->AddLayer(7);
 }
 
-void System::InitializeBackground() 
+void System::InitializeBackground(const SystemContents& contents) 
 {
-    m_pBackground = std::make_unique<Background>(m_Seed);
+    m_pBackground = std::make_unique<Background>(contents.backgroundImage, contents.backgroundAnchoredBottomLeft);
     GetLayer(LayerId::Background)->AddSceneObject(m_pBackground.get(), false);
 }
 
-void System::GenerateAstronomicalObjects() 
-{
-    StarSharedPtr pStar = std::make_shared<Star>(GetRandomEngine(), glm::vec2(0.0f, 0.0f));
-    m_AstronomicalObjects.push_back(std::move(pStar));
-
-    std::uniform_real_distribution<float> orbitDistribution(0.0f, 360.0f);
-    int planetCount = GeneratePlanetCount();
-    std::vector<float> planetDistances = GeneratePlanetDistances(planetCount);
-
-    for (int i = 0; i < planetCount; ++i)
-    {
-        OrbitUniquePtr pOrbit = std::make_unique<Orbit>(planetDistances[i], GenerateEccentricity());
-        PlanetSharedPtr pPlanet = std::make_shared<Planet>(GetRandomEngine(), std::move(pOrbit), orbitDistribution(GetRandomEngine()));
-        m_AstronomicalObjects.push_back(std::move(pPlanet));
-    }
-
-    for (AstronomicalObjectSharedPtr pObj : m_AstronomicalObjects)
-    {
-        m_SignalSources.push_back(pObj);
-    }
-}
-
-// In the solar system, all planets have an eccentricity between 0.006 (Venus) and 0.248 (Pluto).
-// We generate eccentricity values between [0-0.25], but greatly weight the results towards the lower end.
-float System::GenerateEccentricity() 
-{
-    std::uniform_real_distribution<float> eccentricityDistribution(0.0f, 1.0);
-    const float v = eccentricityDistribution(GetRandomEngine());
-    const float fv = glm::clamp(-log10(-v+1.0f)/2.0f, 0.0f, 1.0f) * 0.25f;
-    return fv;
-}
-
-int System::GeneratePlanetCount() 
-{
-    // Completely artificial set of values as we currently don't have enough data to generate a good table.
-    // See https://en.wikipedia.org/wiki/List_of_multiplanetary_systems
-    // Either way, we do want most systems to have some planets.
-    const std::array<int, 9> count = { 100, 500, 700, 1000, 300, 200, 100, 50, 10 };
-    int accum = 0;
-    for (int i = 0; i < count.size(); ++i)
-    {
-        accum += count[i];
-    }
-
-    std::uniform_int_distribution<int> planetDistribution(0, accum);
-    const int v = planetDistribution(GetRandomEngine());
-    accum = 0;
-    for (int i = 0; i < count.size(); ++i)
-    {
-        accum += count[i];
-        if (v <= accum)
-        {
-            return i;
-        }
-    }
-    return 0;
-}
-
-std::vector<float> System::GeneratePlanetDistances(int planetCount) 
-{
-    std::vector<float> distances;
-    distances.reserve(planetCount);
-
-    std::uniform_real_distribution<float> distanceDistribution(0.2f, 0.6f);
-    float accumulatedDistance = 0.0f;
-    for (int i = 0; i < planetCount; ++i)
-    {
-        accumulatedDistance += distanceDistribution(GetRandomEngine());
-        distances.push_back(accumulatedDistance);
-    }
-
-    return distances;
-}
-
-void System::GenerateWormholes() 
-{
-    std::uniform_int_distribution<int> countDistribution(2, 4);
-    std::uniform_real_distribution<float> distanceDistribution(0.3f, 0.6 * m_AstronomicalObjects.size());
-    std::uniform_real_distribution<float> angleDistribution(-M_PI, M_PI);
-    int numWormholes = countDistribution(GetRandomEngine());
-    for (int i = 0; i < numWormholes; ++i)
-    {
-        const float distance = distanceDistribution(GetRandomEngine());
-        const float angle = angleDistribution(GetRandomEngine());
-        const glm::vec2 coordinates(glm::cos(angle) * distance, glm::sin(angle) * distance);
-        SignalSourceSharedPtr pWormhole = std::make_shared<Wormhole>(GetRandomEngine(), coordinates, 1);
-        m_SignalSources.push_back(std::move(pWormhole));
-    }
-}
-
 Genesis::Layer* System::GetLayer(LayerId id) const
 {
     return m_Layers[static_cast<size_t>(id)].get();
@@ -58,10 +58,14 @@ enum class LayerId
     Count
 };
 
+struct SystemContents;
+using SystemContentsUniquePtr = std::unique_ptr<SystemContents>;
+
 class System
 {
 public:
 	System(const std::string& seed, bool demoMode = false);
+    System(SystemContentsUniquePtr pContents, bool demoMode = false); // From contents generated in advance, see SystemPrefetcher.
 	~System();
 
     void Update(float delta);
@@ -78,14 +82,8 @@ public:
     Genesis::Layer* GetLayer(LayerId id) const;
 
 private:  
-    void InitializeRandomEngine();
     void InitializeLayers();
-    void InitializeBackground();
-    void GenerateAstronomicalObjects();
-    float GenerateEccentricity();
-    int GeneratePlanetCount();
-    std::vector<float> GeneratePlanetDistances(int planetCount);
-    void GenerateWormholes();
+    void InitializeBackground(const SystemContents& contents);
 
 	std::string m_Seed;
     bool m_DemoMode;
@@ -0,0 +1,151 @@
+// Copyright 2026 Pedro Nunes
+//
+// This file is part of Hyperscape.
+//
+// Hyperscape is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Hyperscape is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Hyperscape. If not, see <http://www.gnu.org/licenses/>.
+
+#include "system/systemgenerator.hpp"
+
+// clang-format off
+#include <externalheadersbegin.hpp>
+#include <xxhash64.h>
+#include <externalheadersend.hpp>
+// clang-format on
+
+#include <glm/common.hpp>
+#include <glm/trigonometric.hpp>
+
+#include "system/astronomicalobject/orbit.hpp"
+#include "system/astronomicalobject/planet.hpp"
+#include "system/astronomicalobject/star.hpp"
+#include "system/wormhole.hpp"
+
+namespace Hyperscape
+{
+
+SystemContentsUniquePtr SystemGenerator::Generate(const std::string& seed)
+{
+    SystemContentsUniquePtr pContents = std::make_unique<SystemContents>();
+    pContents->seed = seed;
+
+    uint64_t seedHash = XXHash64::hash(seed.data(), seed.length(), 0);
+    pContents->randomEngine = SystemRandomEngine(seedHash);
+
+    GenerateAstronomicalObjects(*pContents);
+    GenerateWormholes(*pContents);
+    GenerateBackground(*pContents);
+    return pContents;
+}
+
+void SystemGenerator::GenerateAstronomicalObjects(SystemContents& contents)
+{
+    SystemRandomEngine& randomEngine = contents.randomEngine;
+    StarSharedPtr pStar = std::make_shared<Star>(randomEngine, glm::vec2(0.0f, 0.0f));
+    contents.astronomicalObjects.push_back(std::move(pStar));
+
+    std::uniform_real_distribution<float> orbitDistribution(0.0f, 360.0f);
+    int planetCount = GeneratePlanetCount(randomEngine);
+    std::vector<float> planetDistances = GeneratePlanetDistances(randomEngine, planetCount);
+
+    for (int i = 0; i < planetCount; ++i)
+    {
+        OrbitUniquePtr pOrbit = std::make_unique<Orbit>(planetDistances[i], GenerateEccentricity(randomEngine));
+        PlanetSharedPtr pPlanet = std::make_shared<Planet>(randomEngine, std::move(pOrbit), orbitDistribution(randomEngine));
+        contents.astronomicalObjects.push_back(std::move(pPlanet));
+    }
+
+    for (AstronomicalObjectSharedPtr pObj : contents.astronomicalObjects)
+    {
+        contents.signalSources.push_back(pObj);
+    }
+}
+
+// In the solar system, all planets have an eccentricity between 0.006 (Venus) and 0.248 (Pluto).
+// We generate eccentricity values between [0-0.25], but greatly weight the results towards the lower end.
+float SystemGenerator::GenerateEccentricity(SystemRandomEngine& randomEngine)
+{
+    std::uniform_real_distribution<float> eccentricityDistribution(0.0f, 1.0);
+    const float v = eccentricityDistribution(randomEngine);
+    const float fv = glm::clamp(-log10(-v+1.0f)/2.0f, 0.0f, 1.0f) * 0.25f;
+    return fv;
+}
+
+int SystemGenerator::GeneratePlanetCount(SystemRandomEngine& randomEngine)
+{
+    // Completely artificial set of values as we currently don't have enough data to generate a good table.
+    // See https://en.wikipedia.org/wiki/List_of_multiplanetary_systems
+    // Either way, we do want most systems to have some planets.
+    const std::array<int, 9> count = { 100, 500, 700, 1000, 300, 200, 100, 50, 10 };
+    int accum = 0;
+    for (int i = 0; i < count.size(); ++i)
+    {
+        accum += count[i];
+    }
+
+    std::uniform_int_distribution<int> planetDistribution(0, accum);
+    const int v = planetDistribution(randomEngine);
+    accum = 0;
+    for (int i = 0; i < count.size(); ++i)
+    {
+        accum += count[i];
+        if (v <= accum)
+        {
+            return i;
+        }
+    }
+    return 0;
+}
+
+std::vector<float> SystemGenerator::GeneratePlanetDistances(SystemRandomEngine& randomEngine, int planetCount)
+{
+    std::vector<float> distances;
+    distances.reserve(planetCount);
+
+    std::uniform_real_distribution<float> distanceDistribution(0.2f, 0.6f);
+    float accumulatedDistance = 0.0f;
+    for (int i = 0; i < planetCount; ++i)
+    {
+        accumulatedDistance += distanceDistribution(randomEngine);
+        distances.push_back(accumulatedDistance);
+    }
+
+    return distances;
+}
+
+void SystemGenerator::GenerateWormholes(SystemContents& contents)
+{
+    SystemRandomEngine& randomEngine = contents.randomEngine;
+    std::uniform_int_distribution<int> countDistribution(2, 4);
+    std::uniform_real_distribution<float> distanceDistribution(0.3f, 0.6 * contents.astronomicalObjects.size());
+    std::uniform_real_distribution<float> angleDistribution(-M_PI, M_PI);
+    int numWormholes = countDistribution(randomEngine);
+    for (int i = 0; i < numWormholes; ++i)
+    {
+        const float distance = distanceDistribution(randomEngine);
+        const float angle = angleDistribution(randomEngine);
+        const glm::vec2 coordinates(glm::cos(angle) * distance, glm::sin(angle) * distance);
+        SignalSourceSharedPtr pWormhole = std::make_shared<Wormhole>(randomEngine, coordinates, 1);
+        contents.signalSources.push_back(std::move(pWormhole));
+    }
+}
+
+void SystemGenerator::GenerateBackground(SystemContents& contents)
+{
+    // There is only a single background image at the moment, but the camera anchor varies per system.
+    const std::string backgroundKey = contents.seed + "/background";
+    contents.backgroundImage = "data/backgrounds/background1.jpg";
+    contents.backgroundAnchoredBottomLeft = (XXHash64::hash(backgroundKey.data(), backgroundKey.length(), 0) % 2 == 0);
+}
+
+} // namespace Hyperscape
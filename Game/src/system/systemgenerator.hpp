@@ -0,0 +1,62 @@
+// Copyright 2026 Pedro Nunes
+//
+// This file is part of Hyperscape.
+//
+// Hyperscape is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Hyperscape is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Hyperscape. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "system/system.hpp"
+
+namespace Hyperscape
+{
+
+// Everything about a system which is derived from its seed.
+struct SystemContents
+{
+    std::string seed;
+    SystemRandomEngine randomEngine; // In the state it was left in after generation.
+    AstronomicalObjects astronomicalObjects;
+    SignalSources signalSources;
+    std::string backgroundImage;
+    bool backgroundAnchoredBottomLeft;
+};
+using SystemContentsUniquePtr = std::unique_ptr<SystemContents>;
+
+///////////////////////////////////////////////////////////////////////////////
+// SystemGenerator
+// Generates a system's contents from its seed. Generation is a pure function
+// of the seed and doesn't touch the scene or any resources, so it can run on
+// any thread and always gives the same result for the same seed.
+///////////////////////////////////////////////////////////////////////////////
+
+class SystemGenerator
+{
+public:
+    static SystemContentsUniquePtr Generate(const std::string& seed);
+
+private:
+    static void GenerateAstronomicalObjects(SystemContents& contents);
+    static float GenerateEccentricity(SystemRandomEngine& randomEngine);
+    static int GeneratePlanetCount(SystemRandomEngine& randomEngine);
+    static std::vector<float> GeneratePlanetDistances(SystemRandomEngine& randomEngine, int planetCount);
+    static void GenerateWormholes(SystemContents& contents);
+    static void GenerateBackground(SystemContents& contents);
+};
+
+} // namespace Hyperscape
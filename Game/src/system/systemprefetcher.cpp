@@ -0,0 +1,144 @@
+// Copyright 2026 Pedro Nunes
+//
+// This file is part of Hyperscape.
+//
+// Hyperscape is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Hyperscape is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Hyperscape. If not, see <http://www.gnu.org/licenses/>.
+
+#include "system/systemprefetcher.hpp"
+
+#include <algorithm>
+
+#include <genesis.h>
+#include <log.hpp>
+#include <resourcemanager.h>
+
+namespace Hyperscape
+{
+
+SystemPrefetcher::SystemPrefetcher()
+    : m_ShuttingDown(false)
+    , m_Hits(0)
+    , m_Misses(0)
+{
+    m_Worker = std::thread(&SystemPrefetcher::WorkerThreadMain, this);
+}
+
+SystemPrefetcher::~SystemPrefetcher()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_ShuttingDown = true;
+        m_Queue.clear();
+    }
+    m_QueueCondition.notify_all();
+    m_Worker.join();
+}
+
+SystemContentsUniquePtr SystemPrefetcher::Take(const std::string& seed)
+{
+    {
+        std::unique_lock<std::mutex> lock(m_Mutex);
+        auto it = m_Entries.find(seed);
+        if (it != m_Entries.end() && it->second.state != EntryState::Queued)
+        {
+            m_ReadyCondition.wait(lock, [this, &seed] { return m_Entries[seed].state == EntryState::Ready; });
+            SystemContentsUniquePtr pContents = std::move(m_Entries[seed].pContents);
+            m_Entries.erase(seed);
+            m_Hits++;
+            return pContents;
+        }
+
+        // Not worth waiting for the worker to get to it.
+        if (it != m_Entries.end())
+        {
+            m_Queue.erase(std::remove(m_Queue.begin(), m_Queue.end(), seed), m_Queue.end());
+            m_Entries.erase(it);
+        }
+        m_Misses++;
+    }
+
+    return SystemGenerator::Generate(seed);
+}
+
+void SystemPrefetcher::Prefetch(const std::string& seed)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+
+        // Systems which aren't wanted any more are discarded, unless the worker is busy with them.
+        for (auto it = m_Entries.begin(); it != m_Entries.end();)
+        {
+            if (it->first != seed && it->second.state != EntryState::Generating)
+            {
+                m_Queue.erase(std::remove(m_Queue.begin(), m_Queue.end(), it->first), m_Queue.end());
+                it = m_Entries.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+
+        if (m_Entries.find(seed) == m_Entries.end())
+        {
+            m_Entries[seed] = {EntryState::Queued, nullptr};
+            m_Queue.push_back(seed);
+        }
+    }
+
+    m_QueueCondition.notify_one();
+}
+
+size_t SystemPrefetcher::GetHits() const
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    return m_Hits;
+}
+
+size_t SystemPrefetcher::GetMisses() const
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    return m_Misses;
+}
+
+void SystemPrefetcher::WorkerThreadMain()
+{
+    while (true)
+    {
+        std::string seed;
+        {
+            std::unique_lock<std::mutex> lock(m_Mutex);
+            m_QueueCondition.wait(lock, [this] { return m_ShuttingDown || m_Queue.empty() == false; });
+            if (m_ShuttingDown)
+            {
+                return;
+            }
+
+            seed = m_Queue.front();
+            m_Queue.pop_front();
+            m_Entries[seed].state = EntryState::Generating;
+        }
+
+        SystemContentsUniquePtr pContents = SystemGenerator::Generate(seed);
+        Genesis::FrameWork::GetResourceManager()->Preload(pContents->backgroundImage);
+
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            m_Entries[seed] = {EntryState::Ready, std::move(pContents)};
+        }
+        m_ReadyCondition.notify_all();
+    }
+}
+
+} // namespace Hyperscape
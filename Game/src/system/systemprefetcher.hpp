@@ -0,0 +1,89 @@
+// Copyright 2026 Pedro Nunes
+//
+// This file is part of Hyperscape.
+//
+// Hyperscape is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Hyperscape is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Hyperscape. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <condition_variable>
+#include <coredefines.h>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+
+#include "system/systemgenerator.hpp"
+
+namespace Hyperscape
+{
+
+GENESIS_DECLARE_SMART_PTR(SystemPrefetcher);
+
+///////////////////////////////////////////////////////////////////////////////
+// SystemPrefetcher
+// Generates systems on a worker thread before they are needed.
+// Whoever knows which system comes next queues it with Prefetch(), and the
+// system is generated and its background image preloaded in the background,
+// so Take() doesn't have to wait for generation or disk I/O.
+// Systems are generated with SystemGenerator, so the result is the same as
+// generating them synchronously.
+///////////////////////////////////////////////////////////////////////////////
+
+class SystemPrefetcher
+{
+public:
+    SystemPrefetcher();
+    ~SystemPrefetcher();
+
+    // Returns the system's contents. If the system hasn't been prefetched it is generated
+    // synchronously, and if it is still being generated this waits for it to finish.
+    SystemContentsUniquePtr Take(const std::string& seed);
+
+    // Queues the system and discards any other prefetched system which hasn't been taken yet.
+    void Prefetch(const std::string& seed);
+
+    size_t GetHits() const;
+    size_t GetMisses() const;
+
+private:
+    enum class EntryState
+    {
+        Queued,
+        Generating,
+        Ready
+    };
+
+    struct Entry
+    {
+        EntryState state;
+        SystemContentsUniquePtr pContents;
+    };
+
+    void WorkerThreadMain();
+
+    mutable std::mutex m_Mutex;
+    std::condition_variable m_QueueCondition;
+    std::condition_variable m_ReadyCondition;
+    std::deque<std::string> m_Queue;
+    std::unordered_map<std::string, Entry> m_Entries;
+    bool m_ShuttingDown;
+    size_t m_Hits;
+    size_t m_Misses;
+    std::thread m_Worker;
+};
+
+} // namespace Hyperscape
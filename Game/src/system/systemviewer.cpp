@@ -24,14 +24,17 @@
 #include <imgui/imgui_impl.h>
 #include <math/misc.h>
 
+#include "game.hpp"
 #include "system/astronomicalobject/astronomicalobject.hpp"
 #include "system/system.hpp"
+#include "system/systemprefetcher.hpp"
 
 namespace Hyperscape
 {
 
 SystemViewer::SystemViewer()
     : m_IsOpen(false)
+    , m_NextReseedDepth(0)
 {
     Genesis::ImGuiImpl::RegisterDevMenu("Game", "System viewer", &m_IsOpen);
 }
@@ -101,6 +104,19 @@ void SystemViewer::View(SystemSharedPtr pSystem)
 }
 
 void SystemViewer::Reseed(int depth) 
+{
+    SystemPrefetcher* pSystemPrefetcher = g_pGame->GetSystemPrefetcher();
+    const std::string seed = (depth == m_NextReseedDepth) ? m_NextReseedSeed : GenerateReseedSeed(depth);
+    m_pReseedSystem = std::make_shared<System>(pSystemPrefetcher->Take(seed), true);
+    m_pSystem = m_pReseedSystem;
+
+    // The next reseed is most likely to use the same depth.
+    m_NextReseedSeed = GenerateReseedSeed(depth);
+    m_NextReseedDepth = depth;
+    pSystemPrefetcher->Prefetch(m_NextReseedSeed);
+}
+
+std::string SystemViewer::GenerateReseedSeed(int depth)
 {
     std::stringstream seed;
     seed << depth;
@@ -111,9 +127,7 @@ void SystemViewer::Reseed(int depth)
         char c = '0' + dist(rd);
         seed << c;
     }
-
-    m_pReseedSystem = std::make_shared<System>(seed.str(), true);
-    m_pSystem = m_pReseedSystem;
+    return seed.str();
 }
 
 void SystemViewer::DrawCanvas() 
@@ -17,6 +17,8 @@
 
 #pragma once
 
+#include <string>
+
 #include <coredefines.h>
 
 namespace Hyperscape
@@ -36,6 +38,7 @@ public:
 
 private:
     void Reseed(int depth);
+    static std::string GenerateReseedSeed(int depth);
     void DrawCanvas();
 
     SystemWeakPtr m_pSystem;
@@ -43,6 +46,10 @@ private:
 
     // The reseed system is used only for debugging purposes, allowing us to quickly iterate.
     SystemSharedPtr m_pReseedSystem;
+
+    // Generated by the SystemPrefetcher while the current reseed system is being looked at.
+    std::string m_NextReseedSeed;
+    int m_NextReseedDepth;
 };
 
 } // namespace Hyperscape
\ No newline at end of file
@@ -21,12 +21,16 @@
 #include "trail/trail.h"
 
 #include <memory.h>
+#include <memorytracker.hpp>
+#include <performancecounters.h>
 
 namespace Hyperscape
 {
 
 void TrailManager::Update(float delta)
 {
+    GENESIS_MEMORY_SCOPE(Trails);
+
     if (g_pGame->IsPaused() == false)
     {
         m_Trails.remove_if(
@@ -40,10 +44,21 @@ void TrailManager::Update(float delta)
             pTrail->Update(delta);
         }
     }
+
+    static Genesis::PerformanceCounter* sLiveTrails = Genesis::PerformanceCounters::Register("Trails/Live", Genesis::PerformanceCounterType::Gauge);
+    static Genesis::PerformanceCounter* sTrailPoints = Genesis::PerformanceCounters::Register("Trails/Active points", Genesis::PerformanceCounterType::Gauge);
+    int64_t activePoints = 0;
+    for (auto& pTrail : m_Trails)
+    {
+        activePoints += pTrail->GetActivePoints();
+    }
+    sLiveTrails->Set(static_cast<int64_t>(m_Trails.size()));
+    sTrailPoints->Set(activePoints);
 }
 
 TrailWeakPtr TrailManager::Add(float initialWidth, float lifetime, const glm::vec4& color)
 {
+    GENESIS_MEMORY_SCOPE(Trails);
     TrailSharedPtr pTrail = std::make_shared<Trail>(initialWidth, lifetime, color);
     m_Trails.push_back(pTrail);
     return pTrail;
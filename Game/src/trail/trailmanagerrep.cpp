@@ -70,9 +70,9 @@ void TrailManagerRep::Update(float delta)
 
     const glm::vec3& cameraPosition = FrameWork::GetScene()->GetCamera()->GetPosition();
 
-    PositionData posData;
-    UVData uvData;
-    ColourData colourData;
+    FramePositionData posData(&FrameArena::Get());
+    FrameUVData uvData(&FrameArena::Get());
+    FrameColourData colourData(&FrameArena::Get());
     posData.reserve(512);
     uvData.reserve(512);
     colourData.reserve(512);
@@ -157,7 +157,7 @@ void TrailManagerRep::Update(float delta)
     }
 }
 
-void TrailManagerRep::PushBackUVs(Genesis::UVData& uvData)
+void TrailManagerRep::PushBackUVs(Genesis::FrameUVData& uvData)
 {
     using namespace Genesis;
     static const glm::vec2 uvs[4] = {glm::vec2(0.0f, 0.0f), glm::vec2(1.0f, 0.0f), glm::vec2(1.0f, 1.0f), glm::vec2(0.0f, 1.0f)};
@@ -168,7 +168,7 @@ void TrailManagerRep::PushBackUVs(Genesis::UVData& uvData)
     }
 }
 
-void TrailManagerRep::PushBackColours(Genesis::ColourData& colourData, const glm::vec4& color, float initialWidth, float currentWidth, float nextWidth)
+void TrailManagerRep::PushBackColours(Genesis::FrameColourData& colourData, const glm::vec4& color, float initialWidth, float currentWidth, float nextWidth)
 {
     using namespace Genesis;
     const float r = color.r;
@@ -48,8 +48,8 @@ public:
     virtual void Render( const Genesis::SceneCameraSharedPtr& pCamera ) override;
 
 private:
-    void PushBackUVs(Genesis::UVData& uvData);
-    void PushBackColours(Genesis::ColourData& colourData, const glm::vec4& color, float initialWidth, float currentWidth, float nextWidth);
+    void PushBackUVs(Genesis::FrameUVData& uvData);
+    void PushBackColours(Genesis::FrameColourData& colourData, const glm::vec4& color, float initialWidth, float currentWidth, float nextWidth);
 
     TrailManager* m_pTrailManager;
     Genesis::ResourceShader* m_pShader;
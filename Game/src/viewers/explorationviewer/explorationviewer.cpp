@@ -27,6 +27,7 @@
 
 #include "sector/sector.h"
 #include "system/astronomicalobject/astronomicalobject.hpp"
+#include "system/blackbody.hpp"
 #include "system/system.hpp"
 #include "ui2/ui2.hpp"
 
@@ -64,6 +65,8 @@ ExplorationViewer::ExplorationViewer()
     , m_CalibrationDecayTimer(0.0f)
     , m_ScanTimer(0.0f)
     , m_SignalsInArc(0)
+    , m_ScanId(0)
+    , m_pSignalLocks(nullptr)
 {
     Genesis::ImGuiImpl::RegisterDevMenu("Game", "Sensors", &m_IsOpen);
 }
@@ -121,10 +124,12 @@ void ExplorationViewer::UpdateDebugUI()
                 ImGui::TableHeadersRow();
                 UI2::PopFont();
 
-                for (auto& pSignalSource : pSystem->GetSignalSources())
+                const SignalSources& signalSources = pSystem->GetSignalSources();
+                for (size_t signalIndex = 0; signalIndex < signalSources.size(); ++signalIndex)
                 {
+                    const SignalSourceSharedPtr& pSignalSource = signalSources[signalIndex];
                     float signalLockCurrent, signalLockMaximum;
-                    GetSignalLock(pSignalSource, signalLockCurrent, signalLockMaximum);
+                    GetSignalLock(signalIndex, signalLockCurrent, signalLockMaximum);
                     if (signalLockMaximum < 1.0f)
                     {
                         ImGui::TableNextColumn();
@@ -197,6 +202,8 @@ void ExplorationViewer::UpdateDebugUI()
 void ExplorationViewer::View(SystemSharedPtr pSystem)
 {
     m_pSystem = pSystem;
+    m_SweepIndex.Clear();
+    m_pSignalLocks = nullptr;
 }
 
 void ExplorationViewer::DrawCanvas()
@@ -259,13 +266,14 @@ void ExplorationViewer::DrawCanvas()
     SystemSharedPtr pSystem = m_pSystem.lock();
     if (pSystem != nullptr)
     {
-        for (auto& pSignalSource : pSystem->GetSignalSources())
+        const SignalSources& signalSources = pSystem->GetSignalSources();
+        for (size_t signalIndex = 0; signalIndex < signalSources.size(); ++signalIndex)
         {
             float signalLockCurrent, signalLockMaximum;
-            GetSignalLock(pSignalSource, signalLockCurrent, signalLockMaximum);
+            GetSignalLock(signalIndex, signalLockCurrent, signalLockMaximum);
             if (signalLockMaximum >= 1.0f)
             {
-                pSignalSource->CanvasRender(topLeft, bottomRight, scrolling);
+                signalSources[signalIndex]->CanvasRender(topLeft, bottomRight, scrolling);
             }
         }
     }
@@ -443,33 +451,85 @@ float ExplorationViewer::GetMaximumSensorStrength() const
 
 void ExplorationViewer::DoScan() 
 {
-    // Reset result scan intensities
-    for (size_t i = 0; i < m_ScanResult.sNumEntries; ++i)
-    {
-        m_ScanResult.Intensities[i] = 0.0;
-    }
     m_SpectrographYMax = 0.0f;
     m_SignalsInArc = 0;
+    m_ScanSpectra.clear();
+    m_ScanScales.clear();
+    m_ScanId++;
+    std::swap(m_SignalsInArcIndices, m_PreviousSignalsInArcIndices);
+    m_SignalsInArcIndices.clear();
 
     SystemSharedPtr pSystem = m_pSystem.lock();
     if (pSystem != nullptr)
     {
-        for (auto& pSignalSource : pSystem->GetSignalSources())
+        UpdateSweepIndex(pSystem.get());
+
+        // Only the sources the index returns can be in the arc, everything else can be skipped.
+        // Sources which aren't in the arc only need their locks updated if they were in it during the last scan.
+        const SignalSources& signalSources = pSystem->GetSignalSources();
+        m_ArcCandidates.clear();
+        if (pSystem->GetCurrentSector() != nullptr)
+        {
+            m_SweepIndex.Query(glm::radians(m_Angle), glm::radians(m_Aperture), m_RangeMin, m_RangeMax, m_ArcCandidates);
+        }
+
+        for (size_t signalIndex : m_ArcCandidates)
         {
+            const SignalSourceSharedPtr& pSignalSource = signalSources[signalIndex];
             if (IsInScannerArc(pSignalSource->GetSignalCoordinates()))
             {
-                const SignalData& signalData = pSignalSource->GetSignalData();
-                for (size_t i = 0; i < m_ScanResult.sNumEntries; ++i)
-                {
-                    m_ScanResult.Intensities[i] += signalData.Intensities[i];
-                    m_SpectrographYMax = glm::max(m_SpectrographYMax, static_cast<float>(m_ScanResult.Intensities[i]));
-                }
+                m_ScanSpectra.push_back(pSignalSource->GetSignalData().Intensities.data());
+                m_ScanScales.push_back(1.0);
                 m_SignalsInArc++;
-                UpdateSignalLock(pSignalSource, true);
+                m_SignalsInArcIndices.push_back(signalIndex);
+                m_LastInArcScan[signalIndex] = m_ScanId;
+                UpdateSignalLock(signalIndex, pSignalSource, true);
             }
-            else
+        }
+
+        for (size_t signalIndex : m_PreviousSignalsInArcIndices)
+        {
+            if (signalIndex < signalSources.size() && m_LastInArcScan[signalIndex] != m_ScanId)
+            {
+                UpdateSignalLock(signalIndex, signalSources[signalIndex], false);
+            }
+        }
+    }
+
+    // All the signals in the arc are summed in a single pass, rather than one pass per signal.
+    BlackBody::Accumulate(m_ScanSpectra.data(), m_ScanScales.data(), m_ScanSpectra.size(), m_ScanResult.Intensities.data());
+    for (size_t i = 0; i < m_ScanResult.sNumEntries; ++i)
+    {
+        m_SpectrographYMax = glm::max(m_SpectrographYMax, static_cast<float>(m_ScanResult.Intensities[i]));
+    }
+}
+
+// Rebuilds the sweep index and the lock array whenever the system or the player's sector changes.
+void ExplorationViewer::UpdateSweepIndex(System* pSystem)
+{
+    Sector* pSector = pSystem->GetCurrentSector();
+    const glm::vec2 origin = (pSector != nullptr) ? pSector->GetCoordinates() : glm::vec2(0.0f);
+    if (m_SweepIndex.IsBuiltFor(pSystem, origin))
+    {
+        return;
+    }
+
+    m_SweepIndex.Build(pSystem, origin);
+
+    const SignalSources& signalSources = pSystem->GetSignalSources();
+    m_LastInArcScan.assign(signalSources.size(), 0);
+    m_SignalsInArcIndices.clear();
+    m_PreviousSignalsInArcIndices.clear();
+
+    m_pSignalLocks = &m_SystemSignalLocks[pSystem->GetSeed()];
+    if (m_pSignalLocks->size() != signalSources.size())
+    {
+        m_pSignalLocks->resize(signalSources.size());
+        for (size_t signalIndex = 0; signalIndex < signalSources.size(); ++signalIndex)
+        {
+            if (signalSources[signalIndex]->GetSignalDifficulty() <= 0.0f)
             {
-                UpdateSignalLock(pSignalSource, false);
+                (*m_pSignalLocks)[signalIndex] = SignalLockData(1.0f, 1.0f);
             }
         }
     }
@@ -509,37 +569,27 @@ void ExplorationViewer::TriggerCalibrationDecay()
     m_CalibrationDecayTimer = 0.5f;
 }
 
-void ExplorationViewer::UpdateSignalLock(const SignalSourceSharedPtr& pSignalSource, bool isInArc) 
+void ExplorationViewer::UpdateSignalLock(size_t signalIndex, const SignalSourceSharedPtr& pSignalSource, bool isInArc) 
 {
+    SignalLockData& lockData = (*m_pSignalLocks)[signalIndex];
     if (pSignalSource->GetSignalDifficulty() <= 0.0f)
     {
-        m_SignalLocks[pSignalSource->GetSignalId()] = SignalLockData(1.0f, 1.0f);
+        lockData = SignalLockData(1.0f, 1.0f);
+    }
+    else if (lockData.maximum >= 1.0f)
+    {
+        // Was this signal previous locked? If so, it should remain fully locked.
+        return;
+    }
+    else if (isInArc)
+    {
+        const float lock = GetEffectiveSensorStrenght() / pSignalSource->GetSignalDifficulty();
+        lockData.current = lock;
+        lockData.maximum = glm::max(lockData.maximum, lock);
     }
     else
     {
-        SignalLocks::iterator it = m_SignalLocks.find(pSignalSource->GetSignalId());
-        float lock = GetEffectiveSensorStrenght() / pSignalSource->GetSignalDifficulty();
-        if (it != m_SignalLocks.end())
-        {
-            // Was this signal previous locked? If so, it should remain fully locked.
-            if (it->second.maximum >= 1.0f)
-            {
-                return;
-            }
-            else if (isInArc)
-            {
-                it->second.current = lock;
-                it->second.maximum = glm::max(it->second.maximum, lock);
-            }
-            else
-            {
-                it->second.current = 0.0f;
-            }
-        }
-        else
-        {
-            m_SignalLocks[pSignalSource->GetSignalId()] = isInArc ? SignalLockData(lock, lock) : SignalLockData(0.0f, 0.0f); 
-        }
+        lockData.current = 0.0f;
     }
 }
 
@@ -548,18 +598,17 @@ float ExplorationViewer::GetEffectiveSensorStrenght() const
     return GetMaximumSensorStrength() * m_Calibration;
 }
 
-void ExplorationViewer::GetSignalLock(const SignalSourceSharedPtr& pSignalSource, float& current, float& maximum) const 
+void ExplorationViewer::GetSignalLock(size_t signalIndex, float& current, float& maximum) const 
 {
-    SignalLocks::const_iterator it = m_SignalLocks.find(pSignalSource->GetSignalId());
-    if (it == m_SignalLocks.end())
+    if (m_pSignalLocks == nullptr || signalIndex >= m_pSignalLocks->size())
     {
         current = 0.0f;
         maximum = 0.0f;
     }
     else
     {
-        current = it->second.current;
-        maximum = it->second.maximum;
+        current = (*m_pSignalLocks)[signalIndex].current;
+        maximum = (*m_pSignalLocks)[signalIndex].maximum;
     }
 }
 
@@ -24,12 +24,16 @@
 #include <externalheadersend.hpp>
 // clang-format on
 
+#include <cstdint>
 #include <random>
+#include <string>
 #include <unordered_map>
+#include <vector>
 
 #include <coredefines.h>
 
 #include "system/signaldata.hpp"
+#include "viewers/explorationviewer/signalsweepindex.hpp"
 
 namespace Hyperscape
 {
@@ -58,9 +62,10 @@ private:
     void DoScan();
     bool IsInScannerArc(const glm::vec2& coordinates) const;
     void TriggerCalibrationDecay();
-    void UpdateSignalLock(const SignalSourceSharedPtr& pSignalSource, bool isInArc);
+    void UpdateSweepIndex(System* pSystem);
+    void UpdateSignalLock(size_t signalIndex, const SignalSourceSharedPtr& pSignalSource, bool isInArc);
     float GetEffectiveSensorStrenght() const;
-    void GetSignalLock(const SignalSourceSharedPtr& pSignalSource, float& current, float& maximum) const;
+    void GetSignalLock(size_t signalIndex, float& current, float& maximum) const;
 
     ImVec2 m_WindowSize;
     SystemWeakPtr m_pSystem;
@@ -75,6 +80,14 @@ private:
     float m_ScanTimer;
     int m_SignalsInArc;
     SignalData m_ScanResult;
+    SignalSweepIndex m_SweepIndex;
+    std::vector<size_t> m_ArcCandidates;
+    std::vector<size_t> m_SignalsInArcIndices; // Indices of the signal sources which were in the arc during the last scan.
+    std::vector<size_t> m_PreviousSignalsInArcIndices;
+    std::vector<uint32_t> m_LastInArcScan; // Per signal source, the last scan in which it was in the arc.
+    uint32_t m_ScanId;
+    std::vector<const double*> m_ScanSpectra; // Intensities of the signals in the scanner's arc, kept to avoid allocating every scan.
+    std::vector<double> m_ScanScales;
     std::mt19937_64 m_RandomEngine;
 
     struct SignalLockData
@@ -95,8 +108,11 @@ private:
         float maximum;
     };
 
-    using SignalLocks = std::unordered_map<std::string, SignalLockData>;
-    SignalLocks m_SignalLocks;
+    // Locks are indexed in the same order as the system's signal sources, and kept per system seed
+    // so they are still there if the player returns to a system.
+    using SignalLocks = std::vector<SignalLockData>;
+    std::unordered_map<std::string, SignalLocks> m_SystemSignalLocks;
+    SignalLocks* m_pSignalLocks;
 };
 
 } // namespace Hyperscape
\ No newline at end of file
@@ -0,0 +1,130 @@
+// Copyright 2026 Pedro Nunes
+//
+// This file is part of Hyperscape.
+//
+// Hyperscape is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Hyperscape is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Hyperscape. If not, see <http://www.gnu.org/licenses/>.
+
+#include "viewers/explorationviewer/signalsweepindex.hpp"
+
+#include <algorithm>
+
+// clang-format off
+#include <externalheadersbegin.hpp>
+#include <glm/geometric.hpp>
+#include <glm/gtc/constants.hpp>
+#include <glm/trigonometric.hpp>
+#include <externalheadersend.hpp>
+// clang-format on
+
+#include "system/signalsource.hpp"
+
+namespace Hyperscape
+{
+
+// Matches ExplorationViewer::IsInScannerArc(), which treats anything this close to the player as being in the arc.
+static const float sOriginDistance = 0.001f;
+
+// Widens queries slightly, so that sources right on the edge of the arc are never missed due to rounding.
+static const float sBearingTolerance = 0.001f;
+static const float sRangeTolerance = 0.001f;
+
+SignalSweepIndex::SignalSweepIndex()
+    : m_pSystem(nullptr)
+    , m_Origin(0.0f)
+    , m_SourceCount(0)
+{
+}
+
+void SignalSweepIndex::Build(const System* pSystem, const glm::vec2& origin)
+{
+    const SignalSources& signalSources = pSystem->GetSignalSources();
+    m_pSystem = pSystem;
+    m_Origin = origin;
+    m_SourceCount = signalSources.size();
+    m_Entries.clear();
+    m_AtOrigin.clear();
+
+    for (size_t i = 0; i < signalSources.size(); ++i)
+    {
+        const glm::vec2 to = signalSources[i]->GetSignalCoordinates() - origin;
+        const float distance = glm::length(to);
+        if (distance <= sOriginDistance)
+        {
+            m_AtOrigin.push_back(i);
+        }
+        else
+        {
+            float bearing = glm::atan(to.y, to.x);
+            if (bearing >= glm::pi<float>())
+            {
+                bearing -= glm::two_pi<float>();
+            }
+            m_Entries.push_back({bearing, distance, static_cast<uint32_t>(i)});
+        }
+    }
+
+    std::sort(m_Entries.begin(), m_Entries.end(), [](const Entry& a, const Entry& b) { return a.bearing < b.bearing; });
+}
+
+void SignalSweepIndex::Clear()
+{
+    m_pSystem = nullptr;
+    m_SourceCount = 0;
+    m_Entries.clear();
+    m_AtOrigin.clear();
+}
+
+bool SignalSweepIndex::IsBuiltFor(const System* pSystem, const glm::vec2& origin) const
+{
+    return pSystem != nullptr && m_pSystem == pSystem && m_Origin == origin && m_SourceCount == pSystem->GetSignalSources().size();
+}
+
+void SignalSweepIndex::Query(float angleRad, float apertureRad, float rangeMin, float rangeMax, std::vector<size_t>& indices) const
+{
+    indices.insert(indices.end(), m_AtOrigin.begin(), m_AtOrigin.end());
+
+    const float halfWidth = apertureRad + sBearingTolerance;
+    if (halfWidth >= glm::pi<float>())
+    {
+        AddRange(-glm::pi<float>(), glm::pi<float>(), rangeMin, rangeMax, indices);
+        return;
+    }
+
+    // The arc can wrap around from pi to -pi, in which case it is split in two.
+    const float from = angleRad - halfWidth - glm::two_pi<float>() * glm::floor((angleRad - halfWidth + glm::pi<float>()) / glm::two_pi<float>());
+    const float to = from + halfWidth * 2.0f;
+    if (to <= glm::pi<float>())
+    {
+        AddRange(from, to, rangeMin, rangeMax, indices);
+    }
+    else
+    {
+        AddRange(from, glm::pi<float>(), rangeMin, rangeMax, indices);
+        AddRange(-glm::pi<float>(), to - glm::two_pi<float>(), rangeMin, rangeMax, indices);
+    }
+}
+
+void SignalSweepIndex::AddRange(float bearingFrom, float bearingTo, float rangeMin, float rangeMax, std::vector<size_t>& indices) const
+{
+    auto it = std::lower_bound(m_Entries.begin(), m_Entries.end(), bearingFrom, [](const Entry& entry, float bearing) { return entry.bearing < bearing; });
+    for (; it != m_Entries.end() && it->bearing <= bearingTo; ++it)
+    {
+        if (it->distance > rangeMin - sRangeTolerance && it->distance < rangeMax + sRangeTolerance)
+        {
+            indices.push_back(it->index);
+        }
+    }
+}
+
+} // namespace Hyperscape
@@ -0,0 +1,73 @@
+// Copyright 2026 Pedro Nunes
+//
+// This file is part of Hyperscape.
+//
+// Hyperscape is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Hyperscape is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Hyperscape. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// clang-format off
+#include <externalheadersbegin.hpp>
+#include <glm/vec2.hpp>
+#include <externalheadersend.hpp>
+// clang-format on
+
+#include <cstdint>
+#include <vector>
+
+#include "system/system.hpp"
+
+namespace Hyperscape
+{
+
+///////////////////////////////////////////////////////////////////////////////
+// SignalSweepIndex
+// Signal sources sorted by their bearing from an origin (the player's sector),
+// so that the sources inside the scanner's arc can be found with a binary
+// search instead of testing every source in the system.
+// Queries are conservative: the results need to be tested against the exact
+// arc, but anything outside it (give or take a small tolerance) is skipped.
+///////////////////////////////////////////////////////////////////////////////
+
+class SignalSweepIndex
+{
+public:
+    SignalSweepIndex();
+
+    void Build(const System* pSystem, const glm::vec2& origin);
+    void Clear();
+    bool IsBuiltFor(const System* pSystem, const glm::vec2& origin) const;
+
+    // Adds the indices (into the system's signal sources) of every source within apertureRad of
+    // angleRad and between the given ranges. Sources at the origin itself are always added.
+    void Query(float angleRad, float apertureRad, float rangeMin, float rangeMax, std::vector<size_t>& indices) const;
+
+private:
+    struct Entry
+    {
+        float bearing; // In [-pi, pi).
+        float distance;
+        uint32_t index;
+    };
+
+    void AddRange(float bearingFrom, float bearingTo, float rangeMin, float rangeMax, std::vector<size_t>& indices) const;
+
+    const System* m_pSystem; // Only used to detect the system changing, never dereferenced.
+    glm::vec2 m_Origin;
+    size_t m_SourceCount;
+    std::vector<Entry> m_Entries;
+    std::vector<size_t> m_AtOrigin;
+};
+
+} // namespace Hyperscape
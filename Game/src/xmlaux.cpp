@@ -4,110 +4,6 @@
 namespace Xml
 {
 
-bool Serialise( tinyxml2::XMLElement* pElement, const std::string& name, Hyperscape::ModuleRarity& value )
-{
-	SDL_assert( pElement != nullptr );
-
-	if ( name != pElement->Value() )
-		return false;
-
-	using namespace Hyperscape;
-
-	static const std::string rarity[ static_cast<size_t>( ModuleRarity::Count ) ] = 
-	{
-		"Trash",
-		"Common",
-		"Uncommon",
-		"Rare",
-		"Artifact",
-		"Legendary"
-	};
-
-	for ( int i = 0; i < static_cast<int>( ModuleRarity::Count ); ++i )
-	{
-		if ( rarity[ i ] == pElement->GetText() )
-		{
-			value = static_cast<ModuleRarity>( i );
-			return true;
-		}
-	}
-
-	return false;
-}
-
-bool Serialise( tinyxml2::XMLElement* pElement, const std::string& name, Hyperscape::WeaponBehaviour& value )
-{
-	SDL_assert( pElement != nullptr );
-
-	if ( name != pElement->Value() )
-		return false;
-
-	using namespace Hyperscape;
-
-	std::string text( pElement->GetText() );
-	if ( text == "Fixed" )
-	{
-		value = WeaponBehaviour::Fixed;
-		return true;
-	}
-	else if ( text == "Turret" )
-	{
-		value = WeaponBehaviour::Turret;
-		return true;
-	}
-
-	return false;
-}
-
-bool Serialise( tinyxml2::XMLElement* pElement, const std::string& name, Hyperscape::TowerBonus& value )
-{
-	SDL_assert( pElement != nullptr );
-
-	if ( name != pElement->Value() )
-		return false;
-
-	using namespace Hyperscape;
-
-	std::string text( pElement->GetText() );
-	if ( text == "None" )
-	{
-		value = TowerBonus::None;
-		return true;
-	}
-	else if ( text == "Damage" )
-	{
-		value = TowerBonus::Damage;
-		return true;
-	}
-	else if ( text == "Movement" )
-	{
-		value = TowerBonus::Movement;
-		return true;
-	}
-	else if ( text == "Shields" )
-	{
-		value = TowerBonus::Shields;
-		return true;
-	}
-	else if ( text == "Sensors" )
-	{
-		value = TowerBonus::Sensors;
-		return true;
-	}
-	else if ( text == "HyperspaceImmunity" )
-	{
-		value = TowerBonus::HyperspaceImmunity;
-		return true;
-	}
-	else if ( text == "Ramming" )
-	{
-		value = TowerBonus::Ramming;
-		return true;
-	}
-
-	return false;
-}
-
 void Write( tinyxml2::XMLDocument& xmlDoc, tinyxml2::XMLElement* pRootElement, const std::string& elementName, const std::string& content )
 {
 	tinyxml2::XMLElement* pElement = xmlDoc.NewElement( elementName.c_str() );
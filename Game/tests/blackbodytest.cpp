@@ -0,0 +1,75 @@
+// Copyright 2026 Pedro Nunes
+//
+// This file is part of Hyperscape.
+//
+// Hyperscape is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Hyperscape is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Hyperscape. If not, see <http://www.gnu.org/licenses/>.
+
+// Checks BlackBody::Evaluate() against the straightforward evaluation of Planck's law.
+
+#include <cmath>
+#include <iostream>
+#include <string>
+
+#include <testharness.hpp>
+
+#include "system/blackbody.hpp"
+
+using namespace Hyperscape;
+
+static void Check(bool condition, const char* pDescription, double temperatureKelvin)
+{
+    if (!condition)
+    {
+        Genesis::Test::Fail(std::string(pDescription) + " at " + std::to_string(temperatureKelvin) + "K");
+    }
+}
+
+int main()
+{
+    // Measured at just under 3e-13, mostly from the reference's own pow().
+    static const double sMaximumRelativeError = 1.0e-12;
+
+    double worstError = 0.0;
+    double worstTemperature = 0.0;
+    for (double temperatureKelvin = 1.0; temperatureKelvin < 1.0e8; temperatureKelvin *= 1.01)
+    {
+        const double error = BlackBody::GetMaximumRelativeError(temperatureKelvin);
+        Check(error <= sMaximumRelativeError, "relative error too large", temperatureKelvin);
+        if (error > worstError)
+        {
+            worstError = error;
+            worstTemperature = temperatureKelvin;
+        }
+
+        BlackBody::Spectrum spectrum;
+        BlackBody::Evaluate(temperatureKelvin, spectrum);
+        const SignalData signalData;
+        for (size_t i = 0; i < SignalData::sNumEntries; i++)
+        {
+            Check(std::isfinite(spectrum[i]) && spectrum[i] >= 0.0, "radiance isn't finite and positive", temperatureKelvin);
+            if (signalData.Wavelengths[i] == 0.0)
+            {
+                Check(spectrum[i] == 0.0, "entry without a wavelength has a radiance", temperatureKelvin);
+            }
+        }
+    }
+    std::cout << "Largest relative error: " << worstError << " at " << worstTemperature << "K." << std::endl;
+
+    // Temperatures within the same quantum share a spectrum.
+    BlackBody::SpectrumSharedPtr pFirst = BlackBody::Get(5778.0);
+    BlackBody::SpectrumSharedPtr pSecond = BlackBody::Get(5778.0 + BlackBody::sTemperatureQuantum * 0.25);
+    Check(pFirst == pSecond, "spectrum wasn't cached", 5778.0);
+
+    return Genesis::Test::GetExitCode();
+}
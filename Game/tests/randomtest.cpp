@@ -0,0 +1,254 @@
+// Copyright 2021 Pedro Nunes
+//
+// This file is part of Hyperscape.
+//
+// Hyperscape is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Hyperscape is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Hyperscape. If not, see <http://www.gnu.org/licenses/>.
+
+// Checks RandomStream against known xoshiro256** output, the uniformity of its bounded
+// ranges and the independence of split streams.
+
+#include <cmath>
+#include <iostream>
+#include <unordered_set>
+#include <vector>
+
+#include <testharness.hpp>
+
+#include "misc/random.h"
+
+using namespace Hyperscape;
+using Genesis::Test::Check;
+
+// Chi-square statistic of the bin counts against a uniform distribution, compared against an
+// approximation (Wilson-Hilferty) of the critical value at p = 0.001. The streams are seeded,
+// so a pass or a failure is reproducible.
+static bool IsUniform( const std::vector<uint64_t>& counts, uint64_t samples )
+{
+	const double expected = static_cast<double>( samples ) / counts.size();
+	double chiSquare = 0.0;
+	for ( uint64_t count : counts )
+	{
+		const double delta = static_cast<double>( count ) - expected;
+		chiSquare += delta * delta / expected;
+	}
+
+	const double degreesOfFreedom = static_cast<double>( counts.size() - 1 );
+	const double z = 3.090232;
+	const double term = 2.0 / ( 9.0 * degreesOfFreedom );
+	const double criticalValue = degreesOfFreedom * std::pow( 1.0 - term + z * std::sqrt( term ), 3.0 );
+	return chiSquare < criticalValue;
+}
+
+static void TestKnownAnswers()
+{
+	// Vigna's reference xoshiro256**, seeded with the reference SplitMix64 from 0.
+	RandomStream stream( 0 );
+	Check( stream.NextU64() == 0x99EC5F36CB75F2B4ull, "1st value of seed 0" );
+	Check( stream.NextU64() == 0xBF6E1F784956452Aull, "2nd value of seed 0" );
+	Check( stream.NextU64() == 0x1A5F849D4933E6E0ull, "3rd value of seed 0" );
+	Check( stream.NextU64() == 0x6AA594F1262D2D2Cull, "4th value of seed 0" );
+
+	RandomStream jumped( 0 );
+	jumped.Jump();
+	Check( jumped.NextU64() == 0x376215EDC846D62Cull, "1st value of seed 0 after a jump" );
+	Check( jumped.NextU64() == 0x57C0611DE8350CA7ull, "2nd value of seed 0 after a jump" );
+
+	RandomStream reseeded( 1234 );
+	reseeded.Seed( 0 );
+	Check( reseeded.NextU64() == 0x99EC5F36CB75F2B4ull, "reseeding restarts the sequence" );
+}
+
+static void TestBoundedUniformity()
+{
+	static const uint64_t sSamplesPerBin = 2000;
+
+	RandomStream stream( 42 );
+	for ( uint32_t max : { 2u, 3u, 7u, 10u, 100u, 1000u } )
+	{
+		std::vector<uint64_t> counts( max, 0 );
+		const uint64_t samples = sSamplesPerBin * max;
+		for ( uint64_t i = 0; i < samples; ++i )
+		{
+			counts[ stream.Next( max ) ]++;
+		}
+		Check( IsUniform( counts, samples ), "Next( max ) isn't uniform" );
+	}
+
+	// Ranges just above a power of two have the largest biased region, which rejection has to remove.
+	for ( uint32_t max : { 0x80000001u, 0xC0000000u, 0xFFFFFFFFu } )
+	{
+		static const uint64_t sBins = 64;
+		std::vector<uint64_t> counts( sBins, 0 );
+		const uint64_t samples = sSamplesPerBin * sBins;
+		for ( uint64_t i = 0; i < samples; ++i )
+		{
+			counts[ static_cast<uint64_t>( stream.Next( max ) ) * sBins / max ]++;
+		}
+		Check( IsUniform( counts, samples ), "Next( max ) isn't uniform for large ranges" );
+	}
+
+	{
+		static const uint32_t sMin = 1000;
+		static const uint32_t sMax = 1100;
+		std::vector<uint64_t> counts( sMax - sMin, 0 );
+		const uint64_t samples = sSamplesPerBin * counts.size();
+		for ( uint64_t i = 0; i < samples; ++i )
+		{
+			counts[ stream.Next( sMin, sMax ) - sMin ]++;
+		}
+		Check( IsUniform( counts, samples ), "Next( min, max ) isn't uniform" );
+	}
+
+	{
+		static const uint64_t sBins = 100;
+		std::vector<uint64_t> counts( sBins, 0 );
+		const uint64_t samples = sSamplesPerBin * sBins;
+		for ( uint64_t i = 0; i < samples; ++i )
+		{
+			const float value = stream.Next( -3.0f, 5.0f );
+			counts[ std::min( static_cast<uint64_t>( ( value + 3.0f ) / 8.0f * sBins ), sBins - 1 ) ]++;
+		}
+		Check( IsUniform( counts, samples ), "Next( float min, float max ) isn't uniform" );
+	}
+}
+
+static void TestBoundLimits()
+{
+	RandomStream stream( 7 );
+	bool withinBounds = true;
+	for ( int i = 0; i < 100000; ++i )
+	{
+		withinBounds &= ( stream.Next( 1u ) == 0 );
+		withinBounds &= ( stream.Next( 0xFFFFFFFFu ) < 0xFFFFFFFFu );
+		withinBounds &= ( stream.Next( 0xFFFFFFFEu, 0xFFFFFFFFu ) == 0xFFFFFFFEu );
+		withinBounds &= ( stream.Next( 5u, 6u ) == 5u );
+
+		const float unit = stream.Next( 1.0f );
+		withinBounds &= ( unit >= 0.0f && unit < 1.0f );
+
+		// Rounding can land on max itself once the range is small compared to min.
+		const float ranged = stream.Next( 1000.0f, 1001.0f );
+		withinBounds &= ( ranged >= 1000.0f && ranged <= 1001.0f );
+	}
+	Check( withinBounds, "bounded value out of range" );
+
+	// Both extremes of a small range are reachable.
+	bool seenMin = false;
+	bool seenMax = false;
+	for ( int i = 0; i < 1000; ++i )
+	{
+		const uint32_t value = stream.Next( 10u, 13u );
+		seenMin |= ( value == 10u );
+		seenMax |= ( value == 12u );
+	}
+	Check( seenMin && seenMax, "extremes of Next( min, max ) never drawn" );
+}
+
+static void TestFill()
+{
+	static const size_t sCount = 1000;
+
+	RandomStream batch( 99 );
+	RandomStream single( 99 );
+	std::vector<uint32_t> values( sCount );
+	std::vector<float> floats( sCount );
+
+	bool matches = true;
+	batch.Fill( values.data(), sCount );
+	for ( uint32_t value : values )
+	{
+		matches &= ( value == single.Next() );
+	}
+	batch.Fill( values.data(), sCount, 17u );
+	for ( uint32_t value : values )
+	{
+		matches &= ( value == single.Next( 17u ) );
+	}
+	batch.Fill( floats.data(), sCount, -1.0f, 1.0f );
+	for ( float value : floats )
+	{
+		matches &= ( value == single.Next( -1.0f, 1.0f ) );
+	}
+	Check( matches, "Fill() doesn't match individual calls" );
+}
+
+static void TestSplitIndependence()
+{
+	static const size_t sSamples = 1000000;
+
+	RandomStream root( 2026 );
+	RandomStream first = root.Split();
+	RandomStream second = root.Split();
+
+	// Split() hands out the current state and jumps past it.
+	RandomStream expectedFirst( 2026 );
+	RandomStream expectedSecond( 2026 );
+	expectedSecond.Jump();
+	Check( first.NextU64() == expectedFirst.NextU64(), "split stream doesn't start at the parent's state" );
+	Check( second.NextU64() == expectedSecond.NextU64(), "parent wasn't jumped past the split stream" );
+
+	// No shared values between the streams, and no correlation between them or with the parent.
+	std::unordered_set<uint64_t> firstValues;
+	firstValues.reserve( sSamples );
+	double sumFirst = 0.0, sumSecond = 0.0, sumRoot = 0.0;
+	double sumFirstSquared = 0.0, sumSecondSquared = 0.0, sumRootSquared = 0.0;
+	double sumFirstSecond = 0.0, sumFirstRoot = 0.0;
+	size_t shared = 0;
+	for ( size_t i = 0; i < sSamples; ++i )
+	{
+		const uint64_t a = first.NextU64();
+		firstValues.insert( a );
+		const double x = static_cast<double>( a >> 11 ) / 9007199254740992.0;
+		const double y = static_cast<double>( second.NextU64() >> 11 ) / 9007199254740992.0;
+		const double z = static_cast<double>( root.NextU64() >> 11 ) / 9007199254740992.0;
+		sumFirst += x;
+		sumSecond += y;
+		sumRoot += z;
+		sumFirstSquared += x * x;
+		sumSecondSquared += y * y;
+		sumRootSquared += z * z;
+		sumFirstSecond += x * y;
+		sumFirstRoot += x * z;
+	}
+
+	RandomStream secondAgain( 2026 );
+	secondAgain.Jump();
+	for ( size_t i = 0; i < sSamples; ++i )
+	{
+		shared += firstValues.count( secondAgain.NextU64() );
+	}
+	Check( shared == 0, "split streams share values" );
+
+	const double n = static_cast<double>( sSamples );
+	auto correlation = [ n ]( double sumX, double sumY, double sumXX, double sumYY, double sumXY ) {
+		const double covariance = sumXY / n - ( sumX / n ) * ( sumY / n );
+		const double varianceX = sumXX / n - ( sumX / n ) * ( sumX / n );
+		const double varianceY = sumYY / n - ( sumY / n ) * ( sumY / n );
+		return covariance / std::sqrt( varianceX * varianceY );
+	};
+
+	// The standard error of the correlation of independent samples is 1 / sqrt( n ) = 0.001.
+	Check( std::abs( correlation( sumFirst, sumSecond, sumFirstSquared, sumSecondSquared, sumFirstSecond ) ) < 0.005, "split streams are correlated" );
+	Check( std::abs( correlation( sumFirst, sumRoot, sumFirstSquared, sumRootSquared, sumFirstRoot ) ) < 0.005, "split stream is correlated with its parent" );
+}
+
+int main()
+{
+	TestKnownAnswers();
+	TestBoundedUniformity();
+	TestBoundLimits();
+	TestFill();
+	TestSplitIndependence();
+	return Genesis::Test::GetExitCode();
+}
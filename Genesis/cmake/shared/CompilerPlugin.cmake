@@ -0,0 +1,25 @@
+# Builds a compiler's sources as a shared library which Forge can load in-process,
+# using the same compile options, definitions and libraries as the compiler's executable.
+# Must be called after the executable target has been fully set up.
+function(AddCompilerPlugin COMPILER_TARGET PLUGIN_SOURCE_FILES OUTPUT_DIRECTORY)
+  set(PLUGIN_TARGET ${COMPILER_TARGET}Plugin)
+  add_library(${PLUGIN_TARGET} MODULE ${PLUGIN_SOURCE_FILES})
+  set_target_properties(${PLUGIN_TARGET} PROPERTIES PREFIX "")
+
+  foreach(PROPERTY COMPILE_DEFINITIONS COMPILE_OPTIONS LINK_DIRECTORIES LINK_LIBRARIES LINK_OPTIONS)
+    get_target_property(VALUE ${COMPILER_TARGET} ${PROPERTY})
+    if(VALUE)
+      set_property(TARGET ${PLUGIN_TARGET} PROPERTY ${PROPERTY} ${VALUE})
+    endif()
+  endforeach()
+
+  if(WIN32)
+    set_target_properties(${PLUGIN_TARGET} PROPERTIES VS_GLOBAL_VcpkgEnableManifest true)
+  endif()
+
+  add_dependencies(${PLUGIN_TARGET} GenesisCore GenesisResComp)
+
+  set_target_properties(${PLUGIN_TARGET} PROPERTIES LIBRARY_OUTPUT_DIRECTORY_DEBUG ${OUTPUT_DIRECTORY})
+  set_target_properties(${PLUGIN_TARGET} PROPERTIES LIBRARY_OUTPUT_DIRECTORY_RELEASE ${OUTPUT_DIRECTORY})
+  set_target_properties(${PLUGIN_TARGET} PROPERTIES LIBRARY_OUTPUT_DIRECTORY_FINAL ${OUTPUT_DIRECTORY})
+endfunction()
@@ -0,0 +1,160 @@
+// Copyright 2026 Pedro Nunes
+//
+// This file is part of Genesis.
+//
+// Genesis is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Genesis is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Genesis. If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "framearena.hpp"
+
+#include <atomic>
+#include <cstring>
+#include <new>
+
+namespace Genesis
+{
+
+static std::atomic<uint64_t> sFrame(0);
+
+FrameArena::FrameArena(size_t chunkSize /* = sDefaultChunkSize */)
+    : m_ChunkSize(chunkSize)
+    , m_pChunk(nullptr)
+    , m_pCursor(nullptr)
+    , m_pEnd(nullptr)
+    , m_UsedBytes(0)
+    , m_PeakBytes(0)
+    , m_Capacity(0)
+    , m_Frame(sFrame.load(std::memory_order_relaxed))
+{
+    AddChunk(m_ChunkSize);
+}
+
+FrameArena::~FrameArena()
+{
+    FreeChunks();
+}
+
+FrameArena& FrameArena::Get()
+{
+    thread_local FrameArena tArena;
+
+    const uint64_t frame = sFrame.load(std::memory_order_acquire);
+    if (tArena.m_Frame != frame)
+    {
+        tArena.Reset();
+        tArena.m_Frame = frame;
+    }
+    return tArena;
+}
+
+void FrameArena::EndFrame()
+{
+    sFrame.fetch_add(1, std::memory_order_release);
+}
+
+void FrameArena::Reset()
+{
+    // Fold overflow chunks into one chunk big enough for the whole of this frame.
+    if (m_pChunk->pPrevious != nullptr)
+    {
+        const size_t capacity = m_Capacity;
+        FreeChunks();
+        AddChunk(capacity);
+    }
+    else
+    {
+#if GENESIS_FRAME_ARENA_POISON
+        memset(GetChunkData(m_pChunk), sFramePoisonByte, m_pCursor - GetChunkData(m_pChunk));
+#endif
+        m_pCursor = GetChunkData(m_pChunk);
+    }
+
+    m_UsedBytes = 0;
+}
+
+void* FrameArena::do_allocate(size_t bytes, size_t alignment)
+{
+    uintptr_t address = (reinterpret_cast<uintptr_t>(m_pCursor) + alignment - 1) & ~(static_cast<uintptr_t>(alignment) - 1);
+    if (address + bytes > reinterpret_cast<uintptr_t>(m_pEnd))
+    {
+        AddChunk(bytes + alignment);
+        address = (reinterpret_cast<uintptr_t>(m_pCursor) + alignment - 1) & ~(static_cast<uintptr_t>(alignment) - 1);
+    }
+
+    uint8_t* pMemory = reinterpret_cast<uint8_t*>(address);
+    m_UsedBytes += (pMemory + bytes) - m_pCursor;
+    m_pCursor = pMemory + bytes;
+
+    if (m_UsedBytes > m_PeakBytes)
+    {
+        m_PeakBytes = m_UsedBytes;
+    }
+
+    return pMemory;
+}
+
+void FrameArena::do_deallocate(void* pMemory, size_t bytes, size_t /* alignment */)
+{
+    // Most frees come from containers growing; if this was the latest allocation
+    // it can be handed out again straight away.
+    uint8_t* pBlock = reinterpret_cast<uint8_t*>(pMemory);
+    if (pBlock + bytes == m_pCursor)
+    {
+        m_UsedBytes -= bytes;
+        m_pCursor = pBlock;
+    }
+
+#if GENESIS_FRAME_ARENA_POISON
+    memset(pMemory, sFramePoisonByte, bytes);
+#endif
+}
+
+bool FrameArena::do_is_equal(const std::pmr::memory_resource& other) const noexcept
+{
+    return this == &other;
+}
+
+void FrameArena::AddChunk(size_t minimumSize)
+{
+    const size_t size = minimumSize > m_ChunkSize ? minimumSize : m_ChunkSize;
+    Chunk* pChunk = reinterpret_cast<Chunk*>(::operator new(sizeof(Chunk) + size));
+    pChunk->pPrevious = m_pChunk;
+    pChunk->size = size;
+
+    m_pChunk = pChunk;
+    m_pCursor = GetChunkData(pChunk);
+    m_pEnd = m_pCursor + size;
+    m_Capacity += size;
+}
+
+void FrameArena::FreeChunks()
+{
+    while (m_pChunk != nullptr)
+    {
+        Chunk* pPrevious = m_pChunk->pPrevious;
+        ::operator delete(m_pChunk);
+        m_pChunk = pPrevious;
+    }
+
+    m_pCursor = nullptr;
+    m_pEnd = nullptr;
+    m_Capacity = 0;
+}
+
+uint8_t* FrameArena::GetChunkData(Chunk* pChunk)
+{
+    return reinterpret_cast<uint8_t*>(pChunk) + sizeof(Chunk);
+}
+
+} // namespace Genesis
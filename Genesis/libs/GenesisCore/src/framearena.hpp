@@ -0,0 +1,127 @@
+// Copyright 2026 Pedro Nunes
+//
+// This file is part of Genesis.
+//
+// Genesis is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Genesis is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Genesis. If not, see <http://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <vector>
+
+// In debug builds, memory handed back to the arena is overwritten with
+// sFramePoisonByte so that anything still pointing at last frame's data
+// fails loudly rather than reading stale values.
+#ifndef GENESIS_FRAME_ARENA_POISON
+#ifdef NDEBUG
+#define GENESIS_FRAME_ARENA_POISON 0
+#else
+#define GENESIS_FRAME_ARENA_POISON 1
+#endif
+#endif
+
+namespace Genesis
+{
+
+//////////////////////////////////////////////////////////////////////////
+// FrameArena
+// Bump allocator for data which only lives until the end of the frame.
+// Every thread has its own arena, obtained through Get(), so allocating
+// never locks. Deallocation is a no-op: the whole arena is rewound the
+// first time its thread asks for it after EndFrame().
+// If a frame needs more than the arena's chunk, extra chunks are chained
+// and folded into a single larger chunk on the next reset, so a steady
+// workload settles into one allocation per thread.
+//
+// The arena is a std::pmr::memory_resource, so standard containers can
+// use it directly:
+//
+//     FrameVector<glm::vec3> positions(&FrameArena::Get());
+//
+// Containers using it must not be kept beyond the current frame.
+//////////////////////////////////////////////////////////////////////////
+
+class FrameArena : public std::pmr::memory_resource
+{
+public:
+    static constexpr size_t sDefaultChunkSize = 256 * 1024;
+    static constexpr uint8_t sFramePoisonByte = 0xDD;
+
+    explicit FrameArena(size_t chunkSize = sDefaultChunkSize);
+    ~FrameArena() override;
+
+    FrameArena(const FrameArena&) = delete;
+    FrameArena& operator=(const FrameArena&) = delete;
+
+    // Returns the calling thread's arena, rewound if a frame has ended since it was last used.
+    static FrameArena& Get();
+
+    // Called by the task manager once per frame, from the main thread.
+    static void EndFrame();
+
+    // Releases everything allocated from this arena. Only safe when no container still uses it.
+    void Reset();
+
+    size_t GetUsedBytes() const;
+    size_t GetPeakBytes() const; // Highest usage in a single frame.
+    size_t GetCapacity() const;
+
+protected:
+    void* do_allocate(size_t bytes, size_t alignment) override;
+    void do_deallocate(void* pMemory, size_t bytes, size_t alignment) override;
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+private:
+    struct Chunk
+    {
+        Chunk* pPrevious;
+        size_t size;
+    };
+
+    void AddChunk(size_t minimumSize);
+    void FreeChunks();
+    static uint8_t* GetChunkData(Chunk* pChunk);
+
+    size_t m_ChunkSize;
+    Chunk* m_pChunk; // Chunk currently being allocated from; earlier chunks are reached through pPrevious.
+    uint8_t* m_pCursor;
+    uint8_t* m_pEnd;
+    size_t m_UsedBytes;
+    size_t m_PeakBytes;
+    size_t m_Capacity;
+    uint64_t m_Frame;
+};
+
+inline size_t FrameArena::GetUsedBytes() const
+{
+    return m_UsedBytes;
+}
+
+inline size_t FrameArena::GetPeakBytes() const
+{
+    return m_PeakBytes;
+}
+
+inline size_t FrameArena::GetCapacity() const
+{
+    return m_Capacity;
+}
+
+template <typename T>
+using FrameVector = std::pmr::vector<T>;
+
+} // namespace Genesis
@@ -0,0 +1,185 @@
+// Copyright 2026 Pedro Nunes
+//
+// This file is part of Genesis.
+//
+// Genesis is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Genesis is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Genesis. If not, see <http://www.gnu.org/licenses/>.
+#pragma once
+
+// clang-format off
+#include <externalheadersbegin.hpp>
+#include <tinyxml2.h>
+#include <externalheadersend.hpp>
+// clang-format on
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <system_error>
+#include <unordered_map>
+#include <vector>
+
+#include "infodbserialization.hpp"
+#include "log.hpp"
+
+namespace Genesis::Serialization
+{
+
+// Compiles XML definitions into an info database. Each child of a file's root element becomes an entry,
+// identified by the text of its key element, which must be present and unique across all the files.
+// InfoDbComp and the game's XML fallback both compile through this class, so they build the same database.
+// Like infodbserialization.hpp, it is header only: its users provide tinyxml2 and bitsery.
+class InfoDatabaseCompiler
+{
+public:
+    InfoDatabaseCompiler(InfoDatabase& database, const std::string& keyElement = "Name")
+        : m_Database(database)
+        , m_KeyElement(keyElement)
+    {
+        m_Database.header.format = "IFDB";
+        m_Database.header.version = sInfoDatabaseVersion;
+        m_Database.strings.clear();
+        m_Database.entries.clear();
+        Intern("");
+    }
+
+    // Returns the XML files in the directory, sorted so that the database doesn't depend on the order
+    // in which the file system lists them.
+    static std::vector<std::filesystem::path> GetSourceFiles(const std::filesystem::path& sourceDirectory)
+    {
+        std::vector<std::filesystem::path> sourceFiles;
+        std::error_code errorCode;
+        for (const auto& entry : std::filesystem::directory_iterator(sourceDirectory, errorCode))
+        {
+            if (entry.path().extension() == ".xml")
+            {
+                sourceFiles.push_back(entry.path());
+            }
+        }
+
+        if (errorCode)
+        {
+            Log::Error() << "Couldn't list " << sourceDirectory << ": " << errorCode.message();
+        }
+
+        std::sort(sourceFiles.begin(), sourceFiles.end());
+        return sourceFiles;
+    }
+
+    // Errors are logged. If the file can't be compiled, none of its entries are added to the database.
+    bool CompileFile(const std::filesystem::path& sourceFile)
+    {
+        std::ifstream file(sourceFile, std::ios::in | std::ios::binary);
+        if (file.good() == false)
+        {
+            Log::Error() << sourceFile << ": couldn't open file.";
+            return false;
+        }
+
+        const std::string contents((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+        tinyxml2::XMLDocument xmlDoc;
+        if (xmlDoc.Parse(contents.data(), contents.size()) != tinyxml2::XML_SUCCESS)
+        {
+            Log::Error() << sourceFile << ": " << xmlDoc.ErrorStr();
+            return false;
+        }
+
+        const tinyxml2::XMLElement* pRootElement = xmlDoc.FirstChildElement();
+        if (pRootElement == nullptr)
+        {
+            Log::Error() << sourceFile << ": no root element.";
+            return false;
+        }
+
+        std::vector<InfoDatabaseEntry> entries;
+        std::unordered_map<uint32_t, int> fileKeys; // Key to the line which defined it, for duplicates within this file.
+        for (const tinyxml2::XMLElement* pEntryElement = pRootElement->FirstChildElement(); pEntryElement != nullptr; pEntryElement = pEntryElement->NextSiblingElement())
+        {
+            const tinyxml2::XMLElement* pKeyElement = pEntryElement->FirstChildElement(m_KeyElement.c_str());
+            if (pKeyElement == nullptr || pKeyElement->GetText() == nullptr)
+            {
+                Log::Error() << sourceFile << ": entry on line " << pEntryElement->GetLineNum() << " has no <" << m_KeyElement << ">.";
+                return false;
+            }
+
+            InfoDatabaseEntry entry;
+            entry.key = Intern(pKeyElement->GetText());
+
+            auto itKey = m_Keys.find(entry.key);
+            if (itKey != m_Keys.end())
+            {
+                Log::Error() << sourceFile << ": '" << pKeyElement->GetText() << "' is already defined in " << itKey->second;
+                return false;
+            }
+
+            auto itFileKey = fileKeys.find(entry.key);
+            if (itFileKey != fileKeys.end())
+            {
+                Log::Error() << sourceFile << ": '" << pKeyElement->GetText() << "' is already defined on line " << itFileKey->second;
+                return false;
+            }
+            fileKeys[entry.key] = pEntryElement->GetLineNum();
+
+            CompileElement(pEntryElement, entry.element);
+            entries.push_back(std::move(entry));
+        }
+
+        for (InfoDatabaseEntry& entry : entries)
+        {
+            m_Keys[entry.key] = sourceFile;
+            m_Database.entries.push_back(std::move(entry));
+        }
+        return true;
+    }
+
+private:
+    void CompileElement(const tinyxml2::XMLElement* pXmlElement, InfoDatabaseElement& element)
+    {
+        element.name = Intern(pXmlElement->Value());
+        element.text = Intern(pXmlElement->GetText() == nullptr ? "" : pXmlElement->GetText());
+
+        for (const tinyxml2::XMLAttribute* pAttribute = pXmlElement->FirstAttribute(); pAttribute != nullptr; pAttribute = pAttribute->Next())
+        {
+            element.attributes.push_back({Intern(pAttribute->Name()), Intern(pAttribute->Value())});
+        }
+
+        for (const tinyxml2::XMLElement* pChildElement = pXmlElement->FirstChildElement(); pChildElement != nullptr; pChildElement = pChildElement->NextSiblingElement())
+        {
+            element.children.emplace_back();
+            CompileElement(pChildElement, element.children.back());
+        }
+    }
+
+    uint32_t Intern(const char* pText)
+    {
+        auto it = m_StringIndices.find(pText);
+        if (it != m_StringIndices.end())
+        {
+            return it->second;
+        }
+
+        const uint32_t index = static_cast<uint32_t>(m_Database.strings.size());
+        m_Database.strings.emplace_back(pText);
+        m_StringIndices[m_Database.strings.back()] = index;
+        return index;
+    }
+
+    InfoDatabase& m_Database;
+    std::string m_KeyElement;
+    std::unordered_map<std::string, uint32_t> m_StringIndices;
+    std::unordered_map<uint32_t, std::filesystem::path> m_Keys; // Key to the file which defined it, to report duplicates.
+};
+
+} // namespace Genesis::Serialization
@@ -0,0 +1,157 @@
+// Copyright 2026 Pedro Nunes
+//
+// This file is part of Genesis.
+//
+// Genesis is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Genesis is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Genesis. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// clang-format off
+#include <externalheadersbegin.hpp>
+#include <bitsery/bitsery.h>
+#include <bitsery/adapter/stream.h>
+#include <bitsery/traits/string.h>
+#include <bitsery/traits/vector.h>
+#include <externalheadersend.hpp>
+// clang-format on
+
+#include <string>
+#include <vector>
+
+namespace Genesis::Serialization
+{
+
+// An info database is a set of XML definitions (such as modules) compiled by InfoDbComp.
+// Every string is stored once in the database's string table and referenced by index,
+// and every top level definition is an entry, identified by its key.
+// This header is shared by InfoDbComp and the game, which both need bitsery in their include path.
+
+static const uint8_t sInfoDatabaseVersion = 2;
+static const size_t sInfoDatabaseMaxEntries = 1000000;
+static const size_t sInfoDatabaseMaxStringLength = 65536;
+
+struct InfoDatabaseHeader
+{
+    std::string format;
+    uint8_t version;
+};
+
+template <typename S> void serialize(S& s, InfoDatabaseHeader& header)
+{
+    s.text1b(header.format, 4);
+    s.value1b(header.version);
+}
+
+struct InfoDatabaseAttribute
+{
+    uint32_t name;
+    uint32_t value;
+};
+
+template <typename S> void serialize(S& s, InfoDatabaseAttribute& attribute)
+{
+    s.value4b(attribute.name);
+    s.value4b(attribute.value);
+}
+
+struct InfoDatabaseElement
+{
+    uint32_t name;
+    uint32_t text; // Index 0 of the string table is always the empty string.
+    std::vector<InfoDatabaseAttribute> attributes;
+    std::vector<InfoDatabaseElement> children;
+};
+
+template <typename S> void serialize(S& s, InfoDatabaseElement& element)
+{
+    s.value4b(element.name);
+    s.value4b(element.text);
+    s.container(element.attributes, sInfoDatabaseMaxEntries);
+    s.container(element.children, sInfoDatabaseMaxEntries);
+}
+
+struct InfoDatabaseEntry
+{
+    uint32_t key; // Text of the entry's key element, such as a module's <Name>.
+    InfoDatabaseElement element;
+};
+
+template <typename S> void serialize(S& s, InfoDatabaseEntry& entry)
+{
+    s.value4b(entry.key);
+    s.object(entry.element);
+}
+
+struct InfoDatabase
+{
+    InfoDatabaseHeader header;
+    std::vector<std::string> strings;
+    std::vector<InfoDatabaseEntry> entries;
+};
+
+template <typename S> void serialize(S& s, InfoDatabase& database)
+{
+    s.object(database.header);
+    s.container(database.strings, sInfoDatabaseMaxEntries, [](S& s, std::string& str) { s.text1b(str, sInfoDatabaseMaxStringLength); });
+    s.container(database.entries, sInfoDatabaseMaxEntries);
+}
+
+// Returns false if any element references a string which isn't in the string table,
+// which can only happen if the database is corrupted.
+inline bool IsValid(const InfoDatabase& database, const InfoDatabaseElement& element)
+{
+    const size_t stringCount = database.strings.size();
+    if (element.name >= stringCount || element.text >= stringCount)
+    {
+        return false;
+    }
+
+    for (const InfoDatabaseAttribute& attribute : element.attributes)
+    {
+        if (attribute.name >= stringCount || attribute.value >= stringCount)
+        {
+            return false;
+        }
+    }
+
+    for (const InfoDatabaseElement& child : element.children)
+    {
+        if (IsValid(database, child) == false)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+inline bool IsValid(const InfoDatabase& database)
+{
+    if (database.header.format != "IFDB" || database.header.version != sInfoDatabaseVersion || database.strings.empty() || database.strings[0].empty() == false)
+    {
+        return false;
+    }
+
+    for (const InfoDatabaseEntry& entry : database.entries)
+    {
+        if (entry.key >= database.strings.size() || IsValid(database, entry.element) == false)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+} // namespace Genesis::Serialization
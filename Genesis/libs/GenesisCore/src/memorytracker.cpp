@@ -0,0 +1,314 @@
+// Copyright 2026 Pedro Nunes
+//
+// This file is part of Genesis.
+//
+// Genesis is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Genesis is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Genesis. If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "memorytracker.hpp"
+
+#if GENESIS_MEMORY_TRACKING
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdlib>
+#include <iomanip>
+#include <new>
+
+#include "log.hpp"
+
+namespace Genesis
+{
+
+// Every tracked allocation is preceded by a header recording how to account for it when it's freed.
+struct AllocationHeader
+{
+    uint64_t size;
+    uint32_t offset; // From the start of the underlying block to the pointer handed out.
+    MemoryTag tag;
+};
+
+static constexpr size_t sHeaderSize = 16;
+static_assert(sizeof(AllocationHeader) <= sHeaderSize, "AllocationHeader must fit in front of a 16 byte aligned allocation.");
+
+struct TagCounters
+{
+    std::atomic<int64_t> liveBytes;
+    std::atomic<int64_t> peakBytes;
+    std::atomic<int64_t> liveAllocations;
+    std::atomic<uint64_t> allocationsThisFrame;
+    std::atomic<uint64_t> totalAllocations;
+    uint64_t allocationsLastFrame;
+};
+
+// All of these are zero-initialised statics, so they are usable by allocations made before main().
+static constexpr size_t sTagCount = static_cast<size_t>(MemoryTag::Count);
+static std::array<TagCounters, sTagCount> sCounters;
+static float sLiveBytesHistory[sTagCount][MemoryTracker::sHistorySize];
+static float sAllocationsHistory[sTagCount][MemoryTracker::sHistorySize];
+static int sHistoryOffset;
+static thread_local MemoryTag tCurrentTag = MemoryTag::Untagged;
+
+static void UpdatePeak(std::atomic<int64_t>& peak, int64_t value)
+{
+    int64_t current = peak.load(std::memory_order_relaxed);
+    while (value > current && !peak.compare_exchange_weak(current, value, std::memory_order_relaxed))
+    {
+    }
+}
+
+void* MemoryTracker::Allocate(size_t size, size_t alignment /* = alignof(std::max_align_t) */)
+{
+    return Allocate(size, alignment, tCurrentTag);
+}
+
+void* MemoryTracker::Allocate(size_t size, size_t alignment, MemoryTag tag)
+{
+    alignment = std::max(alignment, sHeaderSize);
+    uint8_t* pBlock = static_cast<uint8_t*>(std::malloc(size + sHeaderSize + alignment - 1));
+    if (pBlock == nullptr)
+    {
+        return nullptr;
+    }
+
+    const uintptr_t address = (reinterpret_cast<uintptr_t>(pBlock) + sHeaderSize + alignment - 1) & ~static_cast<uintptr_t>(alignment - 1);
+    uint8_t* pMemory = reinterpret_cast<uint8_t*>(address);
+    AllocationHeader* pHeader = reinterpret_cast<AllocationHeader*>(pMemory - sHeaderSize);
+    pHeader->size = size;
+    pHeader->offset = static_cast<uint32_t>(pMemory - pBlock);
+    pHeader->tag = tag;
+
+    TagCounters& counters = sCounters[static_cast<size_t>(tag)];
+    const int64_t liveBytes = counters.liveBytes.fetch_add(static_cast<int64_t>(size), std::memory_order_relaxed) + static_cast<int64_t>(size);
+    UpdatePeak(counters.peakBytes, liveBytes);
+    counters.liveAllocations.fetch_add(1, std::memory_order_relaxed);
+    counters.allocationsThisFrame.fetch_add(1, std::memory_order_relaxed);
+    counters.totalAllocations.fetch_add(1, std::memory_order_relaxed);
+
+    return pMemory;
+}
+
+void MemoryTracker::Free(void* pMemory)
+{
+    if (pMemory == nullptr)
+    {
+        return;
+    }
+
+    uint8_t* pBytes = static_cast<uint8_t*>(pMemory);
+    const AllocationHeader* pHeader = reinterpret_cast<const AllocationHeader*>(pBytes - sHeaderSize);
+    TagCounters& counters = sCounters[static_cast<size_t>(pHeader->tag)];
+    counters.liveBytes.fetch_sub(static_cast<int64_t>(pHeader->size), std::memory_order_relaxed);
+    counters.liveAllocations.fetch_sub(1, std::memory_order_relaxed);
+
+    std::free(pBytes - pHeader->offset);
+}
+
+MemoryTag MemoryTracker::GetCurrentTag()
+{
+    return tCurrentTag;
+}
+
+void MemoryTracker::SetCurrentTag(MemoryTag tag)
+{
+    tCurrentTag = tag;
+}
+
+const char* MemoryTracker::GetTagName(MemoryTag tag)
+{
+    switch (tag)
+    {
+    case MemoryTag::Untagged:
+        return "Untagged";
+    case MemoryTag::Resources:
+        return "Resources";
+    case MemoryTag::Render:
+        return "Render";
+    case MemoryTag::Sound:
+        return "Sound";
+    case MemoryTag::Physics:
+        return "Physics";
+    case MemoryTag::Particles:
+        return "Particles";
+    case MemoryTag::Trails:
+        return "Trails";
+    case MemoryTag::Ammo:
+        return "Ammo";
+    case MemoryTag::Entities:
+        return "Entities";
+    default:
+        return "Unknown";
+    }
+}
+
+MemoryTagStats MemoryTracker::GetStats(MemoryTag tag)
+{
+    const TagCounters& counters = sCounters[static_cast<size_t>(tag)];
+    MemoryTagStats stats;
+    stats.liveBytes = counters.liveBytes.load(std::memory_order_relaxed);
+    stats.peakBytes = counters.peakBytes.load(std::memory_order_relaxed);
+    stats.liveAllocations = counters.liveAllocations.load(std::memory_order_relaxed);
+    stats.allocationsLastFrame = counters.allocationsLastFrame;
+    stats.totalAllocations = counters.totalAllocations.load(std::memory_order_relaxed);
+    return stats;
+}
+
+const float* MemoryTracker::GetLiveBytesHistory(MemoryTag tag)
+{
+    return sLiveBytesHistory[static_cast<size_t>(tag)];
+}
+
+const float* MemoryTracker::GetAllocationsHistory(MemoryTag tag)
+{
+    return sAllocationsHistory[static_cast<size_t>(tag)];
+}
+
+int MemoryTracker::GetHistoryOffset()
+{
+    return sHistoryOffset;
+}
+
+void MemoryTracker::EndFrame()
+{
+    for (size_t i = 0; i < sTagCount; ++i)
+    {
+        TagCounters& counters = sCounters[i];
+        counters.allocationsLastFrame = counters.allocationsThisFrame.exchange(0, std::memory_order_relaxed);
+        sLiveBytesHistory[i][sHistoryOffset] = static_cast<float>(counters.liveBytes.load(std::memory_order_relaxed));
+        sAllocationsHistory[i][sHistoryOffset] = static_cast<float>(counters.allocationsLastFrame);
+    }
+    sHistoryOffset = (sHistoryOffset + 1) % static_cast<int>(sHistorySize);
+}
+
+void MemoryTracker::Dump()
+{
+    Log::Info() << "Memory tracking summary:";
+    for (size_t i = 0; i < sTagCount; ++i)
+    {
+        const MemoryTag tag = static_cast<MemoryTag>(i);
+        const MemoryTagStats stats = GetStats(tag);
+        Log::Info() << "- " << std::left << std::setw(10) << GetTagName(tag) << std::right
+                    << " live " << std::setw(10) << stats.liveBytes / 1024 << " KB in " << std::setw(8) << stats.liveAllocations << " allocations,"
+                    << " peak " << std::setw(10) << stats.peakBytes / 1024 << " KB, " << stats.totalAllocations << " allocations in total";
+    }
+}
+
+} // namespace Genesis
+
+///////////////////////////////////////////////////////////////////////////////
+// Global allocation operators
+///////////////////////////////////////////////////////////////////////////////
+
+void* operator new(std::size_t size)
+{
+    void* pMemory = Genesis::MemoryTracker::Allocate(size);
+    if (pMemory == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    return pMemory;
+}
+
+void* operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+    void* pMemory = Genesis::MemoryTracker::Allocate(size, static_cast<std::size_t>(alignment));
+    if (pMemory == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    return pMemory;
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment)
+{
+    return operator new(size, alignment);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    return Genesis::MemoryTracker::Allocate(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+    return Genesis::MemoryTracker::Allocate(size);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    return Genesis::MemoryTracker::Allocate(size, static_cast<std::size_t>(alignment));
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    return Genesis::MemoryTracker::Allocate(size, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void* pMemory) noexcept
+{
+    Genesis::MemoryTracker::Free(pMemory);
+}
+
+void operator delete[](void* pMemory) noexcept
+{
+    Genesis::MemoryTracker::Free(pMemory);
+}
+
+void operator delete(void* pMemory, std::size_t) noexcept
+{
+    Genesis::MemoryTracker::Free(pMemory);
+}
+
+void operator delete[](void* pMemory, std::size_t) noexcept
+{
+    Genesis::MemoryTracker::Free(pMemory);
+}
+
+void operator delete(void* pMemory, std::align_val_t) noexcept
+{
+    Genesis::MemoryTracker::Free(pMemory);
+}
+
+void operator delete[](void* pMemory, std::align_val_t) noexcept
+{
+    Genesis::MemoryTracker::Free(pMemory);
+}
+
+void operator delete(void* pMemory, std::size_t, std::align_val_t) noexcept
+{
+    Genesis::MemoryTracker::Free(pMemory);
+}
+
+void operator delete[](void* pMemory, std::size_t, std::align_val_t) noexcept
+{
+    Genesis::MemoryTracker::Free(pMemory);
+}
+
+void operator delete(void* pMemory, const std::nothrow_t&) noexcept
+{
+    Genesis::MemoryTracker::Free(pMemory);
+}
+
+void operator delete[](void* pMemory, const std::nothrow_t&) noexcept
+{
+    Genesis::MemoryTracker::Free(pMemory);
+}
+
+#endif // GENESIS_MEMORY_TRACKING
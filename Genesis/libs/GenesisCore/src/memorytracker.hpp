@@ -0,0 +1,135 @@
+// Copyright 2026 Pedro Nunes
+//
+// This file is part of Genesis.
+//
+// Genesis is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Genesis is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Genesis. If not, see <http://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Memory tracking is only built in debug builds. It replaces the global
+// allocation operators, so release builds must not pay for it at all.
+#ifndef GENESIS_MEMORY_TRACKING
+#ifdef NDEBUG
+#define GENESIS_MEMORY_TRACKING 0
+#else
+#define GENESIS_MEMORY_TRACKING 1
+#endif
+#endif
+
+namespace Genesis
+{
+
+enum class MemoryTag : uint8_t
+{
+    Untagged,
+    Resources,
+    Render,
+    Sound,
+    Physics,
+    Particles,
+    Trails,
+    Ammo,
+    Entities,
+
+    Count
+};
+
+#if GENESIS_MEMORY_TRACKING
+
+struct MemoryTagStats
+{
+    int64_t liveBytes;
+    int64_t peakBytes;
+    int64_t liveAllocations;
+    uint64_t allocationsLastFrame;
+    uint64_t totalAllocations;
+};
+
+//////////////////////////////////////////////////////////////////////////
+// MemoryTracker
+// Attributes every allocation made through operator new, or explicitly
+// through Allocate(), to the MemoryTag active on the allocating thread.
+// Counters are lock-free and can be updated from any thread; EndFrame()
+// and the history accessors are meant for the main thread.
+//////////////////////////////////////////////////////////////////////////
+
+class MemoryTracker
+{
+public:
+    static constexpr size_t sHistorySize = 256;
+
+    static void* Allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+    static void* Allocate(size_t size, size_t alignment, MemoryTag tag);
+    static void Free(void* pMemory);
+
+    static MemoryTag GetCurrentTag();
+    static const char* GetTagName(MemoryTag tag);
+    static MemoryTagStats GetStats(MemoryTag tag);
+
+    // Ring buffers with sHistorySize entries; the oldest entry is at GetHistoryOffset().
+    static const float* GetLiveBytesHistory(MemoryTag tag);
+    static const float* GetAllocationsHistory(MemoryTag tag);
+    static int GetHistoryOffset();
+
+    static void EndFrame();
+    static void Dump();
+
+private:
+    friend class ScopedMemoryTag;
+    static void SetCurrentTag(MemoryTag tag);
+};
+
+//////////////////////////////////////////////////////////////////////////
+// ScopedMemoryTag
+// Allocations made by this thread while the scope is alive are counted
+// against the given tag. Use through GENESIS_MEMORY_SCOPE so that it
+// disappears from builds without memory tracking.
+//////////////////////////////////////////////////////////////////////////
+
+class ScopedMemoryTag
+{
+public:
+    explicit ScopedMemoryTag(MemoryTag tag)
+        : m_PreviousTag(MemoryTracker::GetCurrentTag())
+    {
+        MemoryTracker::SetCurrentTag(tag);
+    }
+
+    ~ScopedMemoryTag()
+    {
+        MemoryTracker::SetCurrentTag(m_PreviousTag);
+    }
+
+    ScopedMemoryTag(const ScopedMemoryTag&) = delete;
+    ScopedMemoryTag& operator=(const ScopedMemoryTag&) = delete;
+
+private:
+    MemoryTag m_PreviousTag;
+};
+
+#define GENESIS_MEMORY_SCOPE_CONCAT_INNER(a, b) a##b
+#define GENESIS_MEMORY_SCOPE_CONCAT(a, b) GENESIS_MEMORY_SCOPE_CONCAT_INNER(a, b)
+#define GENESIS_MEMORY_SCOPE(tag) ::Genesis::ScopedMemoryTag GENESIS_MEMORY_SCOPE_CONCAT(memoryScope, __LINE__)(::Genesis::MemoryTag::tag)
+
+#else
+
+#define GENESIS_MEMORY_SCOPE(tag)
+
+#endif // GENESIS_MEMORY_TRACKING
+
+} // namespace Genesis
@@ -0,0 +1,120 @@
+// Copyright 2026 Pedro Nunes
+//
+// This file is part of Genesis.
+//
+// Genesis is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Genesis is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Genesis. If not, see <http://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+#include <cstdint>
+#include <exception>
+#include <memory>
+
+#if defined(_WIN32)
+#define GENESIS_COMPILER_PLUGIN_EXPORT extern "C" __declspec(dllexport)
+#else
+#define GENESIS_COMPILER_PLUGIN_EXPORT extern "C" __attribute__((visibility("default")))
+#endif
+
+namespace Genesis
+{
+namespace ResComp
+{
+
+//////////////////////////////////////////////////////////////////////////
+// Compiler plugins
+// Every compiler is also built as a shared library which Forge loads once
+// and keeps for all the assets it compiles, avoiding a process launch and
+// the compiler's own start up (such as ShaderComp's GL context) per asset.
+// Forge and each plugin link their own copies of GenesisCore and, on
+// Windows, of the C runtime, so only plain C types cross the boundary.
+//////////////////////////////////////////////////////////////////////////
+
+static const uint32_t sCompilerPluginVersion = 1;
+static const char* const sCompilerPluginEntryPoint = "GetCompilerPlugin";
+
+// Implemented by Forge. Replaces the RPC calls a compiler makes when running as a separate process.
+struct CompilerPluginHost
+{
+    void* pContext;
+    void (*OnResourceBuilt)(void* pContext, const char* pAsset, const char* pSourceFile, const char* pDestinationFile);
+    void (*OnAssetCompilationFailed)(void* pContext, const char* pAsset, const char* pReason);
+    void (*Log)(void* pContext, const char* pText, int level);
+};
+
+// Implemented by the plugin and returned by its GetCompilerPlugin() entry point.
+struct CompilerPlugin
+{
+    uint32_t version;
+    void* (*Create)(const CompilerPluginHost* pHost); // Returns nullptr if the compiler failed to initialize.
+    int (*Compile)(void* pCompiler, const char* pAssetsDir, const char* pDataDir, const char* pFile); // Same return value as the executable's exit code.
+    void (*Destroy)(void* pCompiler);
+};
+
+using GetCompilerPluginFunction = const CompilerPlugin* (*)();
+
+template <typename T> const CompilerPlugin* GetCompilerPluginFor()
+{
+    static const CompilerPlugin sPlugin = {
+        sCompilerPluginVersion,
+        [](const CompilerPluginHost* pHost) -> void* {
+            // An exception must not unwind into Forge, so one thrown by construction or initialization fails the plugin.
+            try
+            {
+                std::unique_ptr<T> pCompiler = std::make_unique<T>();
+                if (pCompiler->InitializePlugin(pHost) == false)
+                {
+                    return nullptr;
+                }
+                return pCompiler.release();
+            }
+            catch (...)
+            {
+                return nullptr;
+            }
+        },
+        [](void* pCompiler, const char* pAssetsDir, const char* pDataDir, const char* pFile) -> int {
+            // An exception must not unwind into Forge, so it fails this asset only.
+            T* pTypedCompiler = static_cast<T*>(pCompiler);
+            try
+            {
+                return pTypedCompiler->CompileAsset(pAssetsDir, pDataDir, pFile);
+            }
+            catch (const std::exception& e)
+            {
+                pTypedCompiler->OnAssetCompilationFailed(pFile, e.what());
+                return -1;
+            }
+            catch (...)
+            {
+                pTypedCompiler->OnAssetCompilationFailed(pFile, "Unknown exception.");
+                return -1;
+            }
+        },
+        [](void* pCompiler) {
+            delete static_cast<T*>(pCompiler);
+        }};
+    return &sPlugin;
+}
+
+} // namespace ResComp
+} // namespace Genesis
+
+// Exposes a ResComp-derived class as a plugin. Use exactly once per compiler, outside of any namespace.
+#define GENESIS_DEFINE_COMPILER_PLUGIN(CompilerClass) \
+    GENESIS_COMPILER_PLUGIN_EXPORT const Genesis::ResComp::CompilerPlugin* GetCompilerPlugin() \
+    { \
+        return Genesis::ResComp::GetCompilerPluginFor<CompilerClass>(); \
+    }
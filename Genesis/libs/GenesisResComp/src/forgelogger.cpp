@@ -33,5 +33,15 @@ void ForgeLogger::Log(const std::string& text, Log::Level type)
     m_pRPCClient->call("log", text, static_cast<int>(type));
 }
 
+PluginLogger::PluginLogger(const CompilerPluginHost* pHost)
+    : m_pHost(pHost)
+{
+}
+
+void PluginLogger::Log(const std::string& text, Log::Level type)
+{
+    m_pHost->Log(m_pHost->pContext, text.c_str(), static_cast<int>(type));
+}
+
 } // namespace ResComp
 } // namespace Genesis
\ No newline at end of file
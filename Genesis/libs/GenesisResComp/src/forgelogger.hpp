@@ -27,6 +27,8 @@
 #include <log.hpp>
 #include <memory>
 
+#include "compilerplugin.hpp"
+
 namespace Genesis
 {
 
@@ -43,5 +45,16 @@ private:
     rpc::client* m_pRPCClient;
 };
 
+// Used when running as a plugin, where Forge's log is reached directly rather than over RPC.
+class PluginLogger : public ILogTarget
+{
+public:
+    PluginLogger(const CompilerPluginHost* pHost);
+    virtual void Log(const std::string& text, Log::Level type) override;
+
+private:
+    const CompilerPluginHost* m_pHost;
+};
+
 } // namespace ResComp
 } // namespace Genesis
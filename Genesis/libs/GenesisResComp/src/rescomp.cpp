@@ -41,6 +41,7 @@ namespace ResComp
 
 ResComp::ResComp()
     : m_UsingForge(false)
+    , m_pPluginHost(nullptr)
 {
 }
 
@@ -100,17 +101,12 @@ bool ResComp::Initialize(int argc, char** argv)
         Log::AddLogTarget(std::make_shared<TTYLogger>());
     }
 
-    m_AssetsDir = std::filesystem::canonical(std::filesystem::path(parser.get<std::string>("a")));
-    m_DataDir = std::filesystem::canonical(std::filesystem::path(parser.get<std::string>("d")));
-    m_File = std::filesystem::canonical(std::filesystem::path(parser.get<std::string>("f")));
-
-    if (StringStartsWith(m_File, m_AssetsDir) == false)
+    if (SetPaths(parser.get<std::string>("a"), parser.get<std::string>("d"), parser.get<std::string>("f")) == false)
     {
-        Log::Error() << "File " << m_File << " it not in " << m_AssetsDir;
         return false;
     }
 
-    return true;
+    return OnInitialize();
 }
 
 int ResComp::Run()
@@ -118,6 +114,53 @@ int ResComp::Run()
     return 0;
 }
 
+bool ResComp::InitializePlugin(const CompilerPluginHost* pHost)
+{
+    m_pPluginHost = pHost;
+    Log::AddLogTarget(std::make_shared<PluginLogger>(pHost));
+    return OnInitialize();
+}
+
+int ResComp::CompileAsset(const std::filesystem::path& assetsDir, const std::filesystem::path& dataDir, const std::filesystem::path& file)
+{
+    if (SetPaths(assetsDir, dataDir, file) == false)
+    {
+        return -1;
+    }
+
+    return Run();
+}
+
+bool ResComp::OnInitialize()
+{
+    return true;
+}
+
+bool ResComp::SetPaths(const std::filesystem::path& assetsDir, const std::filesystem::path& dataDir, const std::filesystem::path& file)
+{
+    std::error_code errorCode;
+    for (const std::filesystem::path& path : {assetsDir, dataDir, file})
+    {
+        if (std::filesystem::exists(path, errorCode) == false)
+        {
+            Log::Error() << "Path " << path << " doesn't exist.";
+            return false;
+        }
+    }
+
+    m_AssetsDir = std::filesystem::canonical(assetsDir);
+    m_DataDir = std::filesystem::canonical(dataDir);
+    m_File = std::filesystem::canonical(file);
+
+    if (StringStartsWith(m_File, m_AssetsDir) == false)
+    {
+        Log::Error() << "File " << m_File << " it not in " << m_AssetsDir;
+        return false;
+    }
+
+    return true;
+}
+
 const std::filesystem::path& ResComp::GetAssetsDir() const
 {
     return m_AssetsDir;
@@ -140,7 +183,11 @@ bool ResComp::IsUsingForge() const
 
 void ResComp::OnResourceBuilt(const std::filesystem::path& asset, const std::filesystem::path& sourceFile, const std::filesystem::path& destinationFile)
 {
-    if (IsUsingForge())
+    if (m_pPluginHost != nullptr)
+    {
+        m_pPluginHost->OnResourceBuilt(m_pPluginHost->pContext, asset.generic_string().c_str(), sourceFile.generic_string().c_str(), destinationFile.generic_string().c_str());
+    }
+    else if (IsUsingForge())
     {
         m_pRPCClient->send("cache", asset.generic_string(), sourceFile.generic_string(), destinationFile.generic_string());
     }
@@ -148,7 +195,11 @@ void ResComp::OnResourceBuilt(const std::filesystem::path& asset, const std::fil
 
 void ResComp::OnAssetCompilationFailed(const std::filesystem::path& asset, const std::string& reason)
 {
-    if (IsUsingForge())
+    if (m_pPluginHost != nullptr)
+    {
+        m_pPluginHost->OnAssetCompilationFailed(m_pPluginHost->pContext, asset.generic_string().c_str(), reason.c_str());
+    }
+    else if (IsUsingForge())
     {
         m_pRPCClient->send("failed", asset.generic_string(), reason);
     }
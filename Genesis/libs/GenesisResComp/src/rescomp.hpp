@@ -27,6 +27,8 @@
 #include <filesystem>
 #include <memory>
 
+#include "compilerplugin.hpp"
+
 namespace Genesis
 {
 
@@ -44,6 +46,10 @@ public:
     virtual bool Initialize(int argc, char** argv);
     virtual int Run();
 
+    // Used when loaded by Forge as a plugin: initialized once, then asked to compile any number of files.
+    bool InitializePlugin(const CompilerPluginHost* pHost);
+    int CompileAsset(const std::filesystem::path& assetsDir, const std::filesystem::path& dataDir, const std::filesystem::path& file);
+
     const std::filesystem::path& GetAssetsDir() const;
     const std::filesystem::path& GetDataDir() const;
     const std::filesystem::path& GetFile() const;
@@ -51,12 +57,19 @@ public:
     void OnResourceBuilt(const std::filesystem::path& asset, const std::filesystem::path& sourceFile, const std::filesystem::path& destinationFile);
     void OnAssetCompilationFailed(const std::filesystem::path& asset, const std::string& reason);
 
+protected:
+    // One-off setup shared by the executable and the plugin, called at the end of initialization.
+    virtual bool OnInitialize();
+
 private:
+    bool SetPaths(const std::filesystem::path& assetsDir, const std::filesystem::path& dataDir, const std::filesystem::path& file);
+
     std::filesystem::path m_AssetsDir;
     std::filesystem::path m_DataDir;
     std::filesystem::path m_File;
     bool m_UsingForge;
     RPCClientUniquePtr m_pRPCClient;
+    const CompilerPluginHost* m_pPluginHost;
 };
 
 } // namespace ResComp
@@ -23,7 +23,10 @@
 #include "imgui/imgui.h"
 #include "imgui/imgui_impl.h"
 #include "inputmanager.h"
+#include "physics/simulation.h"
 #include "memory.h"
+#include "memorytrackerwindow.h"
+#include "performancecounterswindow.h"
 #include "render/debugrender.h"
 #include "render/viewport.hpp"
 #include "rendersystem.h"
@@ -54,6 +57,10 @@ Gui::GuiManager* gGuiManager = nullptr;
 Sound::SoundManager* gSoundManager = nullptr;
 VideoPlayer* gVideoPlayer = nullptr;
 Render::DebugRender* gDebugRender = nullptr;
+PerformanceCountersWindow* gPerformanceCountersWindow = nullptr;
+#if GENESIS_MEMORY_TRACKING
+MemoryTrackerWindow* gMemoryTrackerWindow = nullptr;
+#endif
 
 CommandLineParameters* FrameWork::m_pCommandLineParameters = nullptr;
 
@@ -63,6 +70,10 @@ CommandLineParameters* FrameWork::m_pCommandLineParameters = nullptr;
 
 bool FrameWork::Initialize()
 {
+#if GENESIS_MEMORY_TRACKING
+    Physics::Simulation::TrackAllocations();
+#endif
+
     Log::AddLogTarget(std::make_shared<FileLogger>("log.txt"));
     Log::AddLogTarget(std::make_shared<MessageBoxLogger>());
 
@@ -121,6 +132,14 @@ bool FrameWork::Initialize()
     gSoundManager = new Sound::SoundManager();
     gTaskManager->AddTask("SoundManager", gSoundManager, (TaskFunc)&Sound::SoundManager::Update, TaskPriority::System);
 
+    gPerformanceCountersWindow = new PerformanceCountersWindow();
+    gTaskManager->AddTask("PerformanceCountersWindow", gPerformanceCountersWindow, (TaskFunc)&PerformanceCountersWindow::Update, TaskPriority::GameLogic);
+
+#if GENESIS_MEMORY_TRACKING
+    gMemoryTrackerWindow = new MemoryTrackerWindow();
+    gTaskManager->AddTask("MemoryTrackerWindow", gMemoryTrackerWindow, (TaskFunc)&MemoryTrackerWindow::Update, TaskPriority::GameLogic);
+#endif
+
     return true;
 }
 
@@ -155,6 +174,16 @@ void FrameWork::Shutdown()
 
     delete gWindow;
     gWindow = nullptr;
+
+    delete gPerformanceCountersWindow;
+    gPerformanceCountersWindow = nullptr;
+
+#if GENESIS_MEMORY_TRACKING
+    delete gMemoryTrackerWindow;
+    gMemoryTrackerWindow = nullptr;
+
+    MemoryTracker::Dump();
+#endif
 }
 
 bool FrameWork::CreateWindowGL(const std::string& name, uint32_t width, uint32_t height, uint32_t multiSampleSamples /* = 0 */)
@@ -26,6 +26,7 @@
 #include "../vertexbuffer.h"
 #include "sound/soundmanager.h"
 
+#include <algorithm>
 #include <log.hpp>
 
 namespace Genesis
@@ -61,6 +62,143 @@ void PlaySFX(Genesis::ResourceSound* pSFX)
     }
 }
 
+///////////////////////////////////////////////////////////////////////////
+// GuiBatch
+///////////////////////////////////////////////////////////////////////////
+
+GuiBatch::GuiBatch()
+    : m_VertexCount(0)
+    , m_pShader(nullptr)
+    , m_BlendMode(BlendMode::Disabled)
+    , m_BlendModeValid(false)
+    , m_Scissor(0, 0, 0, 0)
+    , m_ScissorValid(false)
+    , m_DrawCalls(0)
+    , m_Quads(0)
+    , m_LastFrameDrawCalls(0)
+    , m_LastFrameQuads(0)
+{
+}
+
+void GuiBatch::Initialize()
+{
+    m_pVertexBuffer = std::make_unique<VertexBuffer>(GeometryType::Triangle, VBO_POSITION | VBO_COLOUR);
+    m_pShader = FrameWork::GetResourceManager()->GetResource<ResourceShader*>("data/shaders/untextured_vertex_coloured.glsl");
+}
+
+void GuiBatch::Begin()
+{
+    // Other systems (such as ImGui) change the GL state between frames, so nothing can be assumed.
+    m_BlendModeValid = false;
+    m_ScissorValid = false;
+    m_DrawCalls = 0;
+    m_Quads = 0;
+}
+
+void GuiBatch::End()
+{
+    Flush();
+    m_LastFrameDrawCalls = m_DrawCalls;
+    m_LastFrameQuads = m_Quads;
+}
+
+void GuiBatch::AddQuad(const glm::vec2& min, const glm::vec2& max, const glm::vec4& colour, const glm::vec2& clipMin, const glm::vec2& clipMax)
+{
+    const glm::vec2 clippedMin = glm::max(min, clipMin);
+    const glm::vec2 clippedMax = glm::min(max, clipMax);
+    if (clippedMin.x >= clippedMax.x || clippedMin.y >= clippedMax.y)
+    {
+        return;
+    }
+
+    // The vectors are never shrunk, so after the first few frames this doesn't allocate.
+    if (m_Positions.size() < m_VertexCount + 6)
+    {
+        m_Positions.resize(m_VertexCount + 6);
+        m_Colours.resize(m_VertexCount + 6);
+    }
+
+    glm::vec3* pPositions = &m_Positions[m_VertexCount];
+    pPositions[0] = glm::vec3(clippedMin.x, clippedMin.y, 0.0f);
+    pPositions[1] = glm::vec3(clippedMin.x, clippedMax.y, 0.0f);
+    pPositions[2] = glm::vec3(clippedMax.x, clippedMax.y, 0.0f);
+    pPositions[3] = glm::vec3(clippedMin.x, clippedMin.y, 0.0f);
+    pPositions[4] = glm::vec3(clippedMax.x, clippedMax.y, 0.0f);
+    pPositions[5] = glm::vec3(clippedMax.x, clippedMin.y, 0.0f);
+    std::fill_n(m_Colours.begin() + m_VertexCount, 6, colour);
+
+    m_VertexCount += 6;
+    m_Quads++;
+}
+
+// One pixel wide outline just inside the given rectangle.
+void GuiBatch::AddOutline(const glm::vec2& min, const glm::vec2& max, const glm::vec4& colour, const glm::vec2& clipMin, const glm::vec2& clipMax)
+{
+    AddQuad(min, glm::vec2(max.x, min.y + 1.0f), colour, clipMin, clipMax);
+    AddQuad(glm::vec2(min.x, max.y - 1.0f), max, colour, clipMin, clipMax);
+    AddQuad(glm::vec2(min.x, min.y + 1.0f), glm::vec2(min.x + 1.0f, max.y - 1.0f), colour, clipMin, clipMax);
+    AddQuad(glm::vec2(max.x - 1.0f, min.y + 1.0f), glm::vec2(max.x, max.y - 1.0f), colour, clipMin, clipMax);
+}
+
+void GuiBatch::Flush()
+{
+    if (m_VertexCount == 0)
+    {
+        return;
+    }
+
+    // The quads have already been clipped, so the scissor only needs to cover the whole screen.
+    SetScissor(0, 0, static_cast<int>(Configuration::GetScreenWidth()), static_cast<int>(Configuration::GetScreenHeight()));
+
+    m_pVertexBuffer->CopyPositions(m_Positions, m_VertexCount);
+    m_pVertexBuffer->CopyColours(m_Colours, m_VertexCount);
+    m_pShader->Use();
+    m_pVertexBuffer->Draw(m_VertexCount);
+
+    m_VertexCount = 0;
+    m_DrawCalls++;
+}
+
+void GuiBatch::SetBlendMode(BlendMode blendMode)
+{
+    if (m_BlendModeValid == false || m_BlendMode != blendMode)
+    {
+        Flush();
+        FrameWork::GetRenderSystem()->SetBlendMode(blendMode);
+        m_BlendMode = blendMode;
+        m_BlendModeValid = true;
+    }
+}
+
+void GuiBatch::SetScissor(const glm::vec2& clipMin, const glm::vec2& clipMax)
+{
+    // glScissor origin is on the bottom left corner of the screen...
+    const int width = std::max(0, static_cast<int>(clipMax.x - clipMin.x));
+    const int height = std::max(0, static_cast<int>(clipMax.y - clipMin.y));
+    SetScissor(static_cast<int>(clipMin.x), static_cast<int>(Configuration::GetScreenHeight()) - static_cast<int>(clipMax.y), width, height);
+}
+
+void GuiBatch::SetScissor(int x, int y, int width, int height)
+{
+    const glm::ivec4 scissor(x, y, width, height);
+    if (m_ScissorValid == false || m_Scissor != scissor)
+    {
+        glScissor(x, y, width, height);
+        m_Scissor = scissor;
+        m_ScissorValid = true;
+    }
+}
+
+size_t GuiBatch::GetDrawCallCount() const
+{
+    return m_LastFrameDrawCalls;
+}
+
+size_t GuiBatch::GetQuadCount() const
+{
+    return m_LastFrameQuads;
+}
+
 ///////////////////////////////////////////////////////////////////////////
 // GuiManager
 ///////////////////////////////////////////////////////////////////////////
@@ -70,6 +208,7 @@ ShaderUniformSharedPtr GuiManager::m_pUntexturedColourUniform = nullptr;
 ResourceShader* GuiManager::m_pTexturedShader = nullptr;
 ShaderUniformSharedPtr GuiManager::m_pTexturedSamplerUniform = nullptr;
 ShaderUniformSharedPtr GuiManager::m_pTexturedColourUniform = nullptr;
+std::unique_ptr<GuiBatch> GuiManager::m_pBatch;
 
 GuiManager::GuiManager()
     : m_pCursor(nullptr)
@@ -85,6 +224,7 @@ GuiManager::~GuiManager()
     }
 
     delete m_pCursor;
+    m_pBatch.reset();
 }
 
 void GuiManager::Initialize()
@@ -95,6 +235,9 @@ void GuiManager::Initialize()
     m_pTexturedColourUniform = m_pTexturedShader->RegisterUniform("k_colour", ShaderUniformType::FloatVector4);
     m_pTexturedSamplerUniform = m_pTexturedShader->RegisterUniform("k_sampler0", ShaderUniformType::Texture);
 
+    m_pBatch = std::make_unique<GuiBatch>();
+    m_pBatch->Initialize();
+
     m_pCursor = new Cursor();
 }
 
@@ -154,25 +297,31 @@ TaskStatus GuiManager::Render(float delta)
     glEnable(GL_SCISSOR_TEST);
 
     renderSystem->ViewOrtho();
+    m_pBatch->Begin();
 
     for (auto& pChildElement : mChildren)
     {
         if (pChildElement->IsVisible() == false)
             continue;
 
-        renderSystem->SetBlendMode(pChildElement->GetBlendMode());
+        m_pBatch->SetBlendMode(pChildElement->GetBlendMode());
         pChildElement->UpdateClipRectangle();
+        if (pChildElement->IsBatchable() == false)
+        {
+            pChildElement->PrepareDirectDraw();
+        }
         pChildElement->Render();
     }
 
     // The cursor should be rendered after everything else
     if (m_pCursor->IsVisible() && ImGuiImpl::IsEnabled() == false)
     {
-        renderSystem->SetBlendMode(BlendMode::Blend);
+        m_pBatch->SetBlendMode(BlendMode::Blend);
         m_pCursor->UpdateClipRectangle();
         m_pCursor->Render();
     }
 
+    m_pBatch->End();
     renderSystem->ViewPerspective();
     renderSystem->SetBlendMode(BlendMode::Disabled);
 
@@ -327,27 +476,37 @@ void GuiElement::Render()
         if ((*it)->IsVisible() == false)
             continue;
 
-        FrameWork::GetRenderSystem()->SetBlendMode((*it)->GetBlendMode());
+        GuiManager::GetBatch()->SetBlendMode((*it)->GetBlendMode());
         (*it)->UpdateClipRectangle();
+        if ((*it)->IsBatchable() == false)
+        {
+            (*it)->PrepareDirectDraw();
+        }
         (*it)->Render();
     }
 }
 
 void GuiElement::RenderHighlight()
 {
-    glm::vec2 pos = GetPositionAbsolute();
+    const glm::vec2& pos = GetPositionAbsolute();
+    AddOutline(pos, pos + mSize, glm::vec4(1.0f, 0.0f, 0.0f, 0.5f));
+}
+
+void GuiElement::PrepareDirectDraw() const
+{
+    GuiBatch* pBatch = GuiManager::GetBatch();
+    pBatch->Flush();
+    pBatch->SetScissor(mClipRectangle.min, mClipRectangle.max);
+}
 
-    // Allows sharp lines when FSAA is enabled
-    pos.x += 0.5f;
-    pos.y += 0.5f;
+void GuiElement::AddQuad(const glm::vec2& min, const glm::vec2& max, const glm::vec4& colour) const
+{
+    GuiManager::GetBatch()->AddQuad(min, max, colour, mClipRectangle.min, mClipRectangle.max);
+}
 
-    glColor4f(1.0f, 0.0f, 0.0f, 0.5f);
-    glBegin(GL_LINE_LOOP);
-    glVertex2f(pos.x + 1.0f, pos.y);
-    glVertex2f(pos.x + 1.0f, pos.y + mSize.y - 1.0f);
-    glVertex2f(pos.x + mSize.x - 1.0f, pos.y + mSize.y - 1.0f);
-    glVertex2f(pos.x + mSize.x - 1.0f, pos.y);
-    glEnd();
+void GuiElement::AddOutline(const glm::vec2& min, const glm::vec2& max, const glm::vec4& colour) const
+{
+    GuiManager::GetBatch()->AddOutline(min, max, colour, mClipRectangle.min, mClipRectangle.max);
 }
 
 void GuiElement::UpdateClipRectangle()
@@ -375,10 +534,7 @@ void GuiElement::UpdateClipRectangle()
             mClipRectangle.max.y = mParent->mClipRectangle.max.y;
     }
 
-    // glScissor origin is on the bottom left corner of the screen...
-    const int width = std::max(0, static_cast<int>(mClipRectangle.max.x - mClipRectangle.min.x));
-    const int height = std::max(0, static_cast<int>(mClipRectangle.max.y - mClipRectangle.min.y));
-    glScissor(static_cast<int>(mClipRectangle.min.x), static_cast<int>(Configuration::GetScreenHeight()) - static_cast<int>(mClipRectangle.max.y), width, height);
+    // The scissor itself is only set by PrepareDirectDraw(), as batched quads are clipped on the CPU.
 }
 
 void GuiElement::SetPosition(const glm::vec2& position)
@@ -456,29 +612,18 @@ Panel::Panel()
     : mColour(1.0f, 1.0f, 1.0f, 1.0)
     , mBorderColour(1.0f, 1.0f, 1.0f, 1.0f)
     , mBorderMode(PANEL_BORDER_NONE)
-    , m_pBackgroundVertexBuffer(nullptr)
-    , m_pBorderVertexBuffer(nullptr)
 {
-    m_pBackgroundVertexBuffer = new VertexBuffer(GeometryType::Triangle, VBO_POSITION);
-    m_pBorderVertexBuffer = new VertexBuffer(GeometryType::Line, VBO_POSITION);
 }
 
-Panel::~Panel()
-{
-    delete m_pBackgroundVertexBuffer;
-    delete m_pBorderVertexBuffer;
-}
+Panel::~Panel() {}
 
 void Panel::Render()
 {
     if (mColour.a > 0.001f || IsHighlighted())
     {
-        const glm::vec2 pos = GetPositionAbsolute();
-        m_pBackgroundVertexBuffer->CreateUntexturedQuad(pos.x, pos.y, mSize.x, mSize.y);
+        const glm::vec2& pos = GetPositionAbsolute();
         glm::vec4 colour = IsHighlighted() ? glm::vec4(1.0f, 0.0f, 0.0f, 0.5f) : glm::vec4(mColour.r, mColour.g, mColour.b, mColour.a);
-        GuiManager::GetUntexturedShaderColourUniform()->Set(colour);
-        GuiManager::GetUntexturedShader()->Use();
-        m_pBackgroundVertexBuffer->Draw();
+        AddQuad(pos, pos + mSize, colour);
     }
 
     DrawBorder();
@@ -494,39 +639,25 @@ void Panel::DrawBorder()
         return;
     }
 
-    glm::vec2 pos = GetPositionAbsolute();
-
-    // Allows sharp lines when FSAA is enabled
-    pos.x += 0.5f;
-    pos.y += 0.5f;
-
-    PositionData posData;
+    // Each border is a one pixel wide quad, covering the same pixels as the lines previously used.
+    const glm::vec2& pos = GetPositionAbsolute();
+    const glm::vec4 colour = IsHighlighted() ? glm::vec4(1.0f, 0.0f, 0.0f, 1.0f) : glm::vec4(mBorderColour.r, mBorderColour.g, mBorderColour.b, mBorderColour.a);
     if (borderMode & PANEL_BORDER_LEFT)
     {
-        posData.push_back(glm::vec3(pos.x + 1.0f, pos.y, 0.0f));
-        posData.push_back(glm::vec3(pos.x + 1.0f, pos.y + mSize.y - 1.0f, 0.0f));
+        AddQuad(glm::vec2(pos.x + 1.0f, pos.y), glm::vec2(pos.x + 2.0f, pos.y + mSize.y - 1.0f), colour);
     }
     if (borderMode & PANEL_BORDER_RIGHT)
     {
-        posData.push_back(glm::vec3(pos.x + mSize.x - 1.0f, pos.y, 0.0f));
-        posData.push_back(glm::vec3(pos.x + mSize.x - 1.0f, pos.y + mSize.y - 1.0f, 0.0f));
+        AddQuad(glm::vec2(pos.x + mSize.x - 1.0f, pos.y), glm::vec2(pos.x + mSize.x, pos.y + mSize.y - 1.0f), colour);
     }
     if (borderMode & PANEL_BORDER_TOP)
     {
-        posData.push_back(glm::vec3(pos.x + 1.0f, pos.y, 0.0f));
-        posData.push_back(glm::vec3(pos.x + mSize.x - 1.0f, pos.y, 0.0f));
+        AddQuad(glm::vec2(pos.x + 1.0f, pos.y), glm::vec2(pos.x + mSize.x - 1.0f, pos.y + 1.0f), colour);
     }
     if (borderMode & PANEL_BORDER_BOTTOM)
     {
-        posData.push_back(glm::vec3(pos.x + 1.0f, pos.y + mSize.y - 1.0f, 0.0f));
-        posData.push_back(glm::vec3(pos.x + mSize.x - 1.0f, pos.y + mSize.y - 1.0f, 0.0f));
+        AddQuad(glm::vec2(pos.x + 1.0f, pos.y + mSize.y - 1.0f), glm::vec2(pos.x + mSize.x - 1.0f, pos.y + mSize.y), colour);
     }
-
-    m_pBorderVertexBuffer->CopyPositions(posData);
-    glm::vec4 colour = IsHighlighted() ? glm::vec4(1.0f, 0.0f, 0.0f, 1.0f) : glm::vec4(mBorderColour.r, mBorderColour.g, mBorderColour.b, mBorderColour.a);
-    GuiManager::GetUntexturedShaderColourUniform()->Set(glm::vec4(colour));
-    GuiManager::GetUntexturedShader()->Use();
-    m_pBorderVertexBuffer->Draw();
 }
 
 ///////////////////////////////////////////////////////////////////////////
@@ -575,6 +706,7 @@ void Cursor::SetTexture(ResourceImage* pImage)
 Image::Image()
     : m_pImage(nullptr)
     , m_pImageVertexBuffer(nullptr)
+    , m_ImageQuad(0.0f, 0.0f, -1.0f, -1.0f)
     , m_pOverrideShader(nullptr)
     , m_pOverrideShaderColourUniform(nullptr)
     , m_pOverrideShaderSamplerUniform(nullptr)
@@ -589,8 +721,16 @@ Image::~Image()
 
 void Image::Render()
 {
-    const glm::vec2 pos = GetPositionAbsolute();
-    m_pImageVertexBuffer->CreateTexturedQuad(pos.x, pos.y, mSize.x, mSize.y);
+    // The quad is only rebuilt when the image moves or is resized.
+    const glm::vec2& pos = GetPositionAbsolute();
+    const glm::vec4 imageQuad(pos.x, pos.y, mSize.x, mSize.y);
+    if (imageQuad != m_ImageQuad)
+    {
+        m_pImageVertexBuffer->CreateTexturedQuad(pos.x, pos.y, mSize.x, mSize.y);
+        m_ImageQuad = imageQuad;
+    }
+
+    PrepareDirectDraw();
 
     if (m_pOverrideShader != nullptr)
     {
@@ -679,6 +819,10 @@ void ButtonImage::OnMouseReleasedCallback()
 
 Text::Text()
     : m_MultiLine(true)
+    , m_GeometryDirty(true)
+    , m_GeometryPosition(0.0f, 0.0f)
+    , m_VertexCount(0)
+    , m_pGlyphRun(nullptr)
     , m_pFont(nullptr)
     , m_Text("")
     , m_ProcessedText("")
@@ -706,12 +850,27 @@ void Text::Render()
         return;
     }
 
+    // The glyphs are only laid out again when the text changes or moves, rather than every frame.
     const glm::vec2& pos = GetPositionAbsolute();
-    const unsigned int vertexCount = m_pFont->PopulateVertexBuffer(*m_pVertexBuffer, floorf(pos.x), floorf(pos.y), m_ProcessedText, m_LineSpacing);
+    const glm::vec2 geometryPosition(floorf(pos.x), floorf(pos.y));
+    // The glyph run itself is shared through the font's cache, so moving the text only needs a translation.
+    if (m_GeometryDirty || geometryPosition != m_GeometryPosition)
+    {
+        if (m_GeometryDirty || m_pGlyphRun == nullptr)
+        {
+            m_pGlyphRun = m_pFont->GetGlyphRun(m_ProcessedText, m_LineSpacing);
+        }
+
+        m_VertexCount = m_pFont->PopulateVertexBuffer(*m_pVertexBuffer, geometryPosition.x, geometryPosition.y, *m_pGlyphRun);
+        m_GeometryPosition = geometryPosition;
+        m_GeometryDirty = false;
+    }
+
+    PrepareDirectDraw();
     GuiManager::GetTexturedShaderColourUniform()->Set(glm::vec4(m_Colour.r, m_Colour.g, m_Colour.b, m_Colour.a));
     GuiManager::GetTexturedSamplerUniform()->Set(m_pFont->GetPage(), GL_TEXTURE0);
     GuiManager::GetTexturedShader()->Use();
-    m_pVertexBuffer->Draw(vertexCount);
+    m_pVertexBuffer->Draw(m_VertexCount);
 
     GuiElement::Render();
 }
@@ -720,6 +879,8 @@ void Text::Render()
 // The result is cached to avoid unnecessary processing.
 void Text::ProcessText()
 {
+    m_GeometryDirty = true;
+
     if (m_pFont == nullptr)
     {
         return;
@@ -806,6 +967,8 @@ Button::Button()
     , mIsEnabled(true)
     , m_pIcon(nullptr)
     , m_pIconVertexBuffer(nullptr)
+    , m_IconQuad(0.0f, 0.0f, -1.0f, -1.0f)
+    , m_IconQuadColour(0.0f)
 {
     m_MousePressedToken = FrameWork::GetInputManager()->AddMouseCallback(std::bind(&Button::OnMousePressedCallback, this), MouseButton::Left, ButtonState::Pressed);
     m_MouseReleasedToken = FrameWork::GetInputManager()->AddMouseCallback(std::bind(&Button::OnMouseReleasedCallback, this), MouseButton::Left, ButtonState::Released);
@@ -848,18 +1011,21 @@ void Button::Render()
         colour = glm::vec4(mHoverColour.r, mHoverColour.g, mHoverColour.b, mHoverColour.a);
     }
 
-    const glm::vec2 pos = GetPositionAbsolute();
-    m_pBackgroundVertexBuffer->CreateUntexturedQuad(pos.x, pos.y, mSize.x, mSize.y);
-    GuiManager::GetUntexturedShaderColourUniform()->Set(colour);
-    GuiManager::GetUntexturedShader()->Use();
-    m_pBackgroundVertexBuffer->Draw();
+    const glm::vec2& pos = GetPositionAbsolute();
+    AddQuad(pos, pos + mSize, colour);
 
     if (m_pIcon != nullptr)
     {
-        const glm::vec2 iconSize((float)m_pIcon->GetWidth(), (float)m_pIcon->GetHeight());
-        const glm::vec2 iconPos(pos.x + 2.0f, pos.y);
+        const glm::vec4 iconQuad(pos.x + 2.0f, pos.y, (float)m_pIcon->GetWidth(), (float)m_pIcon->GetHeight());
         const glm::vec4 iconColour = buttonHovered ? mIconHoverColour.glm() : mIconColour.glm();
-        m_pIconVertexBuffer->CreateTexturedQuad(iconPos.x, iconPos.y, iconSize.x, iconSize.y, iconColour);
+        if (iconQuad != m_IconQuad || iconColour != m_IconQuadColour)
+        {
+            m_pIconVertexBuffer->CreateTexturedQuad(iconQuad.x, iconQuad.y, iconQuad.z, iconQuad.w, iconColour);
+            m_IconQuad = iconQuad;
+            m_IconQuadColour = iconColour;
+        }
+
+        PrepareDirectDraw();
         GuiManager::GetTexturedSamplerUniform()->Set(m_pIcon, GL_TEXTURE0);
         GuiManager::GetTexturedShaderColourUniform()->Set(iconColour);
         GuiManager::GetTexturedShader()->Use();
@@ -921,8 +1087,6 @@ static const float CheckboxSquareSize = 16.0f;
 Checkbox::Checkbox(int x, int y, ResourceFont* font, const std::string& text, bool checked /* = false */, CheckboxCallback pCallback /* = nullptr */)
     : m_Checked(checked)
     , m_BulletColour(1.0f, 1.0f, 1.0f, 1.0f)
-    , m_pCheckboxBulletVertexBuffer(nullptr)
-    , m_pCheckboxBorderVertexBuffer(nullptr)
     , m_pCheckboxCallback(pCallback)
 {
     SetPosition(glm::vec2(x, y));
@@ -930,51 +1094,25 @@ Checkbox::Checkbox(int x, int y, ResourceFont* font, const std::string& text, bo
     SetFont(font);
     SetText(text);
     mText->SetPosition(CheckboxSquareSize + 8.0f, 0.0f);
-
-    m_pCheckboxBulletVertexBuffer = new VertexBuffer(GeometryType::Triangle, VBO_POSITION);
-    m_pCheckboxBorderVertexBuffer = new VertexBuffer(GeometryType::LineStrip, VBO_POSITION);
 }
 
-Checkbox::~Checkbox()
-{
-    delete m_pCheckboxBulletVertexBuffer;
-    delete m_pCheckboxBorderVertexBuffer;
-}
+Checkbox::~Checkbox() {}
 
 void Checkbox::Render()
 {
     const glm::vec2& pos = GetPositionAbsolute();
-
-    m_pBackgroundVertexBuffer->CreateUntexturedQuad(pos.x, pos.y, CheckboxSquareSize, CheckboxSquareSize);
-    GuiManager::GetUntexturedShaderColourUniform()->Set(glm::vec4(mColour.r, mColour.g, mColour.b, mColour.a));
-    GuiManager::GetUntexturedShader()->Use();
-    m_pBackgroundVertexBuffer->Draw();
+    const glm::vec2 squareSize(CheckboxSquareSize, CheckboxSquareSize);
+    AddQuad(pos, pos + squareSize, glm::vec4(mColour.r, mColour.g, mColour.b, mColour.a));
 
     // Bullet
     if (m_Checked)
     {
         const float offset = 3.0f;
-        m_pCheckboxBulletVertexBuffer->CreateUntexturedQuad(pos.x + offset, pos.y + offset, CheckboxSquareSize - offset * 2.0f, CheckboxSquareSize - offset * 2.0f - 1.0f);
-        GuiManager::GetUntexturedShaderColourUniform()->Set(glm::vec4(m_BulletColour.r, m_BulletColour.g, m_BulletColour.b, m_BulletColour.a));
-        GuiManager::GetUntexturedShader()->Use();
-        m_pCheckboxBulletVertexBuffer->Draw();
+        AddQuad(pos + offset, pos + squareSize - glm::vec2(offset, offset + 1.0f), glm::vec4(m_BulletColour.r, m_BulletColour.g, m_BulletColour.b, m_BulletColour.a));
     }
 
     // Border around the square
-    const float offset = 1.5f;
-
-    PositionData posData;
-    posData.push_back(glm::vec3(pos.x + offset, pos.y + offset, 0.0f));
-    posData.push_back(glm::vec3(pos.x + CheckboxSquareSize - offset, pos.y + offset, 0.0f));
-    posData.push_back(glm::vec3(pos.x + CheckboxSquareSize - offset, pos.y + CheckboxSquareSize - offset - 1.0f, 0.0f));
-    posData.push_back(glm::vec3(pos.x + offset, pos.y + CheckboxSquareSize - offset - 1.0f, 0.0f));
-    posData.push_back(glm::vec3(pos.x + offset, pos.y + offset, 0.0f));
-    m_pCheckboxBorderVertexBuffer->CopyPositions(posData);
-
-    // m_pCheckboxBorderVertexBuffer->CreateUntexturedQuad( pos.x + offset, pos.y + offset, CheckboxSquareSize - offset * 2.0f, 8.0f );
-    GuiManager::GetUntexturedShaderColourUniform()->Set(glm::vec4(mBorderColour.r, mBorderColour.g, mBorderColour.b, mBorderColour.a));
-    GuiManager::GetUntexturedShader()->Use();
-    m_pCheckboxBorderVertexBuffer->Draw();
+    AddOutline(pos + 1.0f, pos + squareSize - glm::vec2(1.0f, 2.0f), glm::vec4(mBorderColour.r, mBorderColour.g, mBorderColour.b, mBorderColour.a));
 
     GuiElement::Render();
 }
@@ -1011,9 +1149,6 @@ RadioButton::RadioButton(int x, int y, ResourceFont* font, const std::string& te
     SetText(text);
     mText->SetPosition(RadioButtonSquareSize + 8.0f, 0.0f);
 
-    m_pRadioButtonBulletVertexBuffer = std::make_unique<VertexBuffer>(GeometryType::Triangle, VBO_POSITION);
-    m_pRadioButtonBorderVertexBuffer = std::make_unique<VertexBuffer>(GeometryType::Line, VBO_POSITION);
-
     AddToGroup();
 }
 
@@ -1025,38 +1160,16 @@ RadioButton::~RadioButton()
 void RadioButton::Render()
 {
     const glm::vec2& pos = GetPositionAbsolute();
-
-    m_pBackgroundVertexBuffer->CreateUntexturedQuad(pos.x, pos.y, RadioButtonSquareSize, RadioButtonSquareSize);
-    GuiManager::GetUntexturedShaderColourUniform()->Set(glm::vec4(mColour.r, mColour.g, mColour.b, mColour.a));
-    GuiManager::GetUntexturedShader()->Use();
-    m_pBackgroundVertexBuffer->Draw();
+    const glm::vec2 squareSize(RadioButtonSquareSize, RadioButtonSquareSize);
+    AddQuad(pos, pos + squareSize, glm::vec4(mColour.r, mColour.g, mColour.b, mColour.a));
 
     // Bullet
-    float offset = m_Checked ? 4.0f : 6.0f;
-    m_pRadioButtonBulletVertexBuffer->CreateUntexturedQuad(pos.x + offset, pos.y + offset, RadioButtonSquareSize - offset * 2.0f, RadioButtonSquareSize - offset * 2.0f - 1.0f);
-    glm::vec4 colour = m_Checked ? glm::vec4(m_BulletColour.r, m_BulletColour.g, m_BulletColour.b, m_BulletColour.a) : glm::vec4(0.5f, 0.5f, 0.5f, 0.5f);
-    GuiManager::GetUntexturedShaderColourUniform()->Set(colour);
-    GuiManager::GetUntexturedShader()->Use();
-    m_pRadioButtonBulletVertexBuffer->Draw();
+    const float offset = m_Checked ? 4.0f : 6.0f;
+    const glm::vec4 colour = m_Checked ? glm::vec4(m_BulletColour.r, m_BulletColour.g, m_BulletColour.b, m_BulletColour.a) : glm::vec4(0.5f, 0.5f, 0.5f, 0.5f);
+    AddQuad(pos + offset, pos + squareSize - glm::vec2(offset, offset + 1.0f), colour);
 
     // Border around the square
-    offset = 1.5f;
-
-    PositionData posData(8);
-    posData.emplace_back(pos.x + offset, pos.y + offset, 0.0f);
-    posData.emplace_back(pos.x + RadioButtonSquareSize - offset, pos.y + offset, 0.0f);
-    posData.emplace_back(pos.x + RadioButtonSquareSize - offset, pos.y + offset, 0.0f);
-    posData.emplace_back(pos.x + RadioButtonSquareSize - offset, pos.y + RadioButtonSquareSize - offset - 1.0f, 0.0f);
-    posData.emplace_back(pos.x + RadioButtonSquareSize - offset, pos.y + RadioButtonSquareSize - offset - 1.0f, 0.0f);
-    posData.emplace_back(pos.x + offset, pos.y + RadioButtonSquareSize - offset - 1.0f, 0.0f);
-    posData.emplace_back(pos.x + offset, pos.y + RadioButtonSquareSize - offset - 1.0f, 0.0f);
-    posData.emplace_back(pos.x + offset, pos.y + offset, 0.0f);
-
-    m_pRadioButtonBorderVertexBuffer->CopyPositions(posData);
-
-    GuiManager::GetUntexturedShaderColourUniform()->Set(glm::vec4(mBorderColour.r, mBorderColour.g, mBorderColour.b, mBorderColour.a));
-    GuiManager::GetUntexturedShader()->Use();
-    m_pRadioButtonBorderVertexBuffer->Draw();
+    AddOutline(pos + 1.0f, pos + squareSize - glm::vec2(1.0f, 2.0f), glm::vec4(mBorderColour.r, mBorderColour.g, mBorderColour.b, mBorderColour.a));
 
     GuiElement::Render();
 }
@@ -27,6 +27,7 @@
 
 #include <functional>
 #include <list>
+#include <memory>
 
 namespace Genesis
 {
@@ -50,6 +51,55 @@ typedef std::list<GuiElement*> GuiElementList;
 Genesis::ResourceSound* LoadSFX(const std::string& filename);
 void PlaySFX(ResourceSound* pSFX);
 
+///////////////////////////////////////////////////////////////////////////
+// GuiBatch
+// Collects the untextured quads of every widget (backgrounds, borders,
+// bullets...) into a single vertex stream, so that runs of them are drawn
+// with one draw call. Quads are clipped on the CPU against their element's
+// clip rectangle, so they don't depend on the scissor state and clip
+// rectangle changes don't break the batch. The batch is flushed before
+// anything which can't be batched is drawn: textured widgets, blend mode
+// changes and elements which draw directly.
+///////////////////////////////////////////////////////////////////////////
+
+class GuiBatch
+{
+public:
+    GuiBatch();
+
+    void Initialize();
+    void Begin();
+    void End();
+
+    void AddQuad(const glm::vec2& min, const glm::vec2& max, const glm::vec4& colour, const glm::vec2& clipMin, const glm::vec2& clipMax);
+    void AddOutline(const glm::vec2& min, const glm::vec2& max, const glm::vec4& colour, const glm::vec2& clipMin, const glm::vec2& clipMax);
+    void Flush();
+
+    // These only change the GL state if needed, flushing the batch first.
+    void SetBlendMode(BlendMode blendMode);
+    void SetScissor(const glm::vec2& clipMin, const glm::vec2& clipMax);
+
+    size_t GetDrawCallCount() const; // Draw calls issued by the batch in the last frame.
+    size_t GetQuadCount() const;     // Quads drawn by the batch in the last frame.
+
+private:
+    void SetScissor(int x, int y, int width, int height);
+
+    PositionData m_Positions;
+    ColourData m_Colours;
+    size_t m_VertexCount;
+    VertexBufferUniquePtr m_pVertexBuffer;
+    ResourceShader* m_pShader;
+    BlendMode m_BlendMode;
+    bool m_BlendModeValid;
+    glm::ivec4 m_Scissor;
+    bool m_ScissorValid;
+    size_t m_DrawCalls;
+    size_t m_Quads;
+    size_t m_LastFrameDrawCalls;
+    size_t m_LastFrameQuads;
+};
+
 ///////////////////////////////////////////////////////////////////////////
 // GuiManager
 ///////////////////////////////////////////////////////////////////////////
@@ -76,6 +126,7 @@ public:
     static ResourceShader* GetTexturedShader();
     static ShaderUniformSharedPtr GetTexturedShaderColourUniform();
     static ShaderUniformSharedPtr GetTexturedSamplerUniform();
+    static GuiBatch* GetBatch();
 
     Cursor* GetCursor() const;
 
@@ -95,6 +146,7 @@ private:
     static ResourceShader* m_pTexturedShader;
     static ShaderUniformSharedPtr m_pTexturedSamplerUniform;
     static ShaderUniformSharedPtr m_pTexturedColourUniform;
+    static std::unique_ptr<GuiBatch> m_pBatch;
 };
 
 ///////////////////////////////////////////////////////////////////////////
@@ -136,6 +188,14 @@ public:
 
     void UpdateClipRectangle();
 
+    // Elements which override Render() to draw directly, rather than through the GuiBatch or
+    // PrepareDirectDraw(), must return false so the batch is flushed before they are rendered.
+    virtual bool IsBatchable() const { return true; }
+
+    // Flushes the GuiBatch and sets up the scissor for this element's clip rectangle.
+    // Must be called before anything is drawn without going through the batch.
+    void PrepareDirectDraw() const;
+
     void SetBlendMode(BlendMode blendMode);
     BlendMode GetBlendMode() const;
 
@@ -175,6 +235,9 @@ protected:
         glm::vec2 max;
     } mClipRectangle;
 
+    void AddQuad(const glm::vec2& min, const glm::vec2& max, const glm::vec4& colour) const;
+    void AddOutline(const glm::vec2& min, const glm::vec2& max, const glm::vec4& colour) const;
+
 private:
     void RenderHighlight();
 
@@ -222,9 +285,6 @@ protected:
     Colour mColour;
     Colour mBorderColour;
     char mBorderMode;
-
-    VertexBuffer* m_pBackgroundVertexBuffer;
-    VertexBuffer* m_pBorderVertexBuffer;
 };
 
 ///////////////////////////////////////////////////////////////////////////
@@ -244,6 +304,7 @@ public:
 
 private:
     VertexBuffer* m_pImageVertexBuffer;
+    glm::vec4 m_ImageQuad; // Position and size the vertex buffer was built for.
     ResourceImage* m_pImage;
     ResourceShader* m_pOverrideShader;
     ShaderUniformSharedPtr m_pOverrideShaderColourUniform;
@@ -311,6 +372,10 @@ private:
     void ProcessText();
 
     bool m_MultiLine;
+    bool m_GeometryDirty; // Set whenever the vertex buffer needs to be rebuilt.
+    glm::vec2 m_GeometryPosition;
+    unsigned int m_VertexCount;
+    GlyphRunSharedPtr m_pGlyphRun;
     ResourceFont* m_pFont;
     std::string m_Text;
     std::string m_ProcessedText;
@@ -365,6 +430,8 @@ private:
     InputCallbackToken m_MouseReleasedToken;
 
     VertexBuffer* m_pIconVertexBuffer;
+    glm::vec4 m_IconQuad;
+    glm::vec4 m_IconQuadColour;
 };
 
 ///////////////////////////////////////////////////////////////////////////
@@ -391,8 +458,6 @@ public:
 private:
     Colour m_BulletColour;
     bool m_Checked;
-    VertexBuffer* m_pCheckboxBulletVertexBuffer;
-    VertexBuffer* m_pCheckboxBorderVertexBuffer;
     CheckboxCallback m_pCheckboxCallback;
 };
 
@@ -427,8 +492,6 @@ private:
 
     Colour m_BulletColour;
     bool m_Checked;
-    VertexBufferUniquePtr m_pRadioButtonBulletVertexBuffer;
-    VertexBufferUniquePtr m_pRadioButtonBorderVertexBuffer;
     RadioButtonCallback m_pCallback;
     std::string m_Group;
 };
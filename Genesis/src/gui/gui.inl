@@ -51,6 +51,11 @@ inline ShaderUniformSharedPtr GuiManager::GetUntexturedShaderColourUniform()
 	return m_pUntexturedColourUniform;
 }
 
+inline GuiBatch* GuiManager::GetBatch()
+{
+	return m_pBatch.get();
+}
+
 inline ResourceShader* GuiManager::GetTexturedShader()
 {
 	return m_pTexturedShader;
@@ -290,7 +295,11 @@ inline void Text::SetColour( float r, float g, float b, float a )
 
 inline void Text::SetLineSpacing( float value )
 {
-	m_LineSpacing = value;
+	if ( m_LineSpacing != value )
+	{
+		m_LineSpacing = value;
+		m_GeometryDirty = true;
+	}
 }
 
 inline float Text::GetLineSpacing() const
@@ -28,6 +28,7 @@ bool ImGuiImpl::m_Initialised = false;
 bool ImGuiImpl::m_Enabled = false;
 bool ImGuiImpl::m_DevMenuEnabled = false;
 ImGuiImpl::MenuRegistry ImGuiImpl::m_MenuRegistry;
+std::mutex ImGuiImpl::m_MenuRegistryMutex;
 
 char* g_ClipboardTextData = nullptr;
 
@@ -180,6 +181,7 @@ void ImGuiImpl::NewFrame( float delta )
     // Setup the menus we've registered
     if ( IsInitialised() && IsEnabled() && IsDevMenuEnabled() && ImGui::BeginMainMenuBar() )
     {
+        std::lock_guard<std::mutex> lock( m_MenuRegistryMutex );
         for ( auto& pair : m_MenuRegistry )
         {
             if ( ImGui::BeginMenu( pair.first.data() ) )
@@ -369,11 +371,13 @@ void ImGuiImpl::RegisterDevMenu( const std::string& menuRoot, const std::string&
     Menu menu;
     menu.name = menuName;
     menu.pShow = pShow;
+    std::lock_guard<std::mutex> lock( m_MenuRegistryMutex );
     m_MenuRegistry[ menuRoot ].push_back( menu );
 }
 
 void ImGuiImpl::UnregisterDevMenu( const std::string& menuRoot, const std::string& menuName )
 {
+    std::lock_guard<std::mutex> lock( m_MenuRegistryMutex );
     MenuRegistry::iterator it = m_MenuRegistry.find( menuRoot );
     if ( it != m_MenuRegistry.end() )
     {
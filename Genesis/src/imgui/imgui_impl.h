@@ -4,6 +4,7 @@
 #include <SDL.h>
 #include <list>
 #include <map>
+#include <mutex>
 #include <string>
 
 #include "resources/resourceshader.hpp"
@@ -53,6 +54,7 @@ private:
     typedef std::list<Menu> MenuList;
     typedef std::map<std::string, MenuList> MenuRegistry;
     static MenuRegistry m_MenuRegistry;
+    static std::mutex m_MenuRegistryMutex; // Menus can be registered by objects created during the parallel startup.
 };
 
 } // namespace Genesis
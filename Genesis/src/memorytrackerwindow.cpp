@@ -0,0 +1,132 @@
+// Copyright 2026 Pedro Nunes
+//
+// This file is part of Genesis.
+//
+// Genesis is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Genesis is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Genesis. If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "memorytrackerwindow.h"
+
+#if GENESIS_MEMORY_TRACKING
+
+#include "imgui/imgui.h"
+#include "imgui/imgui_impl.h"
+#include "implot/implot.h"
+
+namespace Genesis
+{
+
+MemoryTrackerWindow::MemoryTrackerWindow()
+    : m_Open(false)
+{
+    ImGuiImpl::RegisterDevMenu("Engine", "Memory", &m_Open);
+}
+
+MemoryTrackerWindow::~MemoryTrackerWindow()
+{
+    ImGuiImpl::UnregisterDevMenu("Engine", "Memory");
+}
+
+TaskStatus MemoryTrackerWindow::Update(float delta)
+{
+    if (m_Open == false)
+    {
+        return TaskStatus::Continue;
+    }
+
+    ImGui::SetNextWindowSize(ImVec2(700, 600), ImGuiCond_Appearing);
+    ImGui::Begin("Memory", &m_Open);
+
+    const int tagCount = static_cast<int>(MemoryTag::Count);
+    if (ImGui::CollapsingHeader("Tags", ImGuiTreeNodeFlags_DefaultOpen))
+    {
+        ImGui::Columns(6);
+        ImGui::Text("Tag");
+        ImGui::NextColumn();
+        ImGui::Text("Live (KB)");
+        ImGui::NextColumn();
+        ImGui::Text("Peak (KB)");
+        ImGui::NextColumn();
+        ImGui::Text("Live allocations");
+        ImGui::NextColumn();
+        ImGui::Text("Allocations / frame");
+        ImGui::NextColumn();
+        ImGui::Text("Total allocations");
+        ImGui::NextColumn();
+        ImGui::Separator();
+
+        for (int i = 0; i < tagCount; ++i)
+        {
+            const MemoryTag tag = static_cast<MemoryTag>(i);
+            const MemoryTagStats stats = MemoryTracker::GetStats(tag);
+            ImGui::Text("%s", MemoryTracker::GetTagName(tag));
+            ImGui::NextColumn();
+            ImGui::Text("%lld", static_cast<long long>(stats.liveBytes / 1024));
+            ImGui::NextColumn();
+            ImGui::Text("%lld", static_cast<long long>(stats.peakBytes / 1024));
+            ImGui::NextColumn();
+            ImGui::Text("%lld", static_cast<long long>(stats.liveAllocations));
+            ImGui::NextColumn();
+            ImGui::Text("%llu", static_cast<unsigned long long>(stats.allocationsLastFrame));
+            ImGui::NextColumn();
+            ImGui::Text("%llu", static_cast<unsigned long long>(stats.totalAllocations));
+            ImGui::NextColumn();
+        }
+        ImGui::Columns(1);
+    }
+
+    const int historySize = static_cast<int>(MemoryTracker::sHistorySize);
+    const int historyOffset = MemoryTracker::GetHistoryOffset();
+    if (ImGui::CollapsingHeader("Live memory", ImGuiTreeNodeFlags_DefaultOpen))
+    {
+        if (ImPlot::BeginPlot("##LiveMemory", ImVec2(-1, 200), ImPlotFlags_NoMenus))
+        {
+            ImPlot::SetupAxes("Frames", "Bytes", ImPlotAxisFlags_NoTickLabels, ImPlotAxisFlags_AutoFit);
+            ImPlot::SetupAxisLimits(ImAxis_X1, 0.0, historySize, ImGuiCond_Always);
+            for (int i = 0; i < tagCount; ++i)
+            {
+                const MemoryTag tag = static_cast<MemoryTag>(i);
+                ImPlot::PlotLine(MemoryTracker::GetTagName(tag), MemoryTracker::GetLiveBytesHistory(tag), historySize, 1.0, 0.0, historyOffset);
+            }
+            ImPlot::EndPlot();
+        }
+    }
+
+    if (ImGui::CollapsingHeader("Allocations per frame", ImGuiTreeNodeFlags_DefaultOpen))
+    {
+        if (ImPlot::BeginPlot("##Allocations", ImVec2(-1, 200), ImPlotFlags_NoMenus))
+        {
+            ImPlot::SetupAxes("Frames", "Allocations", ImPlotAxisFlags_NoTickLabels, ImPlotAxisFlags_AutoFit);
+            ImPlot::SetupAxisLimits(ImAxis_X1, 0.0, historySize, ImGuiCond_Always);
+            for (int i = 0; i < tagCount; ++i)
+            {
+                const MemoryTag tag = static_cast<MemoryTag>(i);
+                ImPlot::PlotLine(MemoryTracker::GetTagName(tag), MemoryTracker::GetAllocationsHistory(tag), historySize, 1.0, 0.0, historyOffset);
+            }
+            ImPlot::EndPlot();
+        }
+    }
+
+    if (ImGui::Button("Dump to log"))
+    {
+        MemoryTracker::Dump();
+    }
+
+    ImGui::End();
+    return TaskStatus::Continue;
+}
+
+} // namespace Genesis
+
+#endif // GENESIS_MEMORY_TRACKING
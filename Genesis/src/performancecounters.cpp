@@ -0,0 +1,186 @@
+// Copyright 2026 Pedro Nunes
+//
+// This file is part of Genesis.
+//
+// Genesis is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Genesis is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Genesis. If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "performancecounters.h"
+
+#include <algorithm>
+#include <fstream>
+#include <log.hpp>
+
+namespace Genesis
+{
+
+//////////////////////////////////////////////////////////////////////////
+// PerformanceCounter
+//////////////////////////////////////////////////////////////////////////
+
+PerformanceCounter::PerformanceCounter(const std::string& name, PerformanceCounterType type, int64_t budget)
+    : m_Name(name)
+    , m_Type(type)
+    , m_Value(0)
+    , m_Budget(budget)
+    , m_LastFrameValue(0)
+    , m_PeakValue(0)
+    , m_OverBudget(false)
+{
+    std::fill(std::begin(m_History), std::end(m_History), 0.0f);
+}
+
+void PerformanceCounter::EndFrame(int historyOffset)
+{
+    if (m_Type == PerformanceCounterType::Counter)
+    {
+        m_LastFrameValue = m_Value.exchange(0, std::memory_order_relaxed);
+    }
+    else
+    {
+        m_LastFrameValue = m_Value.load(std::memory_order_relaxed);
+    }
+
+    m_PeakValue = std::max(m_PeakValue, m_LastFrameValue);
+    m_History[historyOffset] = static_cast<float>(m_LastFrameValue);
+
+    // Only log when the budget is first exceeded, rather than every frame the counter stays over it.
+    const bool overBudget = (m_Budget > 0 && m_LastFrameValue > m_Budget);
+    if (overBudget && !m_OverBudget)
+    {
+        Log::Warning() << "Performance counter '" << m_Name << "' is over budget: " << m_LastFrameValue << " / " << m_Budget;
+    }
+    m_OverBudget = overBudget;
+}
+
+//////////////////////////////////////////////////////////////////////////
+// PerformanceCounters
+//////////////////////////////////////////////////////////////////////////
+
+std::mutex PerformanceCounters::m_Mutex;
+std::vector<std::unique_ptr<PerformanceCounter>> PerformanceCounters::m_Counters;
+int PerformanceCounters::m_HistoryOffset = 0;
+
+PerformanceCounter* PerformanceCounters::Register(const std::string& name, PerformanceCounterType type, int64_t budget /* = 0 */)
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    for (const auto& pCounter : m_Counters)
+    {
+        if (pCounter->GetName() == name)
+        {
+            return pCounter.get();
+        }
+    }
+
+    m_Counters.push_back(std::make_unique<PerformanceCounter>(name, type, budget));
+    return m_Counters.back().get();
+}
+
+PerformanceCounter* PerformanceCounters::Get(const std::string& name)
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    for (const auto& pCounter : m_Counters)
+    {
+        if (pCounter->GetName() == name)
+        {
+            return pCounter.get();
+        }
+    }
+    return nullptr;
+}
+
+void PerformanceCounters::EndFrame()
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    for (const auto& pCounter : m_Counters)
+    {
+        pCounter->EndFrame(m_HistoryOffset);
+    }
+    m_HistoryOffset = (m_HistoryOffset + 1) % static_cast<int>(PerformanceCounter::sHistorySize);
+}
+
+int PerformanceCounters::GetHistoryOffset()
+{
+    return m_HistoryOffset;
+}
+
+bool PerformanceCounters::ExportCSV(const std::filesystem::path& path)
+{
+    std::ofstream file(path, std::ios::out | std::ios::trunc);
+    if (file.good() == false)
+    {
+        Log::Error() << "Failed to export performance counters to " << path;
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    file << "Frame";
+    for (const auto& pCounter : m_Counters)
+    {
+        file << ",\"" << pCounter->GetName() << "\"";
+    }
+    file << "\n";
+
+    const int historySize = static_cast<int>(PerformanceCounter::sHistorySize);
+    for (int frame = 0; frame < historySize; ++frame)
+    {
+        const int index = (m_HistoryOffset + frame) % historySize;
+        file << frame;
+        for (const auto& pCounter : m_Counters)
+        {
+            file << "," << static_cast<int64_t>(pCounter->GetHistory()[index]);
+        }
+        file << "\n";
+    }
+
+    Log::Info() << "Performance counters exported to " << path;
+    return true;
+}
+
+bool PerformanceCounters::ExportJSON(const std::filesystem::path& path)
+{
+    std::ofstream file(path, std::ios::out | std::ios::trunc);
+    if (file.good() == false)
+    {
+        Log::Error() << "Failed to export performance counters to " << path;
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    const int historySize = static_cast<int>(PerformanceCounter::sHistorySize);
+    file << "{\n    \"counters\": [";
+    for (size_t i = 0; i < m_Counters.size(); ++i)
+    {
+        const PerformanceCounter& counter = *m_Counters[i];
+        file << (i == 0 ? "\n" : ",\n");
+        file << "        {\n";
+        file << "            \"name\": \"" << counter.GetName() << "\",\n";
+        file << "            \"type\": \"" << (counter.GetType() == PerformanceCounterType::Counter ? "counter" : "gauge") << "\",\n";
+        file << "            \"budget\": " << counter.GetBudget() << ",\n";
+        file << "            \"peak\": " << counter.GetPeakValue() << ",\n";
+        file << "            \"history\": [";
+        for (int frame = 0; frame < historySize; ++frame)
+        {
+            const int index = (m_HistoryOffset + frame) % historySize;
+            file << (frame == 0 ? "" : ", ") << static_cast<int64_t>(counter.GetHistory()[index]);
+        }
+        file << "]\n        }";
+    }
+    file << "\n    ]\n}\n";
+
+    Log::Info() << "Performance counters exported to " << path;
+    return true;
+}
+
+} // namespace Genesis
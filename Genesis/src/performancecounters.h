@@ -0,0 +1,167 @@
+// Copyright 2026 Pedro Nunes
+//
+// This file is part of Genesis.
+//
+// Genesis is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Genesis is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Genesis. If not, see <http://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace Genesis
+{
+
+enum class PerformanceCounterType
+{
+    Counter, // Accumulates during a frame and resets at the end of it, e.g. ray tests per frame.
+    Gauge    // Holds whatever was last set, e.g. live particles.
+};
+
+//////////////////////////////////////////////////////////////////////////
+// PerformanceCounter
+// A named value sampled once per frame into a rolling history.
+// Increment() and Set() can be called from any thread.
+//////////////////////////////////////////////////////////////////////////
+
+class PerformanceCounter
+{
+public:
+    static constexpr size_t sHistorySize = 256;
+
+    PerformanceCounter(const std::string& name, PerformanceCounterType type, int64_t budget);
+
+    void Increment(int64_t amount = 1);
+    void Set(int64_t value);
+
+    const std::string& GetName() const;
+    PerformanceCounterType GetType() const;
+    int64_t GetBudget() const; // 0 if the counter has no budget.
+    void SetBudget(int64_t budget);
+    int64_t GetLastFrameValue() const;
+    int64_t GetPeakValue() const;
+
+    // Ring buffer with sHistorySize entries; the oldest entry is at PerformanceCounters::GetHistoryOffset().
+    const float* GetHistory() const;
+
+private:
+    friend class PerformanceCounters;
+    void EndFrame(int historyOffset);
+
+    std::string m_Name;
+    PerformanceCounterType m_Type;
+    std::atomic<int64_t> m_Value;
+    int64_t m_Budget;
+    int64_t m_LastFrameValue;
+    int64_t m_PeakValue;
+    bool m_OverBudget;
+    float m_History[sHistorySize];
+};
+
+inline void PerformanceCounter::Increment(int64_t amount /* = 1 */)
+{
+    m_Value.fetch_add(amount, std::memory_order_relaxed);
+}
+
+inline void PerformanceCounter::Set(int64_t value)
+{
+    m_Value.store(value, std::memory_order_relaxed);
+}
+
+inline const std::string& PerformanceCounter::GetName() const
+{
+    return m_Name;
+}
+
+inline PerformanceCounterType PerformanceCounter::GetType() const
+{
+    return m_Type;
+}
+
+inline int64_t PerformanceCounter::GetBudget() const
+{
+    return m_Budget;
+}
+
+inline void PerformanceCounter::SetBudget(int64_t budget)
+{
+    m_Budget = budget;
+}
+
+inline int64_t PerformanceCounter::GetLastFrameValue() const
+{
+    return m_LastFrameValue;
+}
+
+inline int64_t PerformanceCounter::GetPeakValue() const
+{
+    return m_PeakValue;
+}
+
+inline const float* PerformanceCounter::GetHistory() const
+{
+    return m_History;
+}
+
+//////////////////////////////////////////////////////////////////////////
+// PerformanceCounters
+// Registry of every PerformanceCounter. Registered counters live until
+// shutdown, so callers are expected to register once and keep the pointer:
+//
+//     static PerformanceCounter* sRayTests = PerformanceCounters::Register("Physics/Ray tests", PerformanceCounterType::Counter);
+//     sRayTests->Increment();
+//
+// A counter with a budget logs a warning whenever its value for a frame
+// goes over that budget.
+//////////////////////////////////////////////////////////////////////////
+
+class PerformanceCounters
+{
+public:
+    // Registering an existing name returns the existing counter.
+    static PerformanceCounter* Register(const std::string& name, PerformanceCounterType type, int64_t budget = 0);
+    static PerformanceCounter* Get(const std::string& name);
+
+    static void EndFrame();
+    static int GetHistoryOffset();
+
+    // Calls the function for every counter, in registration order.
+    template <typename Fn> static void ForEach(Fn fn);
+
+    // Both export the whole history of every counter, oldest frame first.
+    static bool ExportCSV(const std::filesystem::path& path);
+    static bool ExportJSON(const std::filesystem::path& path);
+
+private:
+    static std::mutex m_Mutex;
+    static std::vector<std::unique_ptr<PerformanceCounter>> m_Counters;
+    static int m_HistoryOffset;
+};
+
+template <typename Fn> void PerformanceCounters::ForEach(Fn fn)
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    for (const auto& pCounter : m_Counters)
+    {
+        fn(*pCounter);
+    }
+}
+
+} // namespace Genesis
@@ -0,0 +1,147 @@
+// Copyright 2026 Pedro Nunes
+//
+// This file is part of Genesis.
+//
+// Genesis is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Genesis is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Genesis. If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "performancecounterswindow.h"
+
+#include "imgui/imgui.h"
+#include "imgui/imgui_impl.h"
+#include "implot/implot.h"
+#include "performancecounters.h"
+
+namespace Genesis
+{
+
+PerformanceCountersWindow::PerformanceCountersWindow()
+    : m_Open(false)
+{
+    ImGuiImpl::RegisterDevMenu("Engine", "Performance counters", &m_Open);
+}
+
+PerformanceCountersWindow::~PerformanceCountersWindow()
+{
+    ImGuiImpl::UnregisterDevMenu("Engine", "Performance counters");
+}
+
+TaskStatus PerformanceCountersWindow::Update(float delta)
+{
+    if (m_Open == false)
+    {
+        return TaskStatus::Continue;
+    }
+
+    ImGui::SetNextWindowSize(ImVec2(700, 600), ImGuiCond_Appearing);
+    ImGui::Begin("Performance counters", &m_Open);
+
+    if (ImGui::Button("Export CSV"))
+    {
+        PerformanceCounters::ExportCSV("performancecounters.csv");
+    }
+    ImGui::SameLine();
+    if (ImGui::Button("Export JSON"))
+    {
+        PerformanceCounters::ExportJSON("performancecounters.json");
+    }
+
+    if (ImGui::CollapsingHeader("Counters", ImGuiTreeNodeFlags_DefaultOpen))
+    {
+        ImGui::Columns(5);
+        ImGui::Text("Name");
+        ImGui::NextColumn();
+        ImGui::Text("Type");
+        ImGui::NextColumn();
+        ImGui::Text("Last frame");
+        ImGui::NextColumn();
+        ImGui::Text("Peak");
+        ImGui::NextColumn();
+        ImGui::Text("Budget");
+        ImGui::NextColumn();
+        ImGui::Separator();
+
+        PerformanceCounters::ForEach([this](const PerformanceCounter& counter) {
+            bool plotted = (m_Plotted.find(counter.GetName()) != m_Plotted.end());
+            if (ImGui::Checkbox(counter.GetName().c_str(), &plotted))
+            {
+                if (plotted)
+                {
+                    m_Plotted.insert(counter.GetName());
+                }
+                else
+                {
+                    m_Plotted.erase(counter.GetName());
+                }
+            }
+            ImGui::NextColumn();
+            ImGui::Text("%s", counter.GetType() == PerformanceCounterType::Counter ? "Counter" : "Gauge");
+            ImGui::NextColumn();
+
+            const bool overBudget = (counter.GetBudget() > 0 && counter.GetLastFrameValue() > counter.GetBudget());
+            if (overBudget)
+            {
+                ImGui::TextColored(ImVec4(1.0f, 0.3f, 0.3f, 1.0f), "%lld", static_cast<long long>(counter.GetLastFrameValue()));
+            }
+            else
+            {
+                ImGui::Text("%lld", static_cast<long long>(counter.GetLastFrameValue()));
+            }
+            ImGui::NextColumn();
+            ImGui::Text("%lld", static_cast<long long>(counter.GetPeakValue()));
+            ImGui::NextColumn();
+            if (counter.GetBudget() > 0)
+            {
+                ImGui::Text("%lld", static_cast<long long>(counter.GetBudget()));
+            }
+            else
+            {
+                ImGui::Text("-");
+            }
+            ImGui::NextColumn();
+        });
+        ImGui::Columns(1);
+    }
+
+    if (m_Plotted.empty() == false && ImGui::CollapsingHeader("History", ImGuiTreeNodeFlags_DefaultOpen))
+    {
+        const int historySize = static_cast<int>(PerformanceCounter::sHistorySize);
+        const int historyOffset = PerformanceCounters::GetHistoryOffset();
+        PerformanceCounters::ForEach([this, historySize, historyOffset](const PerformanceCounter& counter) {
+            if (m_Plotted.find(counter.GetName()) == m_Plotted.end())
+            {
+                return;
+            }
+
+            const std::string plotId = "##" + counter.GetName();
+            if (ImPlot::BeginPlot(plotId.c_str(), ImVec2(-1, 150), ImPlotFlags_NoMenus))
+            {
+                ImPlot::SetupAxes(nullptr, nullptr, ImPlotAxisFlags_NoTickLabels, ImPlotAxisFlags_AutoFit);
+                ImPlot::SetupAxisLimits(ImAxis_X1, 0.0, historySize, ImGuiCond_Always);
+                ImPlot::PlotLine(counter.GetName().c_str(), counter.GetHistory(), historySize, 1.0, 0.0, historyOffset);
+                if (counter.GetBudget() > 0)
+                {
+                    const double budget = static_cast<double>(counter.GetBudget());
+                    ImPlot::PlotHLines("Budget", &budget, 1);
+                }
+                ImPlot::EndPlot();
+            }
+        });
+    }
+
+    ImGui::End();
+    return TaskStatus::Continue;
+}
+
+} // namespace Genesis
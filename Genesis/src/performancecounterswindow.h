@@ -0,0 +1,48 @@
+// Copyright 2026 Pedro Nunes
+//
+// This file is part of Genesis.
+//
+// Genesis is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Genesis is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Genesis. If not, see <http://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+#include "taskmanager.h"
+
+#include <set>
+#include <string>
+
+namespace Genesis
+{
+
+//////////////////////////////////////////////////////////////////////////
+// PerformanceCountersWindow
+// Dev menu window listing every registered PerformanceCounter, with
+// history plots for the selected ones and CSV / JSON export.
+//////////////////////////////////////////////////////////////////////////
+
+class PerformanceCountersWindow : public Task
+{
+public:
+    PerformanceCountersWindow();
+    virtual ~PerformanceCountersWindow();
+
+    TaskStatus Update(float delta);
+
+private:
+    bool m_Open;
+    std::set<std::string> m_Plotted;
+};
+
+} // namespace Genesis
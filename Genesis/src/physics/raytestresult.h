@@ -31,7 +31,7 @@ class Shape;
 class RayTestResult
 {
 public:
-    RayTestResult(const glm::vec3& position, const glm::vec3& normal, ShapeWeakPtr pShape, ShapeWeakPtr pChildShape, float fraction);
+    RayTestResult(const glm::vec3& position, const glm::vec3& normal, ShapeWeakPtr pShape, ShapeWeakPtr pChildShape, void* pUserData, float fraction);
     const glm::vec3& GetPosition() const;
     const glm::vec3& GetNormal() const;
 
@@ -44,11 +44,16 @@ public:
     // The specific child shape we've hit. This will be null if we haven't hit a CompoundObject.
     ShapeWeakPtr GetChildShape() const;
 
+    // The user data of what we've hit. If we've hit a CompoundObject, this is the user data
+    // of the specific child, as child shapes can be shared between several objects.
+    void* GetUserData() const;
+
 private:
     glm::vec3 m_Position;
     glm::vec3 m_Normal;
     ShapeWeakPtr m_pShape;
     ShapeWeakPtr m_pChildShape;
+    void* m_pUserData;
     float m_Fraction;
 };
 
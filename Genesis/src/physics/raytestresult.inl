@@ -24,11 +24,12 @@ namespace Genesis
 namespace Physics
 {
 
-inline RayTestResult::RayTestResult( const glm::vec3& position, const glm::vec3& normal, ShapeWeakPtr pShape, ShapeWeakPtr pChildShape, float fraction ) :
+inline RayTestResult::RayTestResult( const glm::vec3& position, const glm::vec3& normal, ShapeWeakPtr pShape, ShapeWeakPtr pChildShape, void* pUserData, float fraction ) :
 	m_Position( position ),
 	m_Normal( normal ),
 	m_pShape ( pShape ),
 	m_pChildShape( pChildShape ),
+	m_pUserData( pUserData ),
 	m_Fraction( fraction )
 {
 
@@ -54,6 +55,11 @@ inline ShapeWeakPtr RayTestResult::GetChildShape() const
 	return m_pChildShape;
 }
 
+inline void* RayTestResult::GetUserData() const
+{
+	return m_pUserData;
+}
+
 inline float RayTestResult::GetFraction() const
 {
 	return m_Fraction;
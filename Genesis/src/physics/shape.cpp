@@ -74,20 +74,43 @@ BoxShape::BoxShape(float width, float height, float depth)
 // CompoundShape
 /////////////////////////////////////////////////////////////////////
 
-CompoundShape::CompoundShape()
+CompoundShape::CompoundShape(unsigned int initialChildCapacity)
 {
-    m_pShape = new btCompoundShape(true, 4);
+    m_pShape = new btCompoundShape(true, static_cast<int>(initialChildCapacity));
     m_pShape->setUserPointer(this);
-    m_ChildShapes.reserve(4);
+    m_ChildShapes.reserve(initialChildCapacity);
 }
 
-void CompoundShape::AddChildShape(ShapeSharedPtr pShape, const glm::mat4x4& localTransform)
+CompoundShape::CompoundShape(const CompoundShapeChildren& children)
+{
+    // The dynamic AABB tree is only created after all the children have been added,
+    // rather than being updated with every insertion.
+    btCompoundShape* pCompoundShape = new btCompoundShape(false, static_cast<int>(children.size()));
+    m_pShape = pCompoundShape;
+    m_pShape->setUserPointer(this);
+    m_ChildShapes = children;
+
+    btTransform tr;
+    for (const CompoundShapeChild& child : m_ChildShapes)
+    {
+        tr.setFromOpenGLMatrix(glm::value_ptr(child.localTransform));
+        pCompoundShape->addChildShape(tr, child.pShape->m_pShape);
+    }
+
+    pCompoundShape->createAabbTreeFromChildren();
+    if (pCompoundShape->getDynamicAabbTree() != nullptr)
+    {
+        pCompoundShape->getDynamicAabbTree()->optimizeTopDown();
+    }
+}
+
+void CompoundShape::AddChildShape(ShapeSharedPtr pShape, const glm::mat4x4& localTransform, void* pUserData /* = nullptr */)
 {
     btCompoundShape* pCompoundShape = static_cast<btCompoundShape*>(m_pShape);
     btTransform tr;
     tr.setFromOpenGLMatrix(glm::value_ptr(localTransform));
     pCompoundShape->addChildShape(tr, pShape->m_pShape);
-    m_ChildShapes.push_back(std::pair<ShapeSharedPtr, glm::mat4x4>(pShape, localTransform));
+    m_ChildShapes.emplace_back(pShape, localTransform, pUserData);
 }
 
 std::size_t CompoundShape::GetChildrenCount() const
@@ -101,7 +124,22 @@ void CompoundShape::RemoveChildShape(ShapeSharedPtr pShape)
     const size_t numChildShapes = m_ChildShapes.size();
     for (unsigned int idx = 0; idx < numChildShapes; ++idx)
     {
-        if (m_ChildShapes[idx].first == pShape)
+        if (m_ChildShapes[idx].pShape == pShape)
+        {
+            RemoveChildShape(idx);
+            break;
+        }
+    }
+}
+
+// Removes the child which was added with the given user data. This is the way to
+// remove a specific child when its shape is shared with other children.
+void CompoundShape::RemoveChildShapeByUserData(void* pUserData)
+{
+    const size_t numChildShapes = m_ChildShapes.size();
+    for (unsigned int idx = 0; idx < numChildShapes; ++idx)
+    {
+        if (m_ChildShapes[idx].pUserData == pUserData)
         {
             RemoveChildShape(idx);
             break;
@@ -127,7 +165,7 @@ ShapeSharedPtr CompoundShape::GetChildShape(unsigned int index) const
         return nullptr;
     }
 
-    ShapeSharedPtr pChildShape = m_ChildShapes[index].first;
+    ShapeSharedPtr pChildShape = m_ChildShapes[index].pShape;
     SDL_assert(pChildShape->m_pShape == static_cast<btCompoundShape*>(m_pShape)->getChildShape(index));
 
     return pChildShape;
@@ -136,7 +174,18 @@ ShapeSharedPtr CompoundShape::GetChildShape(unsigned int index) const
 glm::mat4x4 CompoundShape::GetChildTransform(unsigned int index) const
 {
     SDL_assert(index < m_ChildShapes.size());
-    return m_ChildShapes[index].second;
+    return m_ChildShapes[index].localTransform;
+}
+
+void* CompoundShape::GetChildUserData(unsigned int index) const
+{
+    if (index >= m_ChildShapes.size())
+    {
+        return nullptr;
+    }
+
+    const CompoundShapeChild& child = m_ChildShapes[index];
+    return (child.pUserData != nullptr) ? child.pUserData : child.pShape->GetUserData();
 }
 
 /////////////////////////////////////////////////////////////////////
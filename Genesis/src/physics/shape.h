@@ -91,23 +91,48 @@ public:
 // CompoundShape
 /////////////////////////////////////////////////////////////////////
 
+// A child shape can be shared between several compounds (or several times in the same compound),
+// so any per-child identity is kept in the compound itself through the child's user data.
+struct CompoundShapeChild
+{
+    CompoundShapeChild(ShapeSharedPtr _pShape, const glm::mat4x4& _localTransform, void* _pUserData = nullptr)
+        : pShape(_pShape)
+        , localTransform(_localTransform)
+        , pUserData(_pUserData)
+    {
+    }
+
+    ShapeSharedPtr pShape;
+    glm::mat4x4 localTransform;
+    void* pUserData;
+};
+using CompoundShapeChildren = std::vector<CompoundShapeChild>;
+
 class CompoundShape : public Shape
 {
 public:
-    CompoundShape();
+    CompoundShape(unsigned int initialChildCapacity = 4);
+
+    // Builds the compound from all its children in a single pass, with the
+    // dynamic AABB tree created once all the children are in place.
+    CompoundShape(const CompoundShapeChildren& children);
 
-    void AddChildShape(ShapeSharedPtr pShape, const glm::mat4x4& localTransform);
+    void AddChildShape(ShapeSharedPtr pShape, const glm::mat4x4& localTransform, void* pUserData = nullptr);
     void RemoveChildShape(ShapeSharedPtr pShape);
     void RemoveChildShape(unsigned int index);
+    void RemoveChildShapeByUserData(void* pUserData);
     ShapeSharedPtr GetChildShape(unsigned int index) const;
     glm::mat4x4 GetChildTransform(unsigned int index) const;
+
+    // Returns the user data given to this child when it was added to the compound,
+    // falling back to the child shape's own user data if there wasn't any.
+    void* GetChildUserData(unsigned int index) const;
     std::size_t GetChildrenCount() const;
 
     virtual Type GetType() const override { return Type::Compound; }
 
 private:
-    using ChildShapeContainer = std::vector<std::pair<ShapeSharedPtr, glm::mat4x4>>;
-    ChildShapeContainer m_ChildShapes;
+    CompoundShapeChildren m_ChildShapes;
 };
 
 /////////////////////////////////////////////////////////////////////
@@ -0,0 +1,127 @@
+// Copyright 2026 Pedro Nunes
+//
+// This file is part of Genesis.
+//
+// Genesis is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Genesis is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Genesis. If not, see <http://www.gnu.org/licenses/>.
+
+#include "physics/shapecache.h"
+
+#include <functional>
+
+namespace Genesis
+{
+namespace Physics
+{
+
+// Expired entries are only removed every so often, rather than on every insertion.
+static const std::size_t sPruneInterval = 64;
+
+ShapeCache::ShapeCache()
+    : m_Hits(0)
+    , m_InsertionsSincePrune(0)
+{
+}
+
+BoxShapeSharedPtr ShapeCache::GetBoxShape(float width, float height, float depth)
+{
+    return GetOrCreate<BoxShape>(Key{Shape::Type::Box, 0, {width, height, depth}}, width, height, depth);
+}
+
+SphereShapeSharedPtr ShapeCache::GetSphereShape(float radius)
+{
+    return GetOrCreate<SphereShape>(Key{Shape::Type::Sphere, 0, {radius, radius, radius}}, radius);
+}
+
+CylinderShapeSharedPtr ShapeCache::GetCylinderShape(CylinderShapeAxis axis, float width, float height, float depth)
+{
+    return GetOrCreate<CylinderShape>(Key{Shape::Type::Cylinder, static_cast<int>(axis), {width, height, depth}}, axis, width, height, depth);
+}
+
+std::size_t ShapeCache::GetCachedShapesCount() const
+{
+    std::size_t count = 0;
+    for (auto& pair : m_Shapes)
+    {
+        if (!pair.second.expired())
+        {
+            count++;
+        }
+    }
+    return count;
+}
+
+std::size_t ShapeCache::GetHits() const
+{
+    return m_Hits;
+}
+
+template <typename T, typename... Args> std::shared_ptr<T> ShapeCache::GetOrCreate(const Key& key, Args&&... args)
+{
+    ShapeMap::iterator it = m_Shapes.find(key);
+    if (it != m_Shapes.end())
+    {
+        ShapeSharedPtr pShape = it->second.lock();
+        if (pShape != nullptr)
+        {
+            m_Hits++;
+            return std::static_pointer_cast<T>(pShape);
+        }
+    }
+
+    std::shared_ptr<T> pShape = std::make_shared<T>(std::forward<Args>(args)...);
+    m_Shapes[key] = pShape;
+
+    if (++m_InsertionsSincePrune >= sPruneInterval)
+    {
+        PruneExpired();
+    }
+
+    return pShape;
+}
+
+void ShapeCache::PruneExpired()
+{
+    for (ShapeMap::iterator it = m_Shapes.begin(); it != m_Shapes.end();)
+    {
+        if (it->second.expired())
+        {
+            it = m_Shapes.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+    m_InsertionsSincePrune = 0;
+}
+
+size_t ShapeCache::KeyHashFn::operator()(const Key& key) const
+{
+    size_t h = std::hash<int>()(static_cast<int>(key.type));
+    h ^= std::hash<int>()(key.variant) + 0x9e3779b9 + (h << 6) + (h >> 2);
+    for (float dimension : key.dimensions)
+    {
+        h ^= std::hash<float>()(dimension) + 0x9e3779b9 + (h << 6) + (h >> 2);
+    }
+    return h;
+}
+
+bool ShapeCache::KeyEqualsFn::operator()(const Key& lhs, const Key& rhs) const
+{
+    return lhs.type == rhs.type && lhs.variant == rhs.variant && lhs.dimensions[0] == rhs.dimensions[0] && lhs.dimensions[1] == rhs.dimensions[1] &&
+           lhs.dimensions[2] == rhs.dimensions[2];
+}
+
+} // namespace Physics
+} // namespace Genesis
@@ -0,0 +1,85 @@
+// Copyright 2026 Pedro Nunes
+//
+// This file is part of Genesis.
+//
+// Genesis is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Genesis is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Genesis. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "shape.h"
+
+#include <cstddef>
+#include <unordered_map>
+
+namespace Genesis
+{
+namespace Physics
+{
+
+/////////////////////////////////////////////////////////////////////
+// ShapeCache
+// Interns primitive shapes so that geometrically identical shapes
+// share a single underlying Bullet shape. Shapes are reference counted
+// through their shared pointers: the cache only holds weak references,
+// so a shape is destroyed once nothing else is using it.
+// Shapes returned by the cache are shared and must not have user data
+// set on them directly. When they are used as children of a
+// CompoundShape, per-child user data should be passed to the compound
+// instead.
+/////////////////////////////////////////////////////////////////////
+
+class ShapeCache
+{
+public:
+    ShapeCache();
+
+    BoxShapeSharedPtr GetBoxShape(float width, float height, float depth);
+    SphereShapeSharedPtr GetSphereShape(float radius);
+    CylinderShapeSharedPtr GetCylinderShape(CylinderShapeAxis axis, float width, float height, float depth);
+
+    // Number of distinct shapes currently alive in the cache.
+    std::size_t GetCachedShapesCount() const;
+
+    // Number of requests which were served by an existing shape.
+    std::size_t GetHits() const;
+
+private:
+    struct Key
+    {
+        Shape::Type type;
+        int variant;
+        float dimensions[3];
+    };
+
+    struct KeyHashFn
+    {
+        size_t operator()(const Key& key) const;
+    };
+
+    struct KeyEqualsFn
+    {
+        bool operator()(const Key& lhs, const Key& rhs) const;
+    };
+
+    template <typename T, typename... Args> std::shared_ptr<T> GetOrCreate(const Key& key, Args&&... args);
+    void PruneExpired();
+
+    using ShapeMap = std::unordered_map<Key, ShapeWeakPtr, KeyHashFn, KeyEqualsFn>;
+    ShapeMap m_Shapes;
+    std::size_t m_Hits;
+    std::size_t m_InsertionsSincePrune;
+};
+
+} // namespace Physics
+} // namespace Genesis
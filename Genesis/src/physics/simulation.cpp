@@ -17,6 +17,7 @@
 
 #include "physics/simulation.h"
 
+#include "performancecounters.h"
 #include "physics/debugrender.h"
 #include "physics/ghost.h"
 #include "physics/private/customrayresultcallback.h"
@@ -66,7 +67,8 @@ void InternalTickCallback(btDynamicsWorld* pDynamicsWorld, btScalar timeStep)
 
         RigidBody* pRigidBodyA = static_cast<RigidBody*>(pCollisionObjectA);
         RigidBody* pRigidBodyB = static_cast<RigidBody*>(pCollisionObjectB);
-        auto extractShapeFn = [](RigidBody* pRigidBody, int shapeIndex) -> ShapeWeakPtr {
+        auto extractShapeFn = [](RigidBody* pRigidBody, int shapeIndex, void*& pUserData) -> ShapeWeakPtr {
+            pUserData = nullptr;
             if (pRigidBody->GetShape().expired())
             {
                 return ShapeWeakPtr();
@@ -78,10 +80,12 @@ void InternalTickCallback(btDynamicsWorld* pDynamicsWorld, btScalar timeStep)
                 {
                     SDL_assert(pShape->GetType() == Shape::Type::Compound);
                     CompoundShapeSharedPtr pCompoundShape = std::static_pointer_cast<CompoundShape>(pShape);
+                    pUserData = pCompoundShape->GetChildUserData(shapeIndex);
                     return pCompoundShape->GetChildShape(shapeIndex);
                 }
                 else
                 {
+                    pUserData = pShape->GetUserData();
                     return pShape;
                 }
             }
@@ -101,14 +105,16 @@ void InternalTickCallback(btDynamicsWorld* pDynamicsWorld, btScalar timeStep)
             // shape, with the Genesis::Physics::Shape and the underlying btShape
             // not agreeing as to how many shapes they have.
             // This only appears to happen during this internal tick callback.
-            ShapeWeakPtr pShapeA = extractShapeFn(pRigidBodyA, pt.m_index0);
-            ShapeWeakPtr pShapeB = extractShapeFn(pRigidBodyB, pt.m_index1);
+            void* pUserDataA = nullptr;
+            void* pUserDataB = nullptr;
+            ShapeWeakPtr pShapeA = extractShapeFn(pRigidBodyA, pt.m_index0, pUserDataA);
+            ShapeWeakPtr pShapeB = extractShapeFn(pRigidBodyB, pt.m_index1, pUserDataB);
             if (pShapeA.expired() || pShapeB.expired())
             {
                 continue;
             }
 
-            collisionDataSet.emplace(pRigidBodyA, pRigidBodyB, pShapeA, pShapeB, (gptA + gptB) / 2.0f);
+            collisionDataSet.emplace(pRigidBodyA, pRigidBodyB, pShapeA, pShapeB, pUserDataA, pUserDataB, (gptA + gptB) / 2.0f);
         }
     }
 }
@@ -141,8 +147,31 @@ Simulation::~Simulation()
     delete m_pDebugRender;
 }
 
+#if GENESIS_MEMORY_TRACKING
+static void* BulletAlignedAllocate(size_t size, int alignment)
+{
+    return MemoryTracker::Allocate(size, static_cast<size_t>(alignment), MemoryTag::Physics);
+}
+
+static void* BulletAllocate(size_t size)
+{
+    return MemoryTracker::Allocate(size, alignof(std::max_align_t), MemoryTag::Physics);
+}
+
+void Simulation::TrackAllocations()
+{
+    btAlignedAllocSetCustomAligned(&BulletAlignedAllocate, &MemoryTracker::Free);
+    btAlignedAllocSetCustom(&BulletAllocate, &MemoryTracker::Free);
+}
+#endif
+
 TaskStatus Simulation::Update(float delta)
 {
+    GENESIS_MEMORY_SCOPE(Physics);
+
+    static PerformanceCounter* sRigidBodies = PerformanceCounters::Register("Physics/Rigid bodies", PerformanceCounterType::Gauge);
+    sRigidBodies->Set(static_cast<int64_t>(m_RigidBodies.size()));
+
     if (m_IsPaused == false)
     {
         m_pWorld->stepSimulation(delta, 5);
@@ -183,6 +212,9 @@ void Simulation::Remove(Ghost* pGhost)
 
 void Simulation::RayTest(const glm::vec3& from, const glm::vec3& to, RayTestResultVector& results)
 {
+    static PerformanceCounter* sRayTests = PerformanceCounters::Register("Physics/Ray tests", PerformanceCounterType::Counter);
+    sRayTests->Increment();
+
     results.clear();
 
     btVector3 btFrom(from.x, from.y, from.z);
@@ -219,15 +251,17 @@ void Simulation::RayTest(const glm::vec3& from, const glm::vec3& to, RayTestResu
         }
 
         ShapeSharedPtr pChildShape;
+        void* pUserData = pShape->GetUserData();
         const int childShapeIndex = rayCallback.m_hitChildShapeIndex[i];
         if (pShape->GetType() == Shape::Type::Compound)
         {
             CompoundShapeSharedPtr pCompoundShape = std::static_pointer_cast<CompoundShape>(pShape);
             SDL_assert(childShapeIndex != -1 && static_cast<size_t>(childShapeIndex) < pCompoundShape->GetChildrenCount());
             pChildShape = pCompoundShape->GetChildShape(childShapeIndex);
+            pUserData = pCompoundShape->GetChildUserData(childShapeIndex);
         }
 
-        results.emplace_back(glm::vec3(hitPosition.x(), hitPosition.y(), hitPosition.z()), glm::vec3(hitNormal.x(), hitNormal.y(), hitNormal.z()), pShape, pChildShape, hitFraction);
+        results.emplace_back(glm::vec3(hitPosition.x(), hitPosition.y(), hitPosition.z()), glm::vec3(hitNormal.x(), hitNormal.y(), hitNormal.z()), pShape, pChildShape, pUserData, hitFraction);
 
         if (m_pDebugRender->IsEnabled(DebugRender::Mode::RayTests))
         {
@@ -295,6 +329,11 @@ void Simulation::UnregisterCollisionCallback(CollisionCallbackHandle handle)
     Log::Error() << "Attempting to remove CollisionCallbackHandle '" << handle << "', which doesn't exist.";
 }
 
+ShapeCache* Simulation::GetShapeCache()
+{
+    return &m_ShapeCache;
+}
+
 void Simulation::ProcessCollisionCallbacks()
 {
     if (m_CollisionCallbacks.empty())
@@ -308,7 +347,8 @@ void Simulation::ProcessCollisionCallbacks()
     {
         for (auto& collisionData : m_CollisionDataSet)
         {
-            callback.second(collisionData.pRigidBodyA, collisionData.pRigidBodyB, collisionData.pShapeA, collisionData.pShapeB, collisionData.position);
+            callback.second(collisionData.pRigidBodyA, collisionData.pRigidBodyB, collisionData.pShapeA, collisionData.pShapeB, collisionData.pUserDataA, collisionData.pUserDataB,
+                            collisionData.position);
         }
     }
 
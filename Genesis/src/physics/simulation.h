@@ -18,8 +18,12 @@
 #pragma once
 
 #include "physics/raytestresult.h"
+#include "physics/shapecache.h"
 #include "taskmanager.h"
 
+#include <framearena.hpp>
+#include <memorytracker.hpp>
+
 #include <functional>
 #include <list>
 #include <unordered_set>
@@ -42,8 +46,8 @@ class Shape;
 class Window;
 using RigidBodyList = std::list<RigidBody*>;
 using GhostList = std::list<Ghost*>;
-using RayTestResultVector = std::vector<RayTestResult>;
-using CollisionCallback = std::function<void(RigidBody*, RigidBody*, ShapeWeakPtr, ShapeWeakPtr, const glm::vec3&)>;
+using RayTestResultVector = std::pmr::vector<RayTestResult>; // Construct with &FrameArena::Get() when only needed for this frame.
+using CollisionCallback = std::function<void(RigidBody*, RigidBody*, ShapeWeakPtr, ShapeWeakPtr, void*, void*, const glm::vec3&)>;
 using CollisionCallbackHandle = unsigned long;
 using CollisionCallbackList = std::list<std::pair<CollisionCallbackHandle, CollisionCallback>>;
 
@@ -51,11 +55,13 @@ static const CollisionCallbackHandle InvalidCollisionCallbackHandle = ~0UL;
 
 struct CollisionData
 {
-    CollisionData(RigidBody* _pRigidBodyA, RigidBody* _pRigidBodyB, ShapeWeakPtr _pShapeA, ShapeWeakPtr _pShapeB, const glm::vec3& _position)
+    CollisionData(RigidBody* _pRigidBodyA, RigidBody* _pRigidBodyB, ShapeWeakPtr _pShapeA, ShapeWeakPtr _pShapeB, void* _pUserDataA, void* _pUserDataB, const glm::vec3& _position)
         : pRigidBodyA(_pRigidBodyA)
         , pRigidBodyB(_pRigidBodyB)
         , pShapeA(_pShapeA)
         , pShapeB(_pShapeB)
+        , pUserDataA(_pUserDataA)
+        , pUserDataB(_pUserDataB)
         , position(_position)
     {
     }
@@ -64,6 +70,8 @@ struct CollisionData
     RigidBody* pRigidBodyB;
     ShapeWeakPtr pShapeA;
     ShapeWeakPtr pShapeB;
+    void* pUserDataA; // User data of the specific child shape hit, for compound shapes.
+    void* pUserDataB;
     glm::vec3 position;
 };
 
@@ -92,6 +100,11 @@ public:
     Simulation();
     virtual ~Simulation();
 
+#if GENESIS_MEMORY_TRACKING
+    // Routes Bullet's allocations through the memory tracker. Must be called before any Bullet object is created.
+    static void TrackAllocations();
+#endif
+
     Genesis::TaskStatus Update(float delta);
 
     void Add(RigidBody* pRigidBody);
@@ -114,6 +127,10 @@ public:
     CollisionCallbackHandle RegisterCollisionCallback(const CollisionCallback& callbackFn);
     void UnregisterCollisionCallback(CollisionCallbackHandle handle);
 
+    // Primitive shapes should be retrieved from the cache whenever they are going to
+    // be used by many objects, so identical shapes are shared rather than duplicated.
+    ShapeCache* GetShapeCache();
+
 private:
     void RenderAdditionalInformation();
     void ProcessCollisionCallbacks();
@@ -131,6 +148,7 @@ private:
     bool m_ProcessingCallbacks;
     CollisionCallbackList m_CollisionCallbacks;
     CollisionDataSet m_CollisionDataSet;
+    ShapeCache m_ShapeCache;
 };
 
 } // namespace Genesis::Physics
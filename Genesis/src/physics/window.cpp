@@ -72,6 +72,11 @@ void Window::Update(float delta)
             ImGui::Text("%d", sActiveShapes);
             ImGui::NextColumn();
 
+            ImGui::Text("Shared shapes");
+            ImGui::NextColumn();
+            ImGui::Text("%zu (%zu reuses)", m_pSimulation->m_ShapeCache.GetCachedShapesCount(), m_pSimulation->m_ShapeCache.GetHits());
+            ImGui::NextColumn();
+
             ImGui::Text("RigidBody");
             ImGui::NextColumn();
             ImGui::Text("%zu", m_pSimulation->m_RigidBodies.size());
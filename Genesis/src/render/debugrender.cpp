@@ -67,8 +67,8 @@ void DebugRender::RenderLines()
         return;
     }
 
-    PositionData posData;
-    ColourData colourData;
+    FramePositionData posData(&FrameArena::Get());
+    FrameColourData colourData(&FrameArena::Get());
 
     for (auto& line : m_Lines)
     {
@@ -103,8 +103,8 @@ void DebugRender::RenderCircles()
         return;
     }
 
-    PositionData posData;
-    ColourData colourData;
+    FramePositionData posData(&FrameArena::Get());
+    FrameColourData colourData(&FrameArena::Get());
 
     for (auto& circle : m_Circles)
     {
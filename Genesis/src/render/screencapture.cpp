@@ -0,0 +1,252 @@
+// Copyright 2026 Pedro Nunes
+//
+// This file is part of Genesis.
+//
+// Genesis is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Genesis is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Genesis. If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "render/screencapture.h"
+
+#include <algorithm>
+#include <cstring>
+#include <log.hpp>
+
+namespace Genesis
+{
+
+ScreenCapture::ScreenCapture()
+    : m_Width(0)
+    , m_Height(0)
+    , m_Pitch(0)
+    , m_NextReadback(0)
+    , m_PendingReadbacks(0)
+    , m_Saturated(false)
+    , m_ShuttingDown(false)
+    , m_WrittenCount(0)
+    , m_DroppedCount(0)
+{
+    for (Readback& readback : m_Readbacks)
+    {
+        readback.pbo = 0;
+        readback.fence = nullptr;
+        readback.logWhenWritten = false;
+    }
+}
+
+ScreenCapture::~ScreenCapture()
+{
+    // Anything which was already read back is still written, but readbacks still in flight are lost.
+    {
+        std::lock_guard<std::mutex> lock(m_QueueMutex);
+        m_ShuttingDown = true;
+    }
+    m_QueueCondition.notify_all();
+
+    for (std::thread& worker : m_Workers)
+    {
+        worker.join();
+    }
+
+    for (Readback& readback : m_Readbacks)
+    {
+        if (readback.fence != nullptr)
+        {
+            glDeleteSync(readback.fence);
+        }
+
+        if (readback.pbo != 0)
+        {
+            glDeleteBuffers(1, &readback.pbo);
+        }
+    }
+}
+
+void ScreenCapture::Initialize(GLuint width, GLuint height)
+{
+    m_Width = width;
+    m_Height = height;
+
+    // Rows are read back with the default pack alignment of 4 bytes, which matches the pitch of a 24 bit SDL surface.
+    m_Pitch = (width * 3 + 3) & ~3u;
+
+    for (Readback& readback : m_Readbacks)
+    {
+        glGenBuffers(1, &readback.pbo);
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, readback.pbo);
+        glBufferData(GL_PIXEL_PACK_BUFFER, m_Pitch * m_Height, nullptr, GL_STREAM_READ);
+    }
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+    for (size_t i = 0; i < sWorkerCount; ++i)
+    {
+        m_Workers.emplace_back(&ScreenCapture::WorkerThreadMain, this);
+    }
+}
+
+bool ScreenCapture::Capture(const std::string& filename, bool logWhenWritten)
+{
+    if (m_PendingReadbacks == sReadbackCount)
+    {
+        Drop(filename);
+        return false;
+    }
+
+    Readback& readback = m_Readbacks[(m_NextReadback + m_PendingReadbacks) % sReadbackCount];
+    readback.filename = filename;
+    readback.logWhenWritten = logWhenWritten;
+
+    glPixelStorei(GL_PACK_ALIGNMENT, 4);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, readback.pbo);
+    glReadPixels(0, 0, m_Width, m_Height, GL_RGB, GL_UNSIGNED_BYTE, nullptr);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    readback.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+    m_PendingReadbacks++;
+    return true;
+}
+
+void ScreenCapture::Update()
+{
+    while (m_PendingReadbacks > 0)
+    {
+        Readback& readback = m_Readbacks[m_NextReadback];
+        const GLenum status = glClientWaitSync(readback.fence, 0, 0);
+        if (status == GL_TIMEOUT_EXPIRED)
+        {
+            break;
+        }
+
+        glDeleteSync(readback.fence);
+        readback.fence = nullptr;
+        m_NextReadback = (m_NextReadback + 1) % sReadbackCount;
+        m_PendingReadbacks--;
+
+        if (status == GL_WAIT_FAILED)
+        {
+            Drop(readback.filename);
+            continue;
+        }
+
+        WriteJob job;
+        job.filename = std::move(readback.filename);
+        job.logWhenWritten = readback.logWhenWritten;
+        {
+            std::lock_guard<std::mutex> lock(m_QueueMutex);
+            if (m_Queue.size() >= sMaxQueuedWrites)
+            {
+                Drop(job.filename);
+                continue;
+            }
+
+            if (m_FreeBuffers.empty() == false)
+            {
+                job.pixels = std::move(m_FreeBuffers.back());
+                m_FreeBuffers.pop_back();
+            }
+        }
+
+        job.pixels.resize(m_Pitch * m_Height);
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, readback.pbo);
+        const void* pMapped = glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, m_Pitch * m_Height, GL_MAP_READ_BIT);
+        if (pMapped != nullptr)
+        {
+            memcpy(job.pixels.data(), pMapped, job.pixels.size());
+            glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+        }
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+        if (pMapped == nullptr)
+        {
+            Drop(job.filename);
+            continue;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_QueueMutex);
+            m_Queue.push_back(std::move(job));
+        }
+        m_QueueCondition.notify_one();
+        m_Saturated = false;
+    }
+}
+
+void ScreenCapture::Drop(const std::string& filename)
+{
+    m_DroppedCount++;
+    if (m_Saturated == false)
+    {
+        m_Saturated = true;
+        Log::Warning() << "Screen capture can't keep up, dropping frames starting with " << filename << " (" << m_DroppedCount << " dropped so far).";
+    }
+}
+
+void ScreenCapture::WorkerThreadMain()
+{
+    while (true)
+    {
+        WriteJob job;
+        {
+            std::unique_lock<std::mutex> lock(m_QueueMutex);
+            m_QueueCondition.wait(lock, [this] { return m_ShuttingDown || m_Queue.empty() == false; });
+            if (m_Queue.empty())
+            {
+                return;
+            }
+
+            job = std::move(m_Queue.front());
+            m_Queue.pop_front();
+        }
+
+        if (Write(job))
+        {
+            m_WrittenCount++;
+        }
+
+        std::lock_guard<std::mutex> lock(m_QueueMutex);
+        m_FreeBuffers.push_back(std::move(job.pixels));
+    }
+}
+
+bool ScreenCapture::Write(const WriteJob& job) const
+{
+    SDL_Surface* pSurface = SDL_CreateRGBSurface(SDL_SWSURFACE, m_Width, m_Height, 24, 0x000000FF, 0x0000FF00, 0x00FF0000, 0);
+    if (pSurface == nullptr)
+    {
+        Log::Warning() << "Couldn't create surface for " << job.filename << ": " << SDL_GetError();
+        return false;
+    }
+
+    // OpenGL's origin is the bottom left corner, so the rows need to be flipped vertically before being dumped into the BMP.
+    Uint8* pDestination = static_cast<Uint8*>(pSurface->pixels);
+    const size_t rowLength = std::min<size_t>(m_Pitch, pSurface->pitch);
+    for (GLuint row = 0; row < m_Height; ++row)
+    {
+        memcpy(pDestination + row * pSurface->pitch, job.pixels.data() + (m_Height - row - 1) * m_Pitch, rowLength);
+    }
+
+    const bool written = (SDL_SaveBMP(pSurface, job.filename.c_str()) == 0);
+    if (written == false)
+    {
+        Log::Warning() << "Couldn't write " << job.filename << ": " << SDL_GetError();
+    }
+    else if (job.logWhenWritten)
+    {
+        Log::Info() << "Screenshot taken: " << job.filename;
+    }
+
+    SDL_FreeSurface(pSurface);
+    return written;
+}
+
+} // namespace Genesis
@@ -0,0 +1,130 @@
+// Copyright 2026 Pedro Nunes
+//
+// This file is part of Genesis.
+//
+// Genesis is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Genesis is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Genesis. If not, see <http://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+#include "rendersystem.fwd.h"
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Genesis
+{
+
+/////////////////////////////////////////////////////////////////////
+// ScreenCapture
+// Saves the contents of the framebuffer to disk without stalling the
+// main thread. The framebuffer is read into a pixel buffer object,
+// which is only mapped a few frames later once the GPU has finished
+// with it. The pixels are then handed over to worker threads, which
+// flip and write the image.
+// If every pixel buffer is in use or the workers can't keep up, the
+// frame is dropped rather than blocking the game.
+/////////////////////////////////////////////////////////////////////
+
+class ScreenCapture
+{
+public:
+    ScreenCapture();
+    ~ScreenCapture();
+
+    void Initialize(GLuint width, GLuint height);
+
+    // Must be called once per frame, to hand finished readbacks over to the workers.
+    void Update();
+
+    // Starts reading back the current framebuffer, which will be saved as a BMP to the given file.
+    // Returns false if the frame had to be dropped.
+    bool Capture(const std::string& filename, bool logWhenWritten);
+
+    size_t GetPendingReadbacks() const;
+    size_t GetQueuedWrites() const;
+    size_t GetWrittenCount() const;
+    size_t GetDroppedCount() const;
+
+private:
+    struct Readback
+    {
+        GLuint pbo;
+        GLsync fence;
+        std::string filename;
+        bool logWhenWritten;
+    };
+
+    struct WriteJob
+    {
+        std::string filename;
+        bool logWhenWritten;
+        std::vector<Uint8> pixels;
+    };
+
+    void WorkerThreadMain();
+    bool Write(const WriteJob& job) const;
+    void Drop(const std::string& filename);
+
+    static const size_t sReadbackCount = 3;
+    static const size_t sMaxQueuedWrites = 8;
+    static const size_t sWorkerCount = 2;
+
+    GLuint m_Width;
+    GLuint m_Height;
+    GLuint m_Pitch;
+    std::array<Readback, sReadbackCount> m_Readbacks;
+    size_t m_NextReadback; // Readbacks are used as a ring, so that frames are written in order.
+    size_t m_PendingReadbacks;
+    bool m_Saturated; // Set while frames are being dropped, so the warning is only logged once per burst.
+
+    mutable std::mutex m_QueueMutex;
+    std::condition_variable m_QueueCondition;
+    std::deque<WriteJob> m_Queue;
+    std::vector<std::vector<Uint8>> m_FreeBuffers; // Pixel buffers returned by the workers, to avoid allocating a frame's worth of memory every capture.
+    bool m_ShuttingDown;
+    std::vector<std::thread> m_Workers;
+
+    std::atomic<size_t> m_WrittenCount;
+    std::atomic<size_t> m_DroppedCount;
+};
+
+inline size_t ScreenCapture::GetPendingReadbacks() const
+{
+    return m_PendingReadbacks;
+}
+
+inline size_t ScreenCapture::GetQueuedWrites() const
+{
+    std::lock_guard<std::mutex> lock(m_QueueMutex);
+    return m_Queue.size();
+}
+
+inline size_t ScreenCapture::GetWrittenCount() const
+{
+    return m_WrittenCount;
+}
+
+inline size_t ScreenCapture::GetDroppedCount() const
+{
+    return m_DroppedCount;
+}
+
+} // namespace Genesis
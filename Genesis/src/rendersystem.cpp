@@ -15,6 +15,7 @@
 // You should have received a copy of the GNU General Public License
 // along with Genesis. If not, see <http://www.gnu.org/licenses/>.
 
+#include <iomanip>
 #include <iostream>
 #include <sstream>
 
@@ -43,6 +44,7 @@
 
 #include <SDL_image.h>
 #include <log.hpp>
+#include <memorytracker.hpp>
 
 // These exports tell the drivers to use a high performance GPU.
 // Without these and in computers which have an integrated graphics card, it is
@@ -59,7 +61,12 @@ namespace Genesis
 
 RenderSystem::RenderSystem()
     : m_ScreenshotScheduled( false )
+    , m_ScreenshotRequested( false )
     , m_CaptureInProgress( false )
+    , m_NextScreenshotIndex( 1 )
+    , m_CaptureIndex( 0 )
+    , m_CaptureFrame( 0 )
+    , m_CaptureDroppedAtStart( 0 )
     , m_ScreenWidth( 0 )
     , m_ScreenHeight( 0 )
     , m_pPostProcessShader( nullptr )
@@ -70,6 +77,7 @@ RenderSystem::RenderSystem()
     , m_pGlowVertexBuffer( nullptr )
     , m_ShaderTimer( 0.0f )
     , m_DrawCallCount( 0 )
+    , m_pDrawCallCounter( PerformanceCounters::Register( "Render/Draw calls", PerformanceCounterType::Counter ) )
     , m_BlendMode( BlendMode::Disabled )
     , m_InputCallbackScreenshot( InputManager::sInvalidInputCallbackToken )
     , m_InputCallbackCapture( InputManager::sInvalidInputCallbackToken )
@@ -161,6 +169,7 @@ void RenderSystem::Initialize( GLuint screenWidth, GLuint screenHeight )
     CreateRenderTargets();
     InitializePostProcessing();
     InitializeGlowChain();
+    m_ScreenCapture.Initialize( m_ScreenWidth, m_ScreenHeight );
 
     m_InputCallbackScreenshot = FrameWork::GetInputManager()->AddKeyboardCallback( std::bind( &RenderSystem::TakeScreenshot, this ), SDL_SCANCODE_PRINTSCREEN, ButtonState::Pressed );
     m_InputCallbackCapture = FrameWork::GetInputManager()->AddKeyboardCallback( std::bind( &RenderSystem::Capture, this ), SDL_SCANCODE_F8, ButtonState::Pressed );
@@ -265,6 +274,21 @@ void RenderSystem::DrawDebugWindow()
         }
     }
 
+    Gui::GuiBatch* pGuiBatch = Gui::GuiManager::GetBatch();
+    if ( pGuiBatch != nullptr && ImGui::CollapsingHeader( "GUI", ImGuiTreeNodeFlags_DefaultOpen ) )
+    {
+        ImGui::Text( "Batched quads: %zu", pGuiBatch->GetQuadCount() );
+        ImGui::Text( "Batched draw calls: %zu", pGuiBatch->GetDrawCallCount() );
+    }
+
+    if ( ImGui::CollapsingHeader( "Screen capture" ) )
+    {
+        ImGui::Text( "Pending readbacks: %zu", m_ScreenCapture.GetPendingReadbacks() );
+        ImGui::Text( "Queued writes: %zu", m_ScreenCapture.GetQueuedWrites() );
+        ImGui::Text( "Written: %zu", m_ScreenCapture.GetWrittenCount() );
+        ImGui::Text( "Dropped: %zu", m_ScreenCapture.GetDroppedCount() );
+    }
+
     ImGui::End();
 }
 
@@ -544,8 +568,11 @@ void RenderSystem::RenderGlow()
 
 TaskStatus RenderSystem::Update( float delta )
 {
+    GENESIS_MEMORY_SCOPE( Render );
+
     m_ShaderTimer += delta;
 
+    m_ScreenCapture.Update();
     ClearAll();
 
     for ( auto& pViewport : m_Viewports )
@@ -573,13 +600,9 @@ TaskStatus RenderSystem::Update( float delta )
     ImGuiImpl::Render();
     m_pCurrentViewport = nullptr;
 
+    QueueCaptures();
     FrameWork::GetWindow()->Present();
 
-    if ( IsScreenshotScheduled() )
-    {
-        TakeScreenshotAux( true );
-    }
-
     return TaskStatus::Continue;
 }
 
@@ -699,28 +722,11 @@ void RenderSystem::TakeScreenshot()
 
 void RenderSystem::TakeScreenshotAux( bool immediate )
 {
+    // The framebuffer is only read at the end of the frame, once everything has been rendered.
+    // A scheduled screenshot also hides any GUI elements which shouldn't be captured.
     if ( immediate )
     {
-        std::string filename;
-        if ( GetScreenshotFilename( filename ) )
-        {
-            SDL_Surface* pSurface = SDL_CreateRGBSurface( SDL_SWSURFACE, m_ScreenWidth, m_ScreenHeight, 24, 0x000000FF, 0x0000FF00, 0x00FF0000, 0 );
-            glReadPixels( 0, 0, m_ScreenWidth, m_ScreenHeight, GL_RGB, GL_UNSIGNED_BYTE, pSurface->pixels );
-
-            // The image needs to be flipped vertically before being dumped into the BMP
-            SDL_Surface* pFlippedSurface = FlipSurfaceVertical( pSurface );
-            SDL_SaveBMP( pFlippedSurface, filename.c_str() );
-            SDL_FreeSurface( pSurface );
-            SDL_FreeSurface( pFlippedSurface );
-
-            Log::Info() << "Screenshot taken: " << filename;
-        }
-        else
-        {
-            Log::Warning() << "Couldn't take screenshot.";
-        }
-
-        m_ScreenshotScheduled = false;
+        m_ScreenshotRequested = true;
     }
     else
     {
@@ -741,43 +747,65 @@ void RenderSystem::Capture()
     }
 }
 
-// Function courtesy of Sebastian Beschke s.beschke@gmx.de, adapted to C
-// From http://lists.libsdl.org/pipermail/sdl-libsdl.org/2005-January/047963.html
-SDL_Surface* RenderSystem::FlipSurfaceVertical( SDL_Surface* pSurface ) const
+void RenderSystem::BeginCapture()
 {
-    SDL_Surface* pFlippedSurface = SDL_CreateRGBSurface( pSurface->flags, pSurface->w, pSurface->h, pSurface->format->BytesPerPixel * 8, pSurface->format->Rmask, pSurface->format->Gmask,
-        pSurface->format->Bmask, pSurface->format->Amask );
-    Uint8* pixels = (Uint8*)pSurface->pixels;
-    Uint8* rpixels = (Uint8*)pFlippedSurface->pixels;
-    Uint32 pitch = pSurface->pitch;
-    Uint32 pxlength = pitch * pSurface->h;
+    m_CaptureInProgress = true;
+    m_CaptureIndex++;
+    m_CaptureFrame = 0;
+    m_CaptureDroppedAtStart = m_ScreenCapture.GetDroppedCount();
+    Log::Info() << "Capture " << m_CaptureIndex << " started.";
+}
+
+void RenderSystem::EndCapture()
+{
+    m_CaptureInProgress = false;
+    const size_t dropped = m_ScreenCapture.GetDroppedCount() - m_CaptureDroppedAtStart;
+    Log::Info() << "Capture " << m_CaptureIndex << " finished: " << m_CaptureFrame << " frames, " << dropped << " dropped.";
+}
 
-    for ( Uint32 line = 0; line < (Uint32)pSurface->h; ++line )
+// Reads back the framebuffer if a screenshot was requested or a capture is in progress.
+// This needs to happen before the frame is presented, as the back buffer's contents are undefined afterwards.
+void RenderSystem::QueueCaptures()
+{
+    if ( m_ScreenshotRequested || m_ScreenshotScheduled )
     {
-        Uint32 pos = line * pitch;
-        memcpy( &rpixels[ pxlength - pos - pitch ], &pixels[ pos ], pitch );
+        std::string filename;
+        if ( GetScreenshotFilename( filename ) )
+        {
+            m_ScreenCapture.Capture( filename, true );
+        }
+        else
+        {
+            Log::Warning() << "Couldn't take screenshot.";
+        }
+
+        m_ScreenshotRequested = false;
+        m_ScreenshotScheduled = false;
     }
 
-    return pFlippedSurface;
+    if ( IsCaptureInProgress() )
+    {
+        std::stringstream ss;
+        ss << "Capture" << m_CaptureIndex << "_" << std::setw( 5 ) << std::setfill( '0' ) << m_CaptureFrame++ << ".bmp";
+        m_ScreenCapture.Capture( ss.str(), false );
+    }
 }
 
-bool RenderSystem::GetScreenshotFilename( std::string& filename ) const
+// Screenshots are written asynchronously, so files which haven't been written yet can't be detected
+// on disk. The index is only ever incremented to avoid handing out the same name twice.
+bool RenderSystem::GetScreenshotFilename( std::string& filename )
 {
-    for ( int counter = 1; counter <= 999; ++counter )
+    for ( ; m_NextScreenshotIndex <= 999; ++m_NextScreenshotIndex )
     {
         std::stringstream ss;
-        ss << "Screenshot" << counter << ".bmp";
+        ss << "Screenshot" << m_NextScreenshotIndex << ".bmp";
         std::string temporaryFilename = ss.str();
 
         std::ifstream file( temporaryFilename.c_str() );
-        if ( file.good() )
-        {
-            file.close();
-        }
-        else
+        if ( file.good() == false )
         {
-            file.close();
             filename = temporaryFilename;
+            m_NextScreenshotIndex++;
             return true;
         }
     }
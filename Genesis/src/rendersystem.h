@@ -20,7 +20,9 @@
 #include "colour.h"
 #include "glm/gtx/transform.hpp"
 #include "inputmanager.h"
+#include "performancecounters.h"
 #include "render/rendertarget.h"
+#include "render/screencapture.h"
 #include "rendersystem.fwd.h"
 #include "resources/resourceshader.hpp"
 #include "shaderuniformtype.h"
@@ -109,11 +111,11 @@ private:
         glm::vec3& out_direction );
     IntersectionResult LinePlaneIntersection( const glm::vec3& position, const glm::vec3& direction, const glm::vec3& planePosition, const glm::vec3& planeNormal, glm::vec3& result );
 
-    bool GetScreenshotFilename( std::string& filename ) const;
-    SDL_Surface* FlipSurfaceVertical( SDL_Surface* pSurface ) const;
+    bool GetScreenshotFilename( std::string& filename );
     void TakeScreenshot();
     void TakeScreenshotAux( bool immediate );
     void Capture();
+    void QueueCaptures();
 
     void InitializeDebug();
     std::string GetRenderbufferParameters( GLuint id );
@@ -121,7 +123,13 @@ private:
     std::string ConvertInternalFormatToString( GLenum format );
 
     bool m_ScreenshotScheduled;
+    bool m_ScreenshotRequested;
     bool m_CaptureInProgress;
+    ScreenCapture m_ScreenCapture;
+    int m_NextScreenshotIndex;
+    int m_CaptureIndex;
+    int m_CaptureFrame;
+    size_t m_CaptureDroppedAtStart;
 
     GLuint m_ScreenWidth;
     GLuint m_ScreenHeight;
@@ -148,6 +156,7 @@ private:
     glm::mat4 m_ProjectionMatrix;
 
     unsigned int m_DrawCallCount;
+    PerformanceCounter* m_pDrawCallCounter;
     BlendMode m_BlendMode;
     InputCallbackToken m_InputCallbackScreenshot;
     InputCallbackToken m_InputCallbackCapture;
@@ -174,16 +183,6 @@ inline bool RenderSystem::IsScreenshotScheduled() const
     return m_ScreenshotScheduled;
 }
 
-inline void RenderSystem::BeginCapture()
-{
-    m_CaptureInProgress = true;
-}
-
-inline void RenderSystem::EndCapture()
-{
-    m_CaptureInProgress = false;
-}
-
 inline bool RenderSystem::IsCaptureInProgress() const
 {
     return m_CaptureInProgress;
@@ -207,6 +206,7 @@ inline unsigned int RenderSystem::GetDrawCallCount() const
 inline void RenderSystem::IncreaseDrawCallCount()
 {
     m_DrawCallCount++;
+    m_pDrawCallCounter->Increment();
 }
 
 inline void RenderSystem::ResetDrawCallCount()
@@ -19,6 +19,7 @@
 
 #include "genesis.h"
 #include "memory.h"
+#include "performancecounters.h"
 #include "resources/forgelistener.hpp"
 #include "resources/resourcefont.h"
 #include "resources/resourceimage.h"
@@ -31,6 +32,7 @@
 #include <fstream>
 #include <iostream>
 #include <log.hpp>
+#include <memorytracker.hpp>
 #include <string>
 
 namespace Genesis
@@ -96,6 +98,12 @@ ResourceManager::~ResourceManager()
     {
         delete it2->second;
     }
+
+    for (auto& pair : mPendingPreloads)
+    {
+        pair.second.preloaded.wait();
+        delete pair.second.pResource;
+    }
 }
 
 void ResourceManager::RegisterExtension(const std::string& extension, ResourceFactoryFunction& func)
@@ -111,6 +119,12 @@ void ResourceManager::RegisterExtension(const std::string& extension, ResourceFa
 
 TaskStatus ResourceManager::Update(float delta)
 {
+    static PerformanceCounter* sLoadedResources = PerformanceCounters::Register("Resources/Loaded", PerformanceCounterType::Gauge);
+    {
+        std::lock_guard<std::recursive_mutex> lock(mResourcesMutex);
+        sLoadedResources->Set(static_cast<int64_t>(mResources.size()));
+    }
+
     if (m_pForgeListener)
     {
         m_pForgeListener->Update();
@@ -132,6 +146,9 @@ bool ResourceManager::CanLoadResource(const Filename& filename)
 // it will block the main thread until the resource has finished loading.
 ResourceGeneric* ResourceManager::GetResource(const Filename& filename)
 {
+    GENESIS_MEMORY_SCOPE(Resources);
+    std::lock_guard<std::recursive_mutex> lock(mResourcesMutex);
+
     // Check if we already have this resource loaded
     ResourceMap::iterator resourceMapIter = mResources.find(filename.GetFullPath());
     if (resourceMapIter != mResources.end())
@@ -139,6 +156,71 @@ ResourceGeneric* ResourceManager::GetResource(const Filename& filename)
         return resourceMapIter->second;
     }
 
+    // If the resource has been preloaded, only Load() is left to do. The preload might still
+    // be in progress on another thread, but it doesn't need the lock to finish.
+    PendingPreloadMap::iterator preloadIter = mPendingPreloads.find(filename.GetFullPath());
+    if (preloadIter != mPendingPreloads.end())
+    {
+        ResourceGeneric* pResource = preloadIter->second.pResource;
+        std::shared_future<void> preloaded = preloadIter->second.preloaded;
+        mPendingPreloads.erase(preloadIter);
+        mResources[filename.GetFullPath()] = pResource;
+
+        preloaded.wait();
+        pResource->Load();
+
+        SDL_assert(pResource->GetState() == ResourceState::Loaded);
+        return pResource;
+    }
+
+    ResourceGeneric* pResource = CreateResource(filename);
+    if (pResource == nullptr)
+    {
+        return nullptr;
+    }
+
+    mResources[filename.GetFullPath()] = pResource;
+
+    static PerformanceCounter* sSynchronousLoads = PerformanceCounters::Register("Resources/Synchronous loads", PerformanceCounterType::Counter);
+    sSynchronousLoads->Increment();
+
+    pResource->Preload();
+    pResource->Load();
+
+    SDL_assert(pResource->GetState() == ResourceState::Loaded);
+    return pResource;
+}
+
+void ResourceManager::Preload(const Filename& filename)
+{
+    GENESIS_MEMORY_SCOPE(Resources);
+    ResourceGeneric* pResource = nullptr;
+    std::promise<void> preloadedPromise;
+
+    {
+        std::lock_guard<std::recursive_mutex> lock(mResourcesMutex);
+        const std::string& path = filename.GetFullPath();
+        if (mResources.find(path) != mResources.end() || mPendingPreloads.find(path) != mPendingPreloads.end())
+        {
+            return;
+        }
+
+        pResource = CreateResource(filename);
+        if (pResource == nullptr)
+        {
+            return;
+        }
+
+        mPendingPreloads[path] = {pResource, preloadedPromise.get_future().share()};
+    }
+
+    // The I/O is done without holding the lock, so other resources can still be retrieved in the meantime.
+    pResource->Preload();
+    preloadedPromise.set_value();
+}
+
+ResourceGeneric* ResourceManager::CreateResource(const Filename& filename)
+{
     const std::string& extension = filename.GetExtension();
     ExtensionMap::iterator extensionIter = mRegisteredExtensions.find(extension);
     if (extensionIter == mRegisteredExtensions.end())
@@ -150,13 +232,6 @@ ResourceGeneric* ResourceManager::GetResource(const Filename& filename)
     ExtensionData* extensionData = extensionIter->second;
     ResourceGeneric* pResource = extensionData->GetFactoryFunction()(filename);
     SDL_assert(pResource != nullptr);
-
-    mResources[filename.GetFullPath()] = pResource;
-
-    pResource->Preload();
-    pResource->Load();
-
-    SDL_assert(pResource->GetState() == ResourceState::Loaded);
     return pResource;
 }
 
@@ -22,7 +22,9 @@
 #include "taskmanager.h"
 
 #include <functional>
+#include <future>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 
@@ -82,12 +84,28 @@ public:
     bool CanLoadResource(const Filename& filename);
 
     // Retrieves a resource. This is a blocking operation.
+    // Safe to call from other threads, as long as the resource's Load() doesn't need a GL context.
     ResourceGeneric* GetResource(const Filename& filename);
     template <typename T> T GetResource(const Filename& filename) { return static_cast<T>(GetResource(filename)); }
 
+    // Performs a resource's disk I/O ahead of time, blocking the calling thread while it does so.
+    // Safe to call from other threads: GetResource() then only has to run Load() on the main thread.
+    void Preload(const Filename& filename);
+
 private:
+    struct PendingPreload
+    {
+        ResourceGeneric* pResource;
+        std::shared_future<void> preloaded;
+    };
+    using PendingPreloadMap = std::unordered_map<std::string, PendingPreload>;
+
+    ResourceGeneric* CreateResource(const Filename& filename);
+
     ExtensionMap mRegisteredExtensions;
     ResourceMap mResources;
+    PendingPreloadMap mPendingPreloads; // Preloaded resources which haven't been requested through GetResource() yet.
+    std::recursive_mutex mResourcesMutex; // Recursive, as loading a resource can request other resources.
     std::unique_ptr<ForgeListener> m_pForgeListener;
 };
 
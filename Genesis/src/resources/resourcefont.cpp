@@ -1,6 +1,7 @@
 #include "resourcefont.h"
 
 #include "../genesis.h"
+#include "../performancecounters.h"
 #include "../rendersystem.h"
 #include "../vertexbuffer.h"
 #include "rendersystem.fwd.h"
@@ -15,23 +16,19 @@
 namespace Genesis
 {
 
+// Maximum number of glyph runs kept per font. Most of the text on screen is static, so this comfortably
+// covers a busy screen without holding on to every string which was ever drawn.
+static const size_t sGlyphRunCacheSize = 256;
+
 ResourceFont::ResourceFont(const Filename& filename)
     : ResourceGeneric(filename)
     , mLineHeight(0.0f)
     , mPage(0)
 {
+    mCharIndices.fill(-1);
 }
 
-ResourceFont::~ResourceFont()
-{
-    if (!mCharList.empty())
-    {
-        for (auto& fontChar : mCharList)
-        {
-            delete fontChar;
-        }
-    }
-}
+ResourceFont::~ResourceFont() {}
 
 bool ResourceFont::Load()
 {
@@ -76,14 +73,22 @@ bool ResourceFont::LoadFontFile(const std::string& filename)
 
                 for (tinyxml2::XMLElement* elemChar = elemEntry->FirstChildElement(); elemChar; elemChar = elemChar->NextSiblingElement())
                 {
-                    FontChar* fontChar = new FontChar();
-                    fontChar->x = (float)atof(elemChar->Attribute("x"));
-                    fontChar->y = (float)atof(elemChar->Attribute("y"));
-                    fontChar->width = (float)atof(elemChar->Attribute("width"));
-                    fontChar->height = (float)atof(elemChar->Attribute("height"));
-                    fontChar->xoffset = (float)atof(elemChar->Attribute("xoffset"));
-                    fontChar->yoffset = (float)atof(elemChar->Attribute("yoffset"));
-                    fontChar->xadvance = (float)atof(elemChar->Attribute("xadvance"));
+                    // Characters are looked up by their id, rather than assuming the file lists every character from ' ' onwards.
+                    const int id = atoi(elemChar->Attribute("id"));
+                    if (id < 0 || id >= static_cast<int>(mCharIndices.size()))
+                    {
+                        continue;
+                    }
+
+                    FontChar fontChar;
+                    fontChar.x = (float)atof(elemChar->Attribute("x"));
+                    fontChar.y = (float)atof(elemChar->Attribute("y"));
+                    fontChar.width = (float)atof(elemChar->Attribute("width"));
+                    fontChar.height = (float)atof(elemChar->Attribute("height"));
+                    fontChar.xoffset = (float)atof(elemChar->Attribute("xoffset"));
+                    fontChar.yoffset = (float)atof(elemChar->Attribute("yoffset"));
+                    fontChar.xadvance = (float)atof(elemChar->Attribute("xadvance"));
+                    mCharIndices[id] = static_cast<int>(mCharList.size());
                     mCharList.push_back(fontChar);
                 }
             }
@@ -99,20 +104,17 @@ void ResourceFont::BuildLists()
 
     mCharRenderDataArray.reserve(mCharList.size());
 
-    FontCharList::const_iterator itEnd = mCharList.end();
-    for (FontCharList::const_iterator it = mCharList.begin(); it != itEnd; it++)
+    for (const FontChar& fontChar : mCharList)
     {
-        FontChar* fontChar = (*it);
-
-        const float u1 = fontChar->x / textureWidth;
-        const float v1 = fontChar->y / textureHeight;
-        const float u2 = (fontChar->x + fontChar->width) / textureWidth;
-        const float v2 = (fontChar->y + fontChar->height) / textureHeight;
+        const float u1 = fontChar.x / textureWidth;
+        const float v1 = fontChar.y / textureHeight;
+        const float u2 = (fontChar.x + fontChar.width) / textureWidth;
+        const float v2 = (fontChar.y + fontChar.height) / textureHeight;
 
-        const float x1 = fontChar->xoffset;
-        const float y1 = fontChar->yoffset;
-        const float x2 = fontChar->width + fontChar->xoffset;
-        const float y2 = fontChar->height + fontChar->yoffset;
+        const float x1 = fontChar.xoffset;
+        const float y1 = fontChar.yoffset;
+        const float x2 = fontChar.width + fontChar.xoffset;
+        const float y2 = fontChar.height + fontChar.yoffset;
 
         FontCharRenderData renderData;
         renderData.position[0] = glm::vec3(x1, y1, 0.0f);
@@ -127,60 +129,115 @@ void ResourceFont::BuildLists()
     }
 }
 
-unsigned int ResourceFont::PopulateVertexBuffer(VertexBuffer& vertexBuffer, float x, float y, const std::string& text, float lineSpacing)
+GlyphRunSharedPtr ResourceFont::GetGlyphRun(const std::string& text, float lineSpacing)
 {
-    if (text.empty())
+    // Shared by every font, as it's the overall hit rate which says whether the cache is large enough.
+    static PerformanceCounter* sCacheHits = PerformanceCounters::Register("Text/Glyph run cache hits", PerformanceCounterType::Counter);
+    static PerformanceCounter* sCacheMisses = PerformanceCounters::Register("Text/Glyph run cache misses", PerformanceCounterType::Counter);
+
+    GlyphRunKey key{text, lineSpacing};
+    GlyphRunMap::iterator it = mGlyphRunMap.find(key);
+    if (it != mGlyphRunMap.end())
     {
-        return 0;
+        mGlyphRuns.splice(mGlyphRuns.begin(), mGlyphRuns, it->second);
+        sCacheHits->Increment();
+        return it->second->second;
+    }
+
+    sCacheMisses->Increment();
+    GlyphRunSharedPtr pGlyphRun = BuildGlyphRun(text, lineSpacing);
+    mGlyphRuns.emplace_front(key, pGlyphRun);
+    mGlyphRunMap[std::move(key)] = mGlyphRuns.begin();
+
+    if (mGlyphRuns.size() > sGlyphRunCacheSize)
+    {
+        mGlyphRunMap.erase(mGlyphRuns.back().first);
+        mGlyphRuns.pop_back();
     }
 
-    const size_t textLength = text.length();
-    PositionData positionData;
-    UVData uvData;
-    positionData.reserve(textLength * 6);
-    uvData.reserve(textLength * 6);
+    return pGlyphRun;
+}
 
-    float xtranslate = x;
-    float ytranslate = y;
+GlyphRunSharedPtr ResourceFont::BuildGlyphRun(const std::string& text, float lineSpacing) const
+{
+    std::shared_ptr<GlyphRun> pGlyphRun = std::make_shared<GlyphRun>();
+    pGlyphRun->positions.reserve(text.length() * 6);
+    pGlyphRun->uvs.reserve(text.length() * 6);
 
-    unsigned int vertexCount = 0;
-    for (size_t i = 0; i < textLength; i++)
+    float xtranslate = 0.0f;
+    float ytranslate = 0.0f;
+    for (char c : text)
     {
-        if (text[i] == '\n')
+        if (c == '\n')
         {
-            xtranslate = x;
+            xtranslate = 0.0f;
             ytranslate += floorf(mLineHeight * lineSpacing);
             continue;
         }
 
-        int fontCharPos = text[i] - 32;
-        if (fontCharPos >= (int)mCharList.size() || fontCharPos < 0)
+        const int charIndex = GetCharIndex(c);
+        if (charIndex < 0)
             continue;
 
-        const FontCharRenderData& renderData = mCharRenderDataArray[fontCharPos];
+        const FontCharRenderData& renderData = mCharRenderDataArray[charIndex];
 
         const glm::vec3 vtranslate(xtranslate, ytranslate, 0.0f);
-        positionData.push_back(renderData.position[0] + vtranslate);
-        positionData.push_back(renderData.position[1] + vtranslate);
-        positionData.push_back(renderData.position[2] + vtranslate);
-        positionData.push_back(renderData.position[0] + vtranslate);
-        positionData.push_back(renderData.position[2] + vtranslate);
-        positionData.push_back(renderData.position[3] + vtranslate);
-
-        uvData.push_back(renderData.uv[0]);
-        uvData.push_back(renderData.uv[1]);
-        uvData.push_back(renderData.uv[2]);
-        uvData.push_back(renderData.uv[0]);
-        uvData.push_back(renderData.uv[2]);
-        uvData.push_back(renderData.uv[3]);
-
-        vertexCount += 6;
-
-        xtranslate += mCharList[fontCharPos]->xadvance;
+        pGlyphRun->positions.push_back(renderData.position[0] + vtranslate);
+        pGlyphRun->positions.push_back(renderData.position[1] + vtranslate);
+        pGlyphRun->positions.push_back(renderData.position[2] + vtranslate);
+        pGlyphRun->positions.push_back(renderData.position[0] + vtranslate);
+        pGlyphRun->positions.push_back(renderData.position[2] + vtranslate);
+        pGlyphRun->positions.push_back(renderData.position[3] + vtranslate);
+
+        pGlyphRun->uvs.push_back(renderData.uv[0]);
+        pGlyphRun->uvs.push_back(renderData.uv[1]);
+        pGlyphRun->uvs.push_back(renderData.uv[2]);
+        pGlyphRun->uvs.push_back(renderData.uv[0]);
+        pGlyphRun->uvs.push_back(renderData.uv[2]);
+        pGlyphRun->uvs.push_back(renderData.uv[3]);
+
+        xtranslate += mCharList[charIndex].xadvance;
     }
 
-    vertexBuffer.CopyPositions(positionData);
-    vertexBuffer.CopyUVs(uvData);
-    return vertexCount;
+    return pGlyphRun;
 }
+
+unsigned int ResourceFont::PopulateVertexBuffer(VertexBuffer& vertexBuffer, float x, float y, const GlyphRun& glyphRun)
+{
+    const size_t vertexCount = glyphRun.positions.size();
+    if (vertexCount == 0)
+    {
+        return 0;
+    }
+
+    mTranslatedPositions.resize(vertexCount);
+    const glm::vec3 vtranslate(x, y, 0.0f);
+    for (size_t i = 0; i < vertexCount; ++i)
+    {
+        mTranslatedPositions[i] = glyphRun.positions[i] + vtranslate;
+    }
+
+    vertexBuffer.CopyPositions(mTranslatedPositions, vertexCount);
+    vertexBuffer.CopyUVs(glyphRun.uvs, vertexCount);
+    return static_cast<unsigned int>(vertexCount);
+}
+
+unsigned int ResourceFont::PopulateVertexBuffer(VertexBuffer& vertexBuffer, float x, float y, const std::string& text, float lineSpacing)
+{
+    if (text.empty())
+    {
+        return 0;
+    }
+
+    GlyphRunSharedPtr pGlyphRun = GetGlyphRun(text, lineSpacing);
+    return PopulateVertexBuffer(vertexBuffer, x, y, *pGlyphRun);
+}
+
+size_t ResourceFont::GlyphRunKeyHashFn::operator()(const GlyphRunKey& key) const
+{
+    size_t h = std::hash<std::string>()(key.text);
+    h ^= std::hash<float>()(key.lineSpacing) + 0x9e3779b9 + (h << 6) + (h >> 2);
+    return h;
+}
+
 } // namespace Genesis
\ No newline at end of file
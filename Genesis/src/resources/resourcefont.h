@@ -25,17 +25,30 @@
 #include <externalheadersend.hpp>
 // clang-format on
 
+#include <array>
+#include <list>
+#include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "resources/resourcegeneric.h"
 #include "resourcemanager.h"
 #include "rendersystem.fwd.h"
+#include "vertexbuffer.h"
 
 namespace Genesis
 {
 class ResourceImage;
-class VertexBuffer;
+
+// The laid out glyphs of a string, relative to the string's origin.
+// A run only has to be translated to draw the string somewhere else.
+struct GlyphRun
+{
+    PositionData positions;
+    UVData uvs;
+};
+using GlyphRunSharedPtr = std::shared_ptr<const GlyphRun>;
 
 class ResourceFont : public ResourceGeneric
 {
@@ -45,6 +58,12 @@ public:
     virtual ResourceType GetType() const override;
     virtual bool Load() override;
 
+    // Glyph runs are kept in a small LRU cache, so laying out the same string again is just a lookup.
+    // Any wrapping must have been applied to the text already (see Gui::Text), so the text and line
+    // spacing are all that is needed to identify a run. The run remains valid even if it is evicted.
+    GlyphRunSharedPtr GetGlyphRun(const std::string& text, float lineSpacing);
+
+    unsigned int PopulateVertexBuffer(VertexBuffer& vertexBuffer, float x, float y, const GlyphRun& glyphRun);
     unsigned int PopulateVertexBuffer(VertexBuffer& vertexBuffer, float x, float y, const std::string& text, float lineSpacing);
     ResourceImage* GetPage() const;
     float GetTextLength(const std::string& text) const;
@@ -53,6 +72,8 @@ public:
 private:
     bool LoadFontFile(const std::string& filename);
     void BuildLists();
+    int GetCharIndex(char c) const;
+    GlyphRunSharedPtr BuildGlyphRun(const std::string& text, float lineSpacing) const;
 
     struct FontChar
     {
@@ -71,25 +92,50 @@ private:
         glm::vec2 uv[4];
     };
 
-    typedef std::vector<FontChar*> FontCharList;
+    struct GlyphRunKey
+    {
+        std::string text;
+        float lineSpacing;
+
+        bool operator==(const GlyphRunKey& other) const { return lineSpacing == other.lineSpacing && text == other.text; }
+    };
+
+    struct GlyphRunKeyHashFn
+    {
+        size_t operator()(const GlyphRunKey& key) const;
+    };
+
+    using GlyphRunList = std::list<std::pair<GlyphRunKey, GlyphRunSharedPtr>>; // Most recently used first.
+    using GlyphRunMap = std::unordered_map<GlyphRunKey, GlyphRunList::iterator, GlyphRunKeyHashFn>;
+
+    typedef std::vector<FontChar> FontCharList;
     typedef std::vector<FontCharRenderData> FontCharRenderDataArray;
     FontCharList mCharList;
     FontCharRenderDataArray mCharRenderDataArray;
+    std::array<int, 256> mCharIndices; // Index into mCharList for each character, or -1 if the font doesn't have it.
     float mLineHeight;
     ResourceImage* mPage;
+
+    GlyphRunList mGlyphRuns;
+    GlyphRunMap mGlyphRunMap;
+    PositionData mTranslatedPositions; // Scratch space for PopulateVertexBuffer(), to avoid allocating every call.
 };
 
+inline int ResourceFont::GetCharIndex(char c) const
+{
+    return mCharIndices[static_cast<unsigned char>(c)];
+}
+
 inline float ResourceFont::GetTextLength(const std::string& text) const
 {
     float len = 0.0f;
-    size_t charListSize = (int)mCharList.size();
-    size_t s = text.length();
-    for (size_t i = 0; i < s; i++)
+    for (char c : text)
     {
-        int fontCharPos = text[i] - 32;
-        if (fontCharPos >= charListSize || fontCharPos < 0)
-            continue;
-        len += mCharList[fontCharPos]->xadvance;
+        const int charIndex = GetCharIndex(c);
+        if (charIndex >= 0)
+        {
+            len += mCharList[charIndex].xadvance;
+        }
     }
     return len;
 }
@@ -20,6 +20,7 @@
 #include "../genesis.h"
 #include "../rendersystem.h"
 #include "render/viewport.hpp"
+#include "scene.h"
 #include "sceneobject.h"
 
 #include <log.hpp>
@@ -38,12 +39,14 @@ Layer::Layer( uint32_t depth, bool isBackground )
 Layer::~Layer()
 {
     // Remove any remaining objects from the layer
-    LayerObjectList::iterator itEnd = mObjectList.end();
-    for ( LayerObjectList::iterator it = mObjectList.begin(); it != itEnd; ++it )
+    for ( LayerObjectList* pObjects : { &mOpaqueObjects, &mTransparentObjects } )
     {
-        if ( it->hasOwnership )
+        for ( LayerObject& layerObject : *pObjects )
         {
-            delete it->pSceneObject;
+            if ( layerObject.hasOwnership )
+            {
+                delete layerObject.pSceneObject;
+            }
         }
     }
 }
@@ -54,38 +57,106 @@ void Layer::Update( float delta )
     if ( IsMarkedForDeletion() )
         return;
 
+    UpdateOpaqueObjects( delta );
+    UpdateTransparentObjects( delta );
+    FlushRemovals();
+}
+
+// Objects can be added to the layer while it is being updated, so the arrays
+// are indexed rather than iterated. Removals are deferred, so nothing moves.
+// Opaque objects added during the update are only updated from the next frame,
+// while transparent ones are updated straight away.
+void Layer::UpdateOpaqueObjects( float delta )
+{
+    for ( size_t i = mOpaqueObjects.size(); i > 0; --i )
     {
-        LayerObjectList::const_iterator itEnd = mObjectList.end();
-        for ( LayerObjectList::const_iterator it = mObjectList.begin(); it != itEnd; ++it )
-        {
-            it->pSceneObject->Update( delta );
-        }
+        mOpaqueObjects[ i - 1 ].pSceneObject->Update( delta );
     }
+}
 
-    if ( mToRemove.empty() == false )
+void Layer::UpdateTransparentObjects( float delta )
+{
+    for ( size_t i = 0; i < mTransparentObjects.size(); ++i )
     {
-        SceneObjectList::iterator itEnd = mToRemove.end();
-        for ( SceneObjectList::iterator it = mToRemove.begin(); it != itEnd; ++it )
+        mTransparentObjects[ i ].pSceneObject->Update( delta );
+    }
+}
+
+void Layer::FlushRemovals()
+{
+    // Removing an object can cause other objects to be removed, so we keep going until the list is empty.
+    while ( mToRemove.empty() == false )
+    {
+        SceneObjectList toRemove;
+        toRemove.swap( mToRemove );
+
+        // The removed objects are cleared from the arrays first, which are then compacted
+        // before any object is deleted, so the layer is consistent if a destructor uses it.
+        std::vector<LayerObject> removed;
+        removed.reserve( toRemove.size() );
+        bool opaqueRemoved = false;
+        bool transparentRemoved = false;
+        for ( SceneObject* pSceneObject : toRemove )
+        {
+            auto it = mSlotLookup.find( pSceneObject );
+            if ( it == mSlotLookup.end() )
+            {
+                continue; // Removed more than once.
+            }
+
+            Slot& slot = mSlots[ it->second ];
+            LayerObject& layerObject = ( slot.transparent ? mTransparentObjects : mOpaqueObjects )[ slot.index ];
+            removed.push_back( layerObject );
+            layerObject.pSceneObject = nullptr;
+            opaqueRemoved |= !slot.transparent;
+            transparentRemoved |= slot.transparent;
+
+            slot.alive = false;
+            slot.generation++;
+            mFreeSlots.push_back( it->second );
+            mSlotLookup.erase( it );
+        }
+
+        if ( opaqueRemoved )
+        {
+            CompactDenseArray( mOpaqueObjects );
+        }
+        if ( transparentRemoved )
         {
-            LayerObjectList::iterator it2End = mObjectList.end();
-            for ( LayerObjectList::iterator it2 = mObjectList.begin(); it2 != it2End; ++it2 )
+            CompactDenseArray( mTransparentObjects );
+        }
+
+        for ( const LayerObject& layerObject : removed )
+        {
+            if ( m_pScene != nullptr )
             {
-                if ( it2->pSceneObject == *it )
-                {
-                    it2->pSceneObject->SetScene( nullptr );
-                    if ( it2->hasOwnership )
-                    {
-                        delete *it;
-                    }
-                    mObjectList.erase( it2 );
-                    break;
-                }
+                m_pScene->Unregister( layerObject.pSceneObject );
+            }
+
+            layerObject.pSceneObject->SetScene( nullptr );
+            if ( layerObject.hasOwnership )
+            {
+                delete layerObject.pSceneObject;
             }
         }
-        mToRemove.clear();
     }
 }
 
+// Removes the cleared entries from the array, keeping the remaining objects in the same order.
+void Layer::CompactDenseArray( LayerObjectList& objects )
+{
+    uint32_t count = 0;
+    for ( const LayerObject& layerObject : objects )
+    {
+        if ( layerObject.pSceneObject != nullptr )
+        {
+            mSlots[ layerObject.slot ].index = count;
+            objects[ count++ ] = layerObject;
+        }
+    }
+    objects.resize( count );
+}
+
 // Render all objects in this layer
 void Layer::Render( Viewport* pViewport )
 {
@@ -107,43 +178,70 @@ void Layer::Render( Viewport* pViewport )
         pRenderSystem->ViewPerspective( width, height, pScene, pViewport->GetCamera() );
     }
 
+    // Transparent objects are rendered after all the opaque ones.
     SceneCameraSharedPtr pCamera = pViewport->GetCamera();
-    LayerObjectList::const_iterator itEnd = mObjectList.end();
-    for ( LayerObjectList::const_iterator it = mObjectList.begin(); it != itEnd; ++it )
+    for ( LayerObjectList::const_reverse_iterator it = mOpaqueObjects.crbegin(); it != mOpaqueObjects.crend(); ++it )
     {
-        if ( it->pSceneObject->IsTerminating() == false )
-        {
-            it->pSceneObject->Render( pCamera );
-        }
+        RenderObject( *it, pCamera );
+    }
+    for ( const LayerObject& layerObject : mTransparentObjects )
+    {
+        RenderObject( layerObject, pCamera );
+    }
+}
+
+void Layer::RenderObject( const LayerObject& layerObject, const SceneCameraSharedPtr& pCamera )
+{
+    if ( layerObject.pSceneObject->IsTerminating() == false )
+    {
+        layerObject.pSceneObject->Render( pCamera );
     }
 }
 
-void Layer::AddSceneObject( SceneObject* pObject, bool hasOwnership /* = true */ )
+SceneObjectHandle Layer::AddSceneObject( SceneObject* pObject, bool hasOwnership /* = true */ )
 {
     SDL_assert( pObject != nullptr );
 
-#ifdef _DEBUG
-    for ( auto& pLayerObject : mObjectList )
+    auto it = mSlotLookup.find( pObject );
+    if ( it != mSlotLookup.end() )
     {
-        if ( pLayerObject.pSceneObject == pObject )
-        {
-            Log::Warning() << "Object has already been added to the layer!";
-        }
+        Log::Warning() << "Object has already been added to the layer!";
+        return SceneObjectHandle{ it->second, mSlots[ it->second ].generation };
     }
-#endif
 
-    LayerObject obj;
-    obj.pSceneObject = pObject;
-    obj.pSceneObject->SetScene( GetScene() );
-    obj.hasOwnership = hasOwnership;
-    if ( pObject->GetRenderHint() == RenderHint::Transparent )
+    uint32_t slotIndex;
+    if ( mFreeSlots.empty() )
     {
-        mObjectList.push_back( obj );
+        slotIndex = static_cast<uint32_t>( mSlots.size() );
+        mSlots.push_back( Slot{ 0, 0, false, false } );
     }
     else
     {
-        mObjectList.push_front( obj );
+        slotIndex = mFreeSlots.back();
+        mFreeSlots.pop_back();
     }
+
+    const bool transparent = ( pObject->GetRenderHint() == RenderHint::Transparent );
+    LayerObjectList& objects = transparent ? mTransparentObjects : mOpaqueObjects;
+    Slot& slot = mSlots[ slotIndex ];
+    slot.index = static_cast<uint32_t>( objects.size() );
+    slot.transparent = transparent;
+    slot.alive = true;
+    mSlotLookup[ pObject ] = slotIndex;
+
+    LayerObject obj;
+    obj.pSceneObject = pObject;
+    obj.hasOwnership = hasOwnership;
+    obj.slot = slotIndex;
+    objects.push_back( obj );
+
+    pObject->SetScene( GetScene() );
+    if ( m_pScene != nullptr )
+    {
+        m_pScene->OnObjectAdded( pObject );
+    }
+
+    return SceneObjectHandle{ slotIndex, slot.generation };
 }
 
 // We can't remove the objects immediately, since they may be
@@ -154,4 +252,30 @@ void Layer::RemoveSceneObject( SceneObject* object )
     object->SetTerminating();
     mToRemove.push_back( object );
 }
-} // namespace Genesis
\ No newline at end of file
+
+void Layer::RemoveSceneObject( const SceneObjectHandle& handle )
+{
+    SceneObject* pSceneObject = GetSceneObject( handle );
+    if ( pSceneObject != nullptr )
+    {
+        RemoveSceneObject( pSceneObject );
+    }
+}
+
+SceneObject* Layer::GetSceneObject( const SceneObjectHandle& handle ) const
+{
+    if ( handle.slot >= mSlots.size() )
+    {
+        return nullptr;
+    }
+
+    const Slot& slot = mSlots[ handle.slot ];
+    if ( slot.alive == false || slot.generation != handle.generation )
+    {
+        return nullptr;
+    }
+
+    return ( slot.transparent ? mTransparentObjects : mOpaqueObjects )[ slot.index ].pSceneObject;
+}
+
+} // namespace Genesis
@@ -21,22 +21,45 @@
 #include "rendersystem.fwd.h"
 
 #include <SDL.h>
-#include <list>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
 
 namespace Genesis
 {
 
 class Scene;
 class SceneObject;
+GENESIS_DECLARE_SMART_PTR(SceneCamera);
 
 struct LayerObject
 {
     SceneObject* pSceneObject;
     bool hasOwnership;
+    uint32_t slot;
 };
 
-typedef std::list<LayerObject> LayerObjectList;
-typedef std::list<SceneObject*> SceneObjectList;
+typedef std::vector<LayerObject> LayerObjectList;
+typedef std::vector<SceneObject*> SceneObjectList;
+
+// Identifies an object in a layer. A handle to an object which has since been
+// removed will not resolve, even if its slot has been reused.
+struct SceneObjectHandle
+{
+    uint32_t slot = 0;
+    uint32_t generation = 0;
+};
+
+//---------------------------------------------------------------
+// Layer
+// Objects are kept in two dense arrays, one for opaque and one for
+// transparent objects, so the transparent ones can be rendered last.
+// Opaque objects are updated and rendered newest first, transparent
+// ones in the order they were added, which is also their blend order.
+// A slot map provides stable handles into the arrays. Removals are
+// deferred until the end of Layer::Update() and then done in a batch,
+// compacting each array in a single pass which keeps its order.
+//---------------------------------------------------------------
 
 class Layer
 {
@@ -45,18 +68,40 @@ public:
     ~Layer();
     void Update(float delta);
     void Render(Viewport* pViewport);
-    void AddSceneObject(SceneObject* object, bool hasOwnership = true);
+    SceneObjectHandle AddSceneObject(SceneObject* object, bool hasOwnership = true);
     void RemoveSceneObject(SceneObject* object);
+    void RemoveSceneObject(const SceneObjectHandle& handle);
+    SceneObject* GetSceneObject(const SceneObjectHandle& handle) const;
+    bool Contains(SceneObject* object) const;
     uint32_t GetLayerDepth() const;
     bool IsBackground() const;
     bool IsMarkedForDeletion() const;
     void MarkForDeletion();
-    const LayerObjectList& GetSceneObjects() const;
+    const LayerObjectList& GetOpaqueSceneObjects() const; // Oldest first, the reverse of the order they are updated and rendered in.
+    const LayerObjectList& GetTransparentSceneObjects() const;
     void SetScene(Scene* pScene);
     Scene* GetScene() const;
 
 private:
-    LayerObjectList mObjectList;
+    struct Slot
+    {
+        uint32_t generation;
+        uint32_t index; // Index into the dense array the object is in.
+        bool transparent;
+        bool alive;
+    };
+
+    void UpdateOpaqueObjects(float delta);
+    void UpdateTransparentObjects(float delta);
+    void RenderObject(const LayerObject& layerObject, const SceneCameraSharedPtr& pCamera);
+    void FlushRemovals();
+    void CompactDenseArray(LayerObjectList& objects);
+
+    LayerObjectList mOpaqueObjects;
+    LayerObjectList mTransparentObjects;
+    std::vector<Slot> mSlots;
+    std::vector<uint32_t> mFreeSlots;
+    std::unordered_map<SceneObject*, uint32_t> mSlotLookup;
     SceneObjectList mToRemove;
     uint32_t mDepth;
     bool mIsBackground;
@@ -82,9 +127,19 @@ inline void Layer::MarkForDeletion()
     mMarkedForDeletion = true;
 }
 
-inline const LayerObjectList& Layer::GetSceneObjects() const 
+inline const LayerObjectList& Layer::GetOpaqueSceneObjects() const
+{
+    return mOpaqueObjects;
+}
+
+inline const LayerObjectList& Layer::GetTransparentSceneObjects() const
+{
+    return mTransparentObjects;
+}
+
+inline bool Layer::Contains(SceneObject* object) const
 {
-    return mObjectList;
+    return mSlotLookup.find(object) != mSlotLookup.end();
 }
 
 inline void Layer::SetScene(Scene* pScene)
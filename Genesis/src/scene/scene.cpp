@@ -5,6 +5,8 @@
 #include "genesis.h"
 #include "taskmanager.h"
 
+#include <algorithm>
+
 namespace Genesis
 {
 
@@ -13,9 +15,13 @@ namespace Genesis
 //---------------------------------------------------------------
 
 Scene::Scene()
+    : m_FindSearchCount(0)
 {
     mMask = 0xFFFFFFFF;
-    FrameWork::GetTaskManager()->AddTask("Scene", this, (TaskFunc)&Scene::Update, TaskPriority::GameLogic);
+    if (FrameWork::GetTaskManager())
+    {
+        FrameWork::GetTaskManager()->AddTask("Scene", this, (TaskFunc)&Scene::Update, TaskPriority::GameLogic);
+    }
 }
 
 Scene::~Scene()
@@ -47,19 +53,26 @@ void Scene::Render(Viewport* pViewport)
         }
     }
 
+    if (mLayersToDelete.empty() == false)
+    {
+        m_FindCache.clear();
+    }
+
     for (auto& pLayerToDelete : mLayersToDelete)
     {
-        for (LayerList::iterator it = mLayerList.begin(), itEnd = mLayerList.end(); it != itEnd;)
+        for (Registry::iterator it = m_Registry.begin(); it != m_Registry.end();)
         {
-            if (*it == pLayerToDelete)
+            if (pLayerToDelete->Contains(it->second))
             {
-                it = mLayerList.erase(it);
+                it = m_Registry.erase(it);
             }
             else
             {
                 it++;
             }
         }
+
+        mLayerList.erase(std::remove(mLayerList.begin(), mLayerList.end(), pLayerToDelete), mLayerList.end());
     }
     mLayersToDelete.clear();
 }
@@ -80,6 +93,49 @@ LayerSharedPtr Scene::AddLayer(uint32_t depth, bool isBackground /* = false */)
     return pLayer;
 }
 
+// A cached Find<T>() result might no longer be the first match if the new object is also a T.
+void Scene::OnObjectAdded(SceneObject* pObject)
+{
+    for (FindCache::iterator it = m_FindCache.begin(); it != m_FindCache.end();)
+    {
+        if (it->second.pIsOfType(pObject))
+        {
+            it = m_FindCache.erase(it);
+        }
+        else
+        {
+            it++;
+        }
+    }
+}
+
+void Scene::Unregister(SceneObject* pObject)
+{
+    for (FindCache::iterator it = m_FindCache.begin(); it != m_FindCache.end();)
+    {
+        if (it->second.pObject == pObject)
+        {
+            it = m_FindCache.erase(it);
+        }
+        else
+        {
+            it++;
+        }
+    }
+
+    for (Registry::iterator it = m_Registry.begin(); it != m_Registry.end();)
+    {
+        if (it->second == pObject)
+        {
+            it = m_Registry.erase(it);
+        }
+        else
+        {
+            it++;
+        }
+    }
+}
+
 void Scene::RemoveLayer(uint32_t depth)
 {
     for (auto& pLayer : mLayerList)
@@ -26,9 +26,12 @@
 #include <SDL.h>
 #include <glm/vec3.hpp>
 
+#include <algorithm>
 #include <array>
-#include <list>
 #include <memory>
+#include <typeindex>
+#include <typeinfo>
+#include <unordered_map>
 #include <vector>
 
 namespace Genesis
@@ -60,15 +63,85 @@ public:
     const LightArray& GetLights() const;
     LightArray& GetLights();
 
+    // Registers an object as the one to be returned by Find<T>(). Objects are unregistered
+    // automatically when they are removed from their layer.
+    template <typename T>
+    void Register( T* pObject )
+    {
+        const std::type_index type( typeid( T ) );
+        m_Registry[ type ] = pObject;
+        m_FindCache.erase( type );
+    }
+
+    // Returns the registered object of this type if there is one. Otherwise, every layer is searched
+    // for an object of this type, in the same order the layer updates them. The result of the search
+    // is cached until an object of this type is added or the result is removed from the scene.
     template <typename T>
     T* Find()
+    {
+        const std::type_index type( typeid( T ) );
+        Registry::const_iterator itRegistered = m_Registry.find( type );
+        if ( itRegistered != m_Registry.end() )
+        {
+            return static_cast<T*>( itRegistered->second );
+        }
+
+        FindCache::const_iterator itCached = m_FindCache.find( type );
+        if ( itCached != m_FindCache.end() && ( itCached->second.pObject == nullptr || itCached->second.pObject->IsTerminating() == false ) )
+        {
+            return static_cast<T*>( itCached->second.pObject );
+        }
+
+        m_FindSearchCount++;
+        T* pResult = Search<T>();
+        m_FindCache[ type ] = { pResult, &IsOfType<T> };
+        return pResult;
+    }
+
+    // Number of Find<T>() calls which had to search the layers.
+    uint32_t GetFindSearchCount() const;
+
+    void Unregister( SceneObject* pObject );
+    void OnObjectAdded( SceneObject* pObject );
+
+private:
+    using LayerList = std::vector<LayerSharedPtr>;
+    using Registry = std::unordered_map<std::type_index, SceneObject*>;
+
+    // The type test is kept with the cached result, so that adding an object only drops the
+    // results it could have changed.
+    struct CachedFind
+    {
+        SceneObject* pObject;
+        bool ( *pIsOfType )( SceneObject* pObject );
+    };
+    using FindCache = std::unordered_map<std::type_index, CachedFind>;
+
+    template <typename T>
+    static bool IsOfType( SceneObject* pObject )
+    {
+        return dynamic_cast<T*>( pObject ) != nullptr;
+    }
+
+    template <typename T>
+    T* Search() const
     {
         for ( auto& pLayer : mLayerList )
         {
-            for ( auto& pObject : pLayer->GetSceneObjects() )
+            const LayerObjectList& opaqueObjects = pLayer->GetOpaqueSceneObjects();
+            for ( LayerObjectList::const_reverse_iterator itObject = opaqueObjects.crbegin(); itObject != opaqueObjects.crend(); ++itObject )
             {
-                T* pResult = dynamic_cast<T*>( pObject.pSceneObject );
-                if ( pResult != nullptr )
+                T* pResult = dynamic_cast<T*>( itObject->pSceneObject );
+                if ( pResult != nullptr && pResult->IsTerminating() == false )
+                {
+                    return pResult;
+                }
+            }
+
+            for ( const LayerObject& layerObject : pLayer->GetTransparentSceneObjects() )
+            {
+                T* pResult = dynamic_cast<T*>( layerObject.pSceneObject );
+                if ( pResult != nullptr && pResult->IsTerminating() == false )
                 {
                     return pResult;
                 }
@@ -77,11 +150,11 @@ public:
         return nullptr;
     }
 
-private:
-    using LayerList = std::list<LayerSharedPtr>;
-
     LayerList mLayerList;
     LayerList mLayersToDelete;
+    Registry m_Registry;
+    FindCache m_FindCache;
+    uint32_t m_FindSearchCount;
     std::vector<SceneCameraSharedPtr> m_Cameras;
     uint32_t mMask;
     LightArray m_Lights;
@@ -109,6 +182,11 @@ inline const std::vector<SceneCameraSharedPtr>& Scene::GetCameras() const
     return m_Cameras;
 }
 
+inline uint32_t Scene::GetFindSearchCount() const
+{
+    return m_FindSearchCount;
+}
+
 inline void Scene::SetLayerMask( uint32_t mask )
 {
     mMask = mask;
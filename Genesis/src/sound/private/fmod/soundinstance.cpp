@@ -136,6 +136,17 @@ void SoundInstance::SetMinimumDistance(float value)
     CheckFMODResult(result);
 }
 
+float SoundInstance::GetMinimumDistance() const
+{
+    float minimumDistance = 0.0f;
+    float maximumDistance = 0.0f;
+    if (IsPlaying())
+    {
+        CheckFMODResult(m_pChannel->get3DMinMaxDistance(&minimumDistance, &maximumDistance));
+    }
+    return minimumDistance;
+}
+
 bool SoundInstance::IsPlaying() const
 {
     bool isPlaying = false;
@@ -48,6 +48,7 @@ public:
     virtual ResourceSound* GetResource() const override;
 
     virtual void SetMinimumDistance(float value) override;
+    virtual float GetMinimumDistance() const override;
     virtual void Set3DAttributes(const glm::vec3* pPosition, const glm::vec3* pVelocity) override;
     virtual void Get3DAttributes(glm::vec3* pPosition, glm::vec3* pVelocity) override;
     virtual void SetVolume(float value) override;
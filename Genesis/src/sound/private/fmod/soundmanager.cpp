@@ -123,18 +123,7 @@ void SoundManager::Update(float delta)
         PlayNextTrack();
     }
 
-    // Clear any instances which are no longer being references externally
-    for (SoundInstanceList::iterator it = m_SoundInstances.begin(); it != m_SoundInstances.end();)
-    {
-        if (it->use_count() == 1 && (*it)->IsPlaying() == false)
-        {
-            it = m_SoundInstances.erase(it);
-        }
-        else
-        {
-            ++it;
-        }
-    }
+    m_SoundInstancePool.Recycle();
 
     // Force the update of the music's volume to guarantee that it reflects the settings as the player
     // modifies them.
@@ -232,10 +221,9 @@ SoundInstanceSharedPtr SoundManager::CreateSoundInstance(ResourceSound* pResourc
 
         if (pChannel != nullptr)
         {
-            SoundInstanceSharedPtr soundInstance = std::make_shared<::Genesis::Sound::SoundInstance>();
+            SoundInstanceSharedPtr soundInstance = m_SoundInstancePool.Acquire();
             soundInstance->Initialise(pResourceSound, pChannel);
-            m_SoundInstances.push_back(soundInstance);
-            return m_SoundInstances.back();
+            return soundInstance;
         }
     }
 
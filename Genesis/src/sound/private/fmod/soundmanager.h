@@ -19,6 +19,7 @@
 
 #if USE_FMOD
 
+#include "sound/private/soundinstancepool.h"
 #include "sound/private/soundmanagerimpl.h"
 
 #include <list>
@@ -61,7 +62,7 @@ private:
     bool UpdateInstancingLimit(ResourceSound* pResourceSound);
 
     ::FMOD::System* m_pSystem;
-    SoundInstanceList m_SoundInstances;
+    SoundInstancePool m_SoundInstancePool;
     ResourceSound* m_pActivePlaylist;
     SoundInstanceSharedPtr m_pPlaylistSoundInstance;
     int m_PlaylistSoundIndex;
@@ -93,7 +94,7 @@ inline SoundInstanceSharedPtr SoundManager::GetCurrentSong() const
 
 inline const SoundInstanceList& SoundManager::GetSoundInstances() const
 {
-    return m_SoundInstances;
+    return m_SoundInstancePool.GetInstances();
 }
 
 } // namespace Genesis::Sound::Private::FMOD
@@ -20,11 +20,26 @@
 namespace Genesis::Sound::Private::Null
 {
 
-SoundInstance::SoundInstance() {}
+SoundInstance::SoundInstance()
+    : m_pResourceSound(nullptr)
+    , m_MinimumDistance(1.0f)
+    , m_Position(0.0f)
+    , m_Velocity(0.0f)
+    , m_Volume(1.0f)
+{
+}
 
 SoundInstance::~SoundInstance() {}
 
-void SoundInstance::Initialise(ResourceSound* pResourceSound, void* pData) {}
+// Instances are reused, so everything is reset.
+void SoundInstance::Initialise(ResourceSound* pResourceSound, void* pData)
+{
+    m_pResourceSound = pResourceSound;
+    m_MinimumDistance = 1.0f;
+    m_Position = glm::vec3(0.0f);
+    m_Velocity = glm::vec3(0.0f);
+    m_Volume = 1.0f;
+}
 
 bool SoundInstance::IsPlaying() const
 {
@@ -50,31 +65,53 @@ float SoundInstance::GetAudability() const
 
 ResourceSound* SoundInstance::GetResource() const
 {
-    return nullptr;
+    return m_pResourceSound;
 }
 
-void SoundInstance::SetMinimumDistance(float value) {}
+void SoundInstance::SetMinimumDistance(float value)
+{
+    m_MinimumDistance = value;
+}
 
-void SoundInstance::Set3DAttributes(const glm::vec3* pPosition, const glm::vec3* pVelocity) {}
+float SoundInstance::GetMinimumDistance() const
+{
+    return m_MinimumDistance;
+}
+
+void SoundInstance::Set3DAttributes(const glm::vec3* pPosition, const glm::vec3* pVelocity)
+{
+    if (pPosition != nullptr)
+    {
+        m_Position = *pPosition;
+    }
+
+    if (pVelocity != nullptr)
+    {
+        m_Velocity = *pVelocity;
+    }
+}
 
 void SoundInstance::Get3DAttributes(glm::vec3* pPosition, glm::vec3* pVelocity)
 {
     if (pPosition != nullptr)
     {
-        *pPosition = glm::vec3(0.0f);
+        *pPosition = m_Position;
     }
 
     if (pVelocity != nullptr)
     {
-        *pVelocity = glm::vec3(0.0f);
+        *pVelocity = m_Velocity;
     }
 }
 
-void SoundInstance::SetVolume(float value) {}
+void SoundInstance::SetVolume(float value)
+{
+    m_Volume = value;
+}
 
 float SoundInstance::GetVolume() const
 {
-    return 0.0f;
+    return m_Volume;
 }
 
 } // namespace Genesis::Sound::Private::Null
@@ -43,10 +43,19 @@ public:
     virtual ResourceSound* GetResource() const override;
 
     virtual void SetMinimumDistance(float value) override;
+    virtual float GetMinimumDistance() const override;
     virtual void Set3DAttributes(const glm::vec3* pPosition, const glm::vec3* pVelocity) override;
     virtual void Get3DAttributes(glm::vec3* pPosition, glm::vec3* pVelocity) override;
     virtual void SetVolume(float value) override;
     virtual float GetVolume() const override;
+
+private:
+    // Kept so that the null backend reports back what it was asked to play.
+    ResourceSound* m_pResourceSound;
+    float m_MinimumDistance;
+    glm::vec3 m_Position;
+    glm::vec3 m_Velocity;
+    float m_Volume;
 };
 
 } // namespace Genesis::Sound::Private::Null
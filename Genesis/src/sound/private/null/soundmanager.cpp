@@ -17,20 +17,37 @@
 
 #include "sound/private/null/soundmanager.h"
 
+#include "sound/soundinstance.h"
+
 namespace Genesis::Sound::Private::Null
 {
 
-SoundManager::SoundManager() {}
+SoundManager::SoundManager()
+    : m_ListenerPosition(0.0f)
+{
+}
 
 SoundManager::~SoundManager() {}
 
-void SoundManager::Update(float delta) {}
+void SoundManager::Update(float delta)
+{
+    m_SoundInstancePool.Recycle();
+}
 
 // virtual FMOD::Sound* CreateSound( ResourceSound* pResourceSound ) override;
 
+// Instances never play, but are handed out and recycled like any other backend's,
+// so code which depends on them behaves the same way without audio.
 SoundInstanceSharedPtr SoundManager::CreateSoundInstance(ResourceSound* pResourceSound)
 {
-    return nullptr;
+    if (pResourceSound == nullptr)
+    {
+        return nullptr;
+    }
+
+    SoundInstanceSharedPtr pSoundInstance = m_SoundInstancePool.Acquire();
+    pSoundInstance->Initialise(pResourceSound, nullptr);
+    return pSoundInstance;
 }
 
 void SoundManager::SetPlaylist(ResourceSound* pResourceSound, const std::string& startingSong, bool shuffle) {}
@@ -47,15 +64,17 @@ SoundInstanceSharedPtr SoundManager::GetCurrentSong() const
 
 const SoundInstanceList& SoundManager::GetSoundInstances() const
 {
-    static SoundInstanceList list;
-    return list;
+    return m_SoundInstancePool.GetInstances();
 }
 
-void SoundManager::SetListener(const glm::vec3& position, const glm::vec3& velocity, const glm::vec3& forward, const glm::vec3& up) {}
+void SoundManager::SetListener(const glm::vec3& position, const glm::vec3& velocity, const glm::vec3& forward, const glm::vec3& up)
+{
+    m_ListenerPosition = position;
+}
 
 glm::vec3 SoundManager::GetListenerPosition() const
 {
-    return glm::vec3(0.0f);
+    return m_ListenerPosition;
 }
 
 int SoundManager::GetActiveSoundCount() const
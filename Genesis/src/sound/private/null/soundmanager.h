@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include "sound/private/soundinstancepool.h"
 #include "sound/private/soundmanagerimpl.h"
 
 namespace Genesis::Sound::Private::Null
@@ -37,6 +38,17 @@ public:
     virtual void SetListener(const glm::vec3& position, const glm::vec3& velocity, const glm::vec3& forward, const glm::vec3& up) override;
     virtual glm::vec3 GetListenerPosition() const override;
     virtual int GetActiveSoundCount() const override;
+
+    const SoundInstancePool& GetSoundInstancePool() const;
+
+private:
+    SoundInstancePool m_SoundInstancePool;
+    glm::vec3 m_ListenerPosition;
 };
 
+inline const SoundInstancePool& SoundManager::GetSoundInstancePool() const
+{
+    return m_SoundInstancePool;
+}
+
 } // namespace Genesis::Sound::Private::Null
@@ -42,6 +42,7 @@ public:
     virtual ResourceSound* GetResource() const = 0;
 
     virtual void SetMinimumDistance(float value) = 0;
+    virtual float GetMinimumDistance() const = 0;
     virtual void Set3DAttributes(const glm::vec3* pPosition = nullptr, const glm::vec3* pVelocity = nullptr) = 0;
     virtual void Get3DAttributes(glm::vec3* pPosition = nullptr, glm::vec3* pVelocity = nullptr) = 0;
     virtual void SetVolume(float value) = 0;
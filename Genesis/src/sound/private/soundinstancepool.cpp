@@ -0,0 +1,62 @@
+// Copyright 2026 Pedro Nunes
+//
+// This file is part of Genesis.
+//
+// Genesis is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Genesis is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Genesis. If not, see <http://www.gnu.org/licenses/>.
+
+#include "sound/private/soundinstancepool.h"
+
+#include "sound/soundinstance.h"
+
+namespace Genesis::Sound::Private
+{
+
+SoundInstanceSharedPtr SoundInstancePool::Acquire()
+{
+    if (m_FreeInstances.empty())
+    {
+        m_Instances.push_back(std::make_shared<SoundInstance>());
+    }
+    else
+    {
+        m_Instances.splice(m_Instances.end(), m_FreeInstances, m_FreeInstances.begin());
+    }
+    return m_Instances.back();
+}
+
+void SoundInstancePool::Recycle()
+{
+    for (SoundInstanceList::iterator it = m_Instances.begin(); it != m_Instances.end();)
+    {
+        if (it->use_count() == 1 && (*it)->IsPlaying() == false)
+        {
+            if (m_FreeInstances.size() < sMaxFreeInstances)
+            {
+                SoundInstanceList::iterator next = std::next(it);
+                m_FreeInstances.splice(m_FreeInstances.end(), m_Instances, it);
+                it = next;
+            }
+            else
+            {
+                it = m_Instances.erase(it);
+            }
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
+} // namespace Genesis::Sound::Private
@@ -0,0 +1,59 @@
+// Copyright 2026 Pedro Nunes
+//
+// This file is part of Genesis.
+//
+// Genesis is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Genesis is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Genesis. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "sound/soundmanager.h"
+
+namespace Genesis::Sound::Private
+{
+
+///////////////////////////////////////////////////////////////////////////////
+// SoundInstancePool
+// Owns a backend's sound instances. Instances which have finished playing and
+// aren't referenced anywhere else are moved to a free list by Recycle(), and
+// Acquire() reuses them. Splicing moves the list node along with the
+// instance, so reuse doesn't allocate.
+///////////////////////////////////////////////////////////////////////////////
+
+class SoundInstancePool
+{
+public:
+    SoundInstanceSharedPtr Acquire(); // The instance still needs to be initialised.
+    void Recycle();
+
+    const SoundInstanceList& GetInstances() const;
+    size_t GetFreeCount() const;
+
+    static const size_t sMaxFreeInstances = 64;
+
+private:
+    SoundInstanceList m_Instances;
+    SoundInstanceList m_FreeInstances;
+};
+
+inline const SoundInstanceList& SoundInstancePool::GetInstances() const
+{
+    return m_Instances;
+}
+
+inline size_t SoundInstancePool::GetFreeCount() const
+{
+    return m_FreeInstances.size();
+}
+
+} // namespace Genesis::Sound::Private
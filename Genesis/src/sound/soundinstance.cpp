@@ -84,6 +84,11 @@ void SoundInstance::SetMinimumDistance(float value)
     m_pImpl->SetMinimumDistance(value);
 }
 
+float SoundInstance::GetMinimumDistance() const
+{
+    return m_pImpl->GetMinimumDistance();
+}
+
 void SoundInstance::Set3DAttributes(const glm::vec3* pPosition /* = nullptr */, const glm::vec3* pVelocity /* = nullptr */)
 {
     m_pImpl->Set3DAttributes(pPosition, pVelocity);
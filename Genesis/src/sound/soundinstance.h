@@ -53,6 +53,7 @@ public:
     ResourceSound* GetResource() const;
 
     void SetMinimumDistance(float value);
+    float GetMinimumDistance() const;
     void Set3DAttributes(const glm::vec3* pPosition = nullptr, const glm::vec3* pVelocity = nullptr);
     void Get3DAttributes(glm::vec3* pPosition = nullptr, glm::vec3* pVelocity = nullptr);
     void SetVolume(float value);
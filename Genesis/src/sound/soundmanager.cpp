@@ -17,11 +17,14 @@
 
 #include "sound/private/fmod/soundmanager.h"
 
+#include "performancecounters.h"
 #include "sound/private/null/soundmanager.h"
 #include "sound/private/soundinstanceimpl.h"
 #include "sound/private/soundmanagerimpl.h"
 #include "sound/soundmanager.h"
 
+#include <memorytracker.hpp>
+
 namespace Genesis::Sound
 {
 
@@ -34,13 +37,20 @@ SoundManager::SoundManager()
 #else
     m_pImpl = std::make_unique<Private::Null::SoundManager>();
 #endif
+
+    m_pVoiceManager = std::make_unique<VoiceManager>(m_pImpl.get());
 }
 
 SoundManager::~SoundManager() {}
 
 TaskStatus SoundManager::Update(float delta)
 {
+    GENESIS_MEMORY_SCOPE(Sound);
     m_pImpl->Update(delta);
+    m_pVoiceManager->Update();
+
+    static PerformanceCounter* sPlayingSounds = PerformanceCounters::Register("Sound/Playing", PerformanceCounterType::Gauge);
+    sPlayingSounds->Set(m_pImpl->GetActiveSoundCount());
     return TaskStatus::Continue;
 }
 
@@ -49,6 +59,22 @@ SoundInstanceSharedPtr SoundManager::CreateSoundInstance(ResourceSound* pResourc
     return m_pImpl->CreateSoundInstance(pResourceSound);
 }
 
+void SoundManager::QueueSound(const SoundRequest& request)
+{
+    GENESIS_MEMORY_SCOPE(Sound);
+    m_pVoiceManager->Queue(request);
+}
+
+void SoundManager::SetVoiceBudget(int budget)
+{
+    m_pVoiceManager->SetVoiceBudget(budget);
+}
+
+const VoiceStats& SoundManager::GetVoiceStats() const
+{
+    return m_pVoiceManager->GetStats();
+}
+
 void SoundManager::SetPlaylist(ResourceSound* pResourceSound, const std::string& startingTrack /* = "" */, bool shuffle /* = false */)
 {
     m_pImpl->SetPlaylist(pResourceSound, startingTrack, shuffle);
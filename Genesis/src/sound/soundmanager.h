@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include "sound/voicemanager.h"
 #include "taskmanager.h"
 
 #include <glm/vec3.hpp>
@@ -52,6 +53,12 @@ public:
 
     SoundInstanceSharedPtr CreateSoundInstance(ResourceSound* pResourceSound);
 
+    // Fire-and-forget sound effects. Requests are resolved once per frame by the VoiceManager,
+    // which may merge, cull or drop them; use CreateSoundInstance if the instance needs to be controlled.
+    void QueueSound(const SoundRequest& request);
+    void SetVoiceBudget(int budget);
+    const VoiceStats& GetVoiceStats() const;
+
     void SetPlaylist(ResourceSound* pResourceSound, const std::string& startingSong = "", bool shuffle = false);
 
     ResourceSound* GetPlaylistResource() const;
@@ -66,6 +73,7 @@ public:
 
 private:
     std::unique_ptr<Private::SoundManagerImpl> m_pImpl;
+    std::unique_ptr<VoiceManager> m_pVoiceManager;
 };
 
 } // namespace Sound
@@ -0,0 +1,265 @@
+// Copyright 2026 Pedro Nunes
+//
+// This file is part of Genesis.
+//
+// Genesis is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Genesis is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Genesis. If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "sound/voicemanager.h"
+
+#include "resources/resourcesound.h"
+#include "sound/private/soundmanagerimpl.h"
+#include "sound/soundinstance.h"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <glm/common.hpp>
+#include <glm/geometric.hpp>
+
+namespace Genesis::Sound
+{
+
+// Requests for the same sound closer than this fraction of its minimum distance are merged.
+static const float sCoalesceRadiusFraction = 0.25f;
+
+// Merged voices get louder with the square root of their count, as uncorrelated sources do,
+// up to this multiple of the original gain.
+static const float sMaxCoalescedGain = 4.0f;
+
+// Channels can't be played above full volume.
+static const float sMaxVolume = 1.0f;
+
+// Voices estimated to be quieter than this at the listener aren't given a channel.
+static const float sAudibilityThreshold = 0.02f;
+
+// FMOD is initialised with 100 virtual voices; leave headroom for music and looping sounds.
+static const int sDefaultVoiceBudget = 48;
+
+VoiceManager::VoiceManager(Private::SoundManagerImpl* pImpl)
+    : m_pImpl(pImpl)
+    , m_VoiceBudget(sDefaultVoiceBudget)
+{
+}
+
+void VoiceManager::Queue(const SoundRequest& request)
+{
+    if (request.pResource == nullptr)
+    {
+        return;
+    }
+
+    m_FrameStats.requested++;
+
+    const int coalescable = FindCoalescable(request);
+    if (coalescable >= 0)
+    {
+        PendingVoice& voice = m_Pending[coalescable];
+        voice.positionSum += request.position;
+        voice.count++;
+        voice.request.priority = std::max(voice.request.priority, request.priority);
+        voice.request.volume = std::max(voice.request.volume, request.volume);
+        m_FrameStats.coalesced++;
+    }
+    else
+    {
+        const int index = static_cast<int>(m_Pending.size());
+        auto insertion = m_Cells.insert({ GetCellKey(request, request.position), index });
+        const int nextInCell = insertion.second ? -1 : insertion.first->second;
+        insertion.first->second = index;
+        m_Pending.push_back({ request, request.position, request.position, 1, 0.0f, nextInCell });
+    }
+}
+
+bool VoiceManager::CellKey::operator==(const CellKey& other) const
+{
+    return pResource == other.pResource && minimumDistance == other.minimumDistance && x == other.x && y == other.y && z == other.z;
+}
+
+size_t VoiceManager::CellKeyHash::operator()(const CellKey& key) const
+{
+    size_t hash = std::hash<ResourceSound*>()(key.pResource);
+    for (size_t value : { std::hash<float>()(key.minimumDistance), std::hash<int>()(key.x), std::hash<int>()(key.y), std::hash<int>()(key.z) })
+    {
+        hash ^= value + 0x9E3779B9 + (hash << 6) + (hash >> 2);
+    }
+    return hash;
+}
+
+// Only requests for the same sound with the same minimum distance are merged, which fixes the cell size
+// to the merge radius: any voice close enough to merge with is in the request's cell or a neighbouring one.
+// Non-3D sounds merge regardless of where they are, so they all share a single cell.
+VoiceManager::CellKey VoiceManager::GetCellKey(const SoundRequest& request, const glm::vec3& position) const
+{
+    if (!request.pResource->Is3D())
+    {
+        return { request.pResource, 0.0f, 0, 0, 0 };
+    }
+
+    const float radius = request.minimumDistance * sCoalesceRadiusFraction;
+    if (radius <= 0.0f)
+    {
+        return { request.pResource, request.minimumDistance, 0, 0, 0 };
+    }
+
+    const glm::vec3 cell = glm::floor(position / radius);
+    return { request.pResource, request.minimumDistance, static_cast<int>(cell.x), static_cast<int>(cell.y), static_cast<int>(cell.z) };
+}
+
+// Returns the index in m_Pending of the earliest voice the request can be merged into, or -1.
+int VoiceManager::FindCoalescable(const SoundRequest& request) const
+{
+    const CellKey key = GetCellKey(request, request.position);
+    const bool is3D = request.pResource->Is3D() && request.minimumDistance > 0.0f;
+    const int range = is3D ? 1 : 0;
+    const float radius = request.minimumDistance * sCoalesceRadiusFraction;
+
+    int coalescable = -1;
+    for (int x = -range; x <= range; x++)
+    {
+        for (int y = -range; y <= range; y++)
+        {
+            for (int z = -range; z <= range; z++)
+            {
+                auto it = m_Cells.find({ key.pResource, key.minimumDistance, key.x + x, key.y + y, key.z + z });
+                if (it == m_Cells.end())
+                {
+                    continue;
+                }
+
+                for (int index = it->second; index >= 0; index = m_Pending[index].nextInCell)
+                {
+                    // Distances are measured from the first request rather than the running centroid, so a
+                    // long chain of requests can't drag a voice arbitrarily far.
+                    const bool isInRange = !request.pResource->Is3D() || glm::distance(m_Pending[index].anchor, request.position) <= radius;
+                    if (isInRange && (coalescable < 0 || index < coalescable))
+                    {
+                        coalescable = index;
+                    }
+                }
+            }
+        }
+    }
+    return coalescable;
+}
+
+float VoiceManager::GetCoalescedGain(const PendingVoice& voice) const
+{
+    return std::min(std::sqrt(static_cast<float>(voice.count)), sMaxCoalescedGain);
+}
+
+// Merged voices are made louder through their volume. Whatever doesn't fit below full volume scales the minimum
+// distance instead: with inverse distance rolloff that is the same gain anywhere beyond the minimum distance.
+float VoiceManager::GetCoalescedVolume(const PendingVoice& voice) const
+{
+    return std::max(voice.request.volume, std::min(voice.request.volume * GetCoalescedGain(voice), sMaxVolume));
+}
+
+float VoiceManager::GetCoalescedMinimumDistance(const PendingVoice& voice) const
+{
+    const float volume = GetCoalescedVolume(voice);
+    if (volume <= 0.0f)
+    {
+        return voice.request.minimumDistance;
+    }
+    return voice.request.minimumDistance * voice.request.volume * GetCoalescedGain(voice) / volume;
+}
+
+// Mirrors the backend's inverse distance rolloff: full volume inside the minimum distance,
+// falling off with 1/distance beyond it.
+float VoiceManager::EstimateAudibility(const PendingVoice& voice, const glm::vec3& listenerPosition) const
+{
+    const float volume = GetCoalescedVolume(voice);
+    if (!voice.request.pResource->Is3D())
+    {
+        return volume;
+    }
+
+    const glm::vec3 position = voice.positionSum / static_cast<float>(voice.count);
+    const float minimumDistance = GetCoalescedMinimumDistance(voice);
+    const float distance = glm::distance(position, listenerPosition);
+    const float attenuation = (distance <= minimumDistance) ? 1.0f : minimumDistance / distance;
+    return volume * attenuation;
+}
+
+void VoiceManager::Update()
+{
+    const glm::vec3 listenerPosition = m_pImpl->GetListenerPosition();
+
+    m_Candidates.clear();
+    for (PendingVoice& voice : m_Pending)
+    {
+        voice.audibility = EstimateAudibility(voice, listenerPosition);
+        if (voice.audibility < sAudibilityThreshold && voice.request.priority != SoundPriority::Critical)
+        {
+            m_FrameStats.culled++;
+        }
+        else
+        {
+            m_Candidates.push_back(&voice);
+        }
+    }
+
+    std::sort(m_Candidates.begin(), m_Candidates.end(), [](const PendingVoice* pA, const PendingVoice* pB) {
+        if (pA->request.priority != pB->request.priority)
+        {
+            return pA->request.priority > pB->request.priority;
+        }
+        return pA->audibility > pB->audibility;
+    });
+
+    int availableVoices = m_VoiceBudget - m_pImpl->GetActiveSoundCount();
+    for (const PendingVoice* pVoice : m_Candidates)
+    {
+        if (availableVoices > 0 || pVoice->request.priority == SoundPriority::Critical)
+        {
+            Play(*pVoice);
+            availableVoices--;
+            m_FrameStats.played++;
+        }
+        else
+        {
+            m_FrameStats.overBudget++;
+        }
+    }
+
+    m_Pending.clear();
+    m_Cells.clear();
+    m_Stats = m_FrameStats;
+    m_FrameStats = VoiceStats();
+}
+
+void VoiceManager::Play(const PendingVoice& voice)
+{
+    SoundInstanceSharedPtr pSoundInstance = m_pImpl->CreateSoundInstance(voice.request.pResource);
+    if (pSoundInstance == nullptr)
+    {
+        return;
+    }
+
+    if (voice.request.pResource->Is3D())
+    {
+        const glm::vec3 position = voice.positionSum / static_cast<float>(voice.count);
+        pSoundInstance->Set3DAttributes(&position);
+        pSoundInstance->SetMinimumDistance(GetCoalescedMinimumDistance(voice));
+    }
+
+    const float volume = GetCoalescedVolume(voice);
+    if (volume != 1.0f)
+    {
+        pSoundInstance->SetVolume(volume);
+    }
+}
+
+} // namespace Genesis::Sound
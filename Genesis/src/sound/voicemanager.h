@@ -0,0 +1,147 @@
+// Copyright 2026 Pedro Nunes
+//
+// This file is part of Genesis.
+//
+// Genesis is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Genesis is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Genesis. If not, see <http://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+#include <glm/vec3.hpp>
+#include <unordered_map>
+#include <vector>
+
+namespace Genesis
+{
+class ResourceSound;
+}
+
+namespace Genesis::Sound
+{
+
+namespace Private
+{
+class SoundManagerImpl;
+}
+
+enum class SoundPriority
+{
+    Low,
+    Normal,
+    High,
+    Critical // Never culled or dropped by the voice budget.
+};
+
+struct SoundRequest
+{
+    ResourceSound* pResource = nullptr;
+    glm::vec3 position = glm::vec3(0.0f); // Ignored for non-3D sounds.
+    float minimumDistance = 1.0f;
+    float volume = 1.0f;
+    SoundPriority priority = SoundPriority::Normal;
+};
+
+struct VoiceStats
+{
+    int requested = 0;
+    int coalesced = 0; // Requests folded into another request in the same frame.
+    int culled = 0;    // Voices too quiet to be worth a channel.
+    int overBudget = 0;
+    int played = 0;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// VoiceManager
+// Collects fire-and-forget sound requests during a frame and decides which
+// of them get a channel. Identical requests close to each other are merged
+// into a single, louder voice, inaudible voices are culled, and what remains
+// is played in priority order until the voice budget runs out.
+// Pending voices are bucketed by sound and by a grid cell the size of the
+// merge radius, so merging only looks at the neighbouring cells.
+// All of this happens before the backend is asked for a channel, so it
+// behaves the same way on the null backend.
+///////////////////////////////////////////////////////////////////////////////
+
+class VoiceManager
+{
+public:
+    VoiceManager(Private::SoundManagerImpl* pImpl);
+
+    void Queue(const SoundRequest& request);
+    void Update();
+
+    void SetVoiceBudget(int budget);
+    int GetVoiceBudget() const;
+    const VoiceStats& GetStats() const; // Stats for the last resolved frame.
+
+private:
+    struct PendingVoice
+    {
+        SoundRequest request;
+        glm::vec3 anchor;
+        glm::vec3 positionSum;
+        int count;
+        float audibility;
+        int nextInCell; // Index in m_Pending of the next voice in the same cell, or -1.
+    };
+
+    struct CellKey
+    {
+        ResourceSound* pResource;
+        float minimumDistance;
+        int x;
+        int y;
+        int z;
+
+        bool operator==(const CellKey& other) const;
+    };
+
+    struct CellKeyHash
+    {
+        size_t operator()(const CellKey& key) const;
+    };
+
+    CellKey GetCellKey(const SoundRequest& request, const glm::vec3& position) const;
+    int FindCoalescable(const SoundRequest& request) const;
+    float GetCoalescedGain(const PendingVoice& voice) const;
+    float GetCoalescedVolume(const PendingVoice& voice) const;
+    float GetCoalescedMinimumDistance(const PendingVoice& voice) const;
+    float EstimateAudibility(const PendingVoice& voice, const glm::vec3& listenerPosition) const;
+    void Play(const PendingVoice& voice);
+
+    Private::SoundManagerImpl* m_pImpl;
+    std::vector<PendingVoice> m_Pending;
+    std::unordered_map<CellKey, int, CellKeyHash> m_Cells; // Index in m_Pending of the last voice added to each cell.
+    std::vector<PendingVoice*> m_Candidates;
+    int m_VoiceBudget;
+    VoiceStats m_FrameStats;
+    VoiceStats m_Stats;
+};
+
+inline void VoiceManager::SetVoiceBudget(int budget)
+{
+    m_VoiceBudget = budget;
+}
+
+inline int VoiceManager::GetVoiceBudget() const
+{
+    return m_VoiceBudget;
+}
+
+inline const VoiceStats& VoiceManager::GetStats() const
+{
+    return m_Stats;
+}
+
+} // namespace Genesis::Sound
@@ -3,8 +3,12 @@
 #include "genesis.h"
 #include "imgui/imgui_impl.h"
 #include "memory.h"
+#include "performancecounters.h"
 #include "timer.h"
 
+#include <framearena.hpp>
+#include <memorytracker.hpp>
+
 namespace Genesis
 {
 
@@ -100,6 +104,13 @@ void TaskManager::Update()
     {
         RemoveMarkedTasks();
     }
+
+    PerformanceCounters::EndFrame();
+    FrameArena::EndFrame();
+
+#if GENESIS_MEMORY_TRACKING
+    MemoryTracker::EndFrame();
+#endif
 }
 
 void TaskManager::RemoveMarkedTasks()
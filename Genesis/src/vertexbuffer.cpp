@@ -171,6 +171,11 @@ void VertexBuffer::CopyPositions(const PositionData& data, size_t count)
     CopyData(&data[0][0], count * 3, VBO_POSITION);
 }
 
+void VertexBuffer::CopyPositions(const FramePositionData& data)
+{
+    CopyData(&data[0][0], data.size() * 3, VBO_POSITION);
+}
+
 void VertexBuffer::CopyUVs(const UVData& data)
 {
     CopyData(&data[0][0], data.size() * 2, VBO_UV);
@@ -181,6 +186,11 @@ void VertexBuffer::CopyUVs(const UVData& data, size_t count)
     CopyData(&data[0][0], count * 2, VBO_UV);
 }
 
+void VertexBuffer::CopyUVs(const FrameUVData& data)
+{
+    CopyData(&data[0][0], data.size() * 2, VBO_UV);
+}
+
 void VertexBuffer::CopyNormals(const NormalData& data)
 {
     SDL_assert(m_Flags & VBO_NORMAL);
@@ -212,6 +222,11 @@ void VertexBuffer::CopyColours(const ColourData& data, size_t count)
     CopyData(&data[0][0], count * 4, VBO_COLOUR);
 }
 
+void VertexBuffer::CopyColours(const FrameColourData& data)
+{
+    CopyData(&data[0][0], data.size() * 4, VBO_COLOUR);
+}
+
 void VertexBuffer::CopyIndices(const IndexData& data)
 {
     SDL_assert(m_Flags & VBO_INDEX);
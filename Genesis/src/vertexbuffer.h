@@ -18,6 +18,7 @@
 #pragma once
 
 #include "coredefines.h"
+#include <framearena.hpp>
 #include "glm/gtx/transform.hpp"
 #include "rendersystem.fwd.h"
 
@@ -48,6 +49,11 @@ using BitangentData = std::vector<glm::vec3>;
 using ColourData = std::vector<glm::vec4>;
 using IndexData = std::vector<uint32_t>;
 
+// Geometry rebuilt every frame should use these, allocated from the calling thread's FrameArena.
+using FramePositionData = FrameVector<glm::vec3>;
+using FrameUVData = FrameVector<glm::vec2>;
+using FrameColourData = FrameVector<glm::vec4>;
+
 enum class GeometryType
 {
     Triangle,
@@ -64,13 +70,16 @@ public:
 
     void CopyPositions(const PositionData& data);
     void CopyPositions(const PositionData& data, size_t count);
+    void CopyPositions(const FramePositionData& data);
     void CopyUVs(const UVData& data);
     void CopyUVs(const UVData& data, size_t count);
+    void CopyUVs(const FrameUVData& data);
     void CopyNormals(const NormalData& data);
     void CopyTangents(const TangentData& data);
     void CopyBitangents(const BitangentData& data);
     void CopyColours(const ColourData& data);
     void CopyColours(const ColourData& data, size_t count);
+    void CopyColours(const FrameColourData& data);
     void CopyIndices(const IndexData& data);
     void CopyData(const float* pData, size_t count, unsigned int destination);
 
@@ -0,0 +1,104 @@
+// Copyright 2026 Pedro Nunes
+//
+// This file is part of Genesis.
+//
+// Genesis is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Genesis is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Genesis. If not, see <http://www.gnu.org/licenses/>.
+
+// Checks that Scene::Find<T>() only searches the layers when its cached result
+// could have changed, and that registered objects are never searched for.
+
+#include "scene/layer.h"
+#include "scene/scene.h"
+#include "scene/sceneobject.h"
+#include "testharness.hpp"
+
+using namespace Genesis;
+using Genesis::Test::Check;
+
+class Manager : public SceneObject
+{
+public:
+    void Render(const SceneCameraSharedPtr& pCamera) override {}
+};
+
+class OtherManager : public SceneObject
+{
+public:
+    void Render(const SceneCameraSharedPtr& pCamera) override {}
+};
+
+class Effect : public SceneObject
+{
+public:
+    void Render(const SceneCameraSharedPtr& pCamera) override {}
+};
+
+static void TestFindCache()
+{
+    Scene scene;
+    LayerSharedPtr pLayer = scene.AddLayer(1);
+    Manager* pManager = new Manager();
+    pLayer->AddSceneObject(pManager);
+
+    Check(scene.Find<Manager>() == pManager, "object wasn't found");
+    Check(scene.Find<Manager>() == pManager && scene.GetFindSearchCount() == 1, "second Find wasn't cached");
+
+    // Objects of other types don't change the result.
+    pLayer->AddSceneObject(new Effect());
+    Check(scene.Find<Manager>() == pManager && scene.GetFindSearchCount() == 1, "Find after an unrelated add wasn't cached");
+
+    // Neither does an empty result.
+    Check(scene.Find<OtherManager>() == nullptr && scene.GetFindSearchCount() == 2, "missing object was found");
+    Check(scene.Find<OtherManager>() == nullptr && scene.GetFindSearchCount() == 2, "empty result wasn't cached");
+
+    // Adding an object of the type searched for does, as does removing the cached result.
+    OtherManager* pOtherManager = new OtherManager();
+    pLayer->AddSceneObject(pOtherManager);
+    Check(scene.Find<OtherManager>() == pOtherManager && scene.GetFindSearchCount() == 3, "added object wasn't found");
+    Check(scene.Find<Manager>() == pManager && scene.GetFindSearchCount() == 3, "Find after adding another type wasn't cached");
+
+    pLayer->RemoveSceneObject(pOtherManager);
+    scene.Update(0.0f);
+    Check(scene.Find<OtherManager>() == nullptr && scene.GetFindSearchCount() == 4, "removed object was still found");
+    Check(scene.Find<Manager>() == pManager && scene.GetFindSearchCount() == 4, "Find after removing another object wasn't cached");
+
+    // A terminating object is no longer returned.
+    pManager->SetTerminating();
+    Check(scene.Find<Manager>() == nullptr && scene.GetFindSearchCount() == 5, "terminating object was still found");
+}
+
+static void TestRegistry()
+{
+    Scene scene;
+    LayerSharedPtr pLayer = scene.AddLayer(1);
+    Manager* pManager = new Manager();
+    pLayer->AddSceneObject(pManager);
+    scene.Register(pManager);
+
+    pLayer->AddSceneObject(new Manager());
+    Check(scene.Find<Manager>() == pManager && scene.GetFindSearchCount() == 0, "registered object was searched for");
+
+    // Removing the object unregisters it.
+    pLayer->RemoveSceneObject(pManager);
+    scene.Update(0.0f);
+    Manager* pFound = scene.Find<Manager>();
+    Check(pFound != nullptr && pFound != pManager && scene.GetFindSearchCount() == 1, "removed object is still registered");
+}
+
+int main()
+{
+    TestFindCache();
+    TestRegistry();
+    return Genesis::Test::GetExitCode();
+}
@@ -0,0 +1,57 @@
+// Copyright 2026 Pedro Nunes
+//
+// This file is part of Genesis.
+//
+// Genesis is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Genesis is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Genesis. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <iostream>
+#include <string>
+
+///////////////////////////////////////////////////////////////////////////////
+// Minimal harness shared by the test executables in Genesis/tests and
+// Game/tests. Failed checks are reported on stderr and counted; main()
+// returns GetExitCode() so that ctest sees the failure.
+///////////////////////////////////////////////////////////////////////////////
+
+namespace Genesis::Test
+{
+
+inline int& GetFailureCount()
+{
+    static int sFailures = 0;
+    return sFailures;
+}
+
+inline void Fail(const std::string& description)
+{
+    std::cerr << "FAILED: " << description << std::endl;
+    GetFailureCount()++;
+}
+
+inline void Check(bool condition, const char* pDescription)
+{
+    if (!condition)
+    {
+        Fail(pDescription);
+    }
+}
+
+inline int GetExitCode()
+{
+    return GetFailureCount() == 0 ? 0 : 1;
+}
+
+} // namespace Genesis::Test
@@ -0,0 +1,222 @@
+// Copyright 2026 Pedro Nunes
+//
+// This file is part of Genesis.
+//
+// Genesis is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Genesis is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Genesis. If not, see <http://www.gnu.org/licenses/>.
+
+// Runs the VoiceManager on the null sound backend, checking how requests are merged,
+// which voices the budget drops, and that finished instances go through the free list.
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <set>
+#include <vector>
+
+#include <glm/geometric.hpp>
+
+#include "resources/resourcesound.h"
+#include "sound/private/null/soundmanager.h"
+#include "sound/soundinstance.h"
+#include "sound/voicemanager.h"
+#include "testharness.hpp"
+
+using namespace Genesis;
+using namespace Genesis::Sound;
+using Genesis::Test::Check;
+
+static bool IsClose(float a, float b)
+{
+    return std::abs(a - b) <= 1.0e-4f * std::max(1.0f, std::abs(b));
+}
+
+static SoundRequest MakeRequest(ResourceSound* pResource, const glm::vec3& position, float volume = 1.0f, SoundPriority priority = SoundPriority::Normal)
+{
+    SoundRequest request;
+    request.pResource = pResource;
+    request.position = position;
+    request.minimumDistance = 40.0f; // Merge radius of 10.
+    request.volume = volume;
+    request.priority = priority;
+    return request;
+}
+
+static void TestCoalescing()
+{
+    ResourceSound sound3D(Filename("explosion.wav"));
+    sound3D.Initialise(SOUND_FLAG_FX | SOUND_FLAG_3D);
+    ResourceSound otherSound3D(Filename("hit.wav"));
+    otherSound3D.Initialise(SOUND_FLAG_FX | SOUND_FLAG_3D);
+    ResourceSound sound2D(Filename("click.wav"));
+    sound2D.Initialise(SOUND_FLAG_FX);
+
+    Private::Null::SoundManager backend;
+    VoiceManager voiceManager(&backend);
+
+    // Four quiet requests merge into one voice at their centroid, twice as loud.
+    voiceManager.Queue(MakeRequest(&sound3D, glm::vec3(100.0f, 0.0f, 0.0f), 0.25f));
+    voiceManager.Queue(MakeRequest(&sound3D, glm::vec3(101.0f, 0.0f, 0.0f), 0.25f));
+    voiceManager.Queue(MakeRequest(&sound3D, glm::vec3(100.0f, 1.0f, 0.0f), 0.25f));
+    voiceManager.Queue(MakeRequest(&sound3D, glm::vec3(100.0f, 0.0f, 1.0f), 0.25f));
+    voiceManager.Update();
+    Check(voiceManager.GetStats().requested == 4 && voiceManager.GetStats().coalesced == 3 && voiceManager.GetStats().played == 1, "quiet requests weren't merged");
+    Check(backend.GetSoundInstances().size() == 1, "merged voice didn't play exactly once");
+    if (backend.GetSoundInstances().size() == 1)
+    {
+        const SoundInstanceSharedPtr& pInstance = backend.GetSoundInstances().front();
+        glm::vec3 position;
+        pInstance->Get3DAttributes(&position);
+        Check(IsClose(pInstance->GetVolume(), 0.5f), "merged voice isn't louder");
+        Check(IsClose(pInstance->GetMinimumDistance(), 40.0f), "merged voice's minimum distance changed although its volume had room");
+        Check(glm::distance(position, glm::vec3(100.25f, 0.25f, 0.25f)) < 1.0e-3f, "merged voice isn't at the centroid");
+    }
+    backend.Update(0.0f);
+
+    // At full volume, the rest of the gain goes into the minimum distance.
+    for (int i = 0; i < 4; i++)
+    {
+        voiceManager.Queue(MakeRequest(&sound3D, glm::vec3(100.0f, 0.0f, 0.0f)));
+    }
+    voiceManager.Update();
+    Check(backend.GetSoundInstances().size() == 1, "full volume requests weren't merged");
+    if (backend.GetSoundInstances().size() == 1)
+    {
+        const SoundInstanceSharedPtr& pInstance = backend.GetSoundInstances().front();
+        Check(IsClose(pInstance->GetVolume(), 1.0f), "merged voice went above full volume");
+        Check(IsClose(pInstance->GetMinimumDistance(), 80.0f), "merged voice at full volume isn't louder");
+    }
+    backend.Update(0.0f);
+
+    // Within the merge radius across cell boundaries, including around the origin.
+    voiceManager.Queue(MakeRequest(&sound3D, glm::vec3(9.9f, 0.0f, 0.0f)));
+    voiceManager.Queue(MakeRequest(&sound3D, glm::vec3(10.1f, 0.0f, 0.0f)));
+    voiceManager.Queue(MakeRequest(&sound3D, glm::vec3(-200.1f, -0.1f, 0.0f)));
+    voiceManager.Queue(MakeRequest(&sound3D, glm::vec3(-199.9f, 0.1f, 0.0f)));
+    voiceManager.Update();
+    Check(voiceManager.GetStats().coalesced == 2 && voiceManager.GetStats().played == 2, "requests across a cell boundary weren't merged");
+    backend.Update(0.0f);
+
+    // Too far apart, or a different sound.
+    voiceManager.Queue(MakeRequest(&sound3D, glm::vec3(0.0f, 0.0f, 0.0f)));
+    voiceManager.Queue(MakeRequest(&sound3D, glm::vec3(15.0f, 0.0f, 0.0f)));
+    voiceManager.Queue(MakeRequest(&otherSound3D, glm::vec3(0.0f, 0.0f, 0.0f)));
+    voiceManager.Update();
+    Check(voiceManager.GetStats().coalesced == 0 && voiceManager.GetStats().played == 3, "distant or different requests were merged");
+    backend.Update(0.0f);
+
+    // Only the first request anchors the voice, so a chain of requests doesn't keep merging.
+    for (int i = 0; i < 5; i++)
+    {
+        voiceManager.Queue(MakeRequest(&sound3D, glm::vec3(static_cast<float>(i) * 6.0f, 0.0f, 0.0f)));
+    }
+    voiceManager.Update();
+    Check(voiceManager.GetStats().played == 3, "chained requests drifted away from their anchor");
+    backend.Update(0.0f);
+
+    // Non-3D sounds merge wherever they are.
+    voiceManager.Queue(MakeRequest(&sound2D, glm::vec3(0.0f, 0.0f, 0.0f), 0.5f));
+    voiceManager.Queue(MakeRequest(&sound2D, glm::vec3(5000.0f, 0.0f, 0.0f), 0.5f));
+    voiceManager.Update();
+    Check(voiceManager.GetStats().coalesced == 1 && voiceManager.GetStats().played == 1, "non-3D requests weren't merged");
+    backend.Update(0.0f);
+}
+
+static void TestBudget()
+{
+    ResourceSound sound3D(Filename("explosion.wav"));
+    sound3D.Initialise(SOUND_FLAG_FX | SOUND_FLAG_3D);
+
+    Private::Null::SoundManager backend;
+    VoiceManager voiceManager(&backend);
+    voiceManager.SetVoiceBudget(3);
+
+    // Audibility with a minimum distance of 40: 0.8, 0.4, 0.2, 0.1 and 0.05.
+    for (float distance : { 800.0f, 400.0f, 200.0f, 100.0f, 50.0f })
+    {
+        voiceManager.Queue(MakeRequest(&sound3D, glm::vec3(distance, 0.0f, 0.0f)));
+    }
+    voiceManager.Queue(MakeRequest(&sound3D, glm::vec3(0.0f, 1600.0f, 0.0f), 1.0f, SoundPriority::High));
+    voiceManager.Queue(MakeRequest(&sound3D, glm::vec3(0.0f, 1.0e6f, 0.0f), 1.0f, SoundPriority::Critical)); // Inaudible, but never culled.
+    voiceManager.Queue(MakeRequest(&sound3D, glm::vec3(0.0f, 1.0e5f, 0.0f), 1.0f, SoundPriority::Low));      // Inaudible.
+    voiceManager.Update();
+
+    const VoiceStats& stats = voiceManager.GetStats();
+    Check(stats.requested == 8 && stats.coalesced == 0, "budget test requests were merged");
+    Check(stats.culled == 1, "inaudible voice wasn't culled");
+    Check(stats.played == 3 && stats.overBudget == 4, "voice budget wasn't applied");
+
+    std::set<float> playedDistances;
+    for (const SoundInstanceSharedPtr& pInstance : backend.GetSoundInstances())
+    {
+        glm::vec3 position;
+        pInstance->Get3DAttributes(&position);
+        playedDistances.insert(glm::length(position));
+    }
+    Check(playedDistances == std::set<float>({ 50.0f, 1600.0f, 1.0e6f }), "budget didn't keep the most important voices");
+}
+
+static void TestFreeList()
+{
+    ResourceSound sound(Filename("click.wav"));
+    sound.Initialise(SOUND_FLAG_FX);
+
+    Private::Null::SoundManager backend;
+    std::set<SoundInstance*> created;
+    SoundInstanceSharedPtr pKept;
+    for (size_t i = 0; i < 10; i++)
+    {
+        SoundInstanceSharedPtr pInstance = backend.CreateSoundInstance(&sound);
+        pInstance->SetVolume(0.5f);
+        created.insert(pInstance.get());
+        if (i == 0)
+        {
+            pKept = pInstance;
+        }
+    }
+    Check(created.size() == 10 && backend.GetSoundInstances().size() == 10, "instances weren't created");
+
+    // Finished instances which nobody else references go to the free list.
+    backend.Update(0.0f);
+    Check(backend.GetSoundInstances().size() == 1 && backend.GetSoundInstances().front() == pKept, "referenced instance was recycled");
+    Check(backend.GetSoundInstancePool().GetFreeCount() == 9, "finished instances weren't recycled");
+
+    // And are reused, reset, before anything new is allocated.
+    for (size_t i = 0; i < 9; i++)
+    {
+        SoundInstanceSharedPtr pInstance = backend.CreateSoundInstance(&sound);
+        Check(created.count(pInstance.get()) == 1 && pInstance.get() != pKept.get(), "free instance wasn't reused");
+        Check(pInstance->GetVolume() == 1.0f && pInstance->GetResource() == &sound, "reused instance wasn't reset");
+    }
+    Check(backend.GetSoundInstancePool().GetFreeCount() == 0 && backend.GetSoundInstances().size() == 10, "free list wasn't drained");
+
+    // The free list is capped; anything beyond that is released.
+    std::vector<SoundInstanceSharedPtr> instances;
+    for (size_t i = 0; i < Private::SoundInstancePool::sMaxFreeInstances * 2; i++)
+    {
+        instances.push_back(backend.CreateSoundInstance(&sound));
+    }
+    instances.clear();
+    pKept = nullptr;
+    backend.Update(0.0f);
+    Check(backend.GetSoundInstances().empty(), "unreferenced instances weren't recycled");
+    Check(backend.GetSoundInstancePool().GetFreeCount() == Private::SoundInstancePool::sMaxFreeInstances, "free list isn't capped");
+}
+
+int main()
+{
+    TestCoalescing();
+    TestBudget();
+    TestFreeList();
+    return Genesis::Test::GetExitCode();
+}
@@ -24,12 +24,10 @@
 // clang-format on
 
 #include "compiler.hpp"
-#include "filehash.hpp"
 #include "forge.hpp"
 
+#include <algorithm>
 #include <fstream>
-#include <vector>
-#include <xxhash64.h>
 
 namespace Genesis
 {
@@ -96,13 +94,34 @@ const std::string& Asset::GetSource() const
     return m_Source;
 }
 
-uint64_t Asset::GetHash() const
+std::vector<std::filesystem::path> Asset::GetInputs() const
 {
-    std::vector<uint64_t> hashes;
-    hashes.push_back(m_pCompiler->GetHash());
-    hashes.push_back(CalculateFileHash(m_Path));
-    hashes.push_back(CalculateFileHash(std::filesystem::path(m_Path).remove_filename() / m_Source));
-    return XXHash64::hash(hashes.data(), sizeof(uint64_t) * hashes.size(), 0);
+    std::vector<std::filesystem::path> inputs;
+    inputs.push_back(m_Path);
+
+    // Some compilers (such as InfoDbComp) take a whole directory as their source.
+    const std::filesystem::path sourcePath = std::filesystem::path(m_Path).remove_filename() / m_Source;
+    if (std::filesystem::is_directory(sourcePath))
+    {
+        const size_t firstSource = inputs.size();
+        std::error_code errorCode;
+        for (const auto& dirEntry : std::filesystem::directory_iterator(sourcePath, errorCode))
+        {
+            if (dirEntry.is_regular_file())
+            {
+                inputs.push_back(dirEntry.path());
+            }
+        }
+
+        // The directory iterator's order is unspecified, so the files are sorted to keep the rebuild key stable.
+        std::sort(inputs.begin() + firstSource, inputs.end());
+    }
+    else
+    {
+        inputs.push_back(sourcePath);
+    }
+
+    return inputs;
 }
 
 } // namespace ResComp
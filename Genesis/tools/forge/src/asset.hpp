@@ -20,6 +20,7 @@
 #include <filesystem>
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace Genesis::ResComp
 {
@@ -37,7 +38,9 @@ public:
     const std::filesystem::path& GetPath() const;
     CompilerSharedPtr GetCompiler() const;
     const std::string& GetSource() const;
-    uint64_t GetHash() const;
+
+    // Every file this asset is built from: the .asset file itself, followed by its source.
+    std::vector<std::filesystem::path> GetInputs() const;
 
 private:
     bool m_IsValid;
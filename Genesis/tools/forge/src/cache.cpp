@@ -17,60 +17,288 @@
 
 #include "cache.hpp"
 
-// clang-format off
-#include <externalheadersbegin.hpp>
-#include <nlohmann/json.hpp>
-#include <externalheadersend.hpp>
-// clang-format on
-
+#include <chrono>
 #include <fstream>
+#include <log.hpp>
+#include <platform.hpp>
+#include <vector>
+#include <xxhash64.h>
+
+#ifndef TARGET_PLATFORM_WINDOWS
+#include <sys/stat.h>
+#endif
+
 #include "asset.hpp"
+#include "compiler.hpp"
 #include "filehash.hpp"
 
 namespace Genesis::ResComp
 {
 
-Cache::Cache(const std::filesystem::path& intermediatesDir) 
+static const uint32_t sCacheMagic = 0x45484346; // "FCHE"
+static const uint32_t sCacheVersion = 1;
+
+// Files modified this recently may still be written to within the same timestamp
+// tick, so their stat is not trusted on the next run and they will be hashed again.
+static const std::chrono::seconds sRacyModificationWindow(2);
+
+template <typename T> static void Write(std::ofstream& file, T value)
+{
+    file.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+static void WriteString(std::ofstream& file, const std::string& value)
 {
-    using namespace nlohmann;
+    Write(file, static_cast<uint32_t>(value.size()));
+    file.write(value.data(), value.size());
+}
 
-    m_CachePath = intermediatesDir / "cache.json";
+template <typename T> static bool Read(std::ifstream& file, T& value)
+{
+    return static_cast<bool>(file.read(reinterpret_cast<char*>(&value), sizeof(T)));
+}
 
-    if (std::filesystem::exists(m_CachePath))
+static bool ReadString(std::ifstream& file, std::string& value)
+{
+    uint32_t length = 0;
+    if (Read(file, length) == false)
     {
-        std::ifstream file(m_CachePath);
-        if (file.good())
-        {
-            json data = json::parse(file);
-            file.close();
+        return false;
+    }
+    value.resize(length);
+    return static_cast<bool>(file.read(value.data(), length));
+}
+
+Cache::Cache(const std::filesystem::path& intermediatesDir)
+    : m_CachePath(intermediatesDir / "cache.bin")
+    , m_Dirty(false)
+{
+    // Superseded by cache.bin; everything will be rebuilt once.
+    std::error_code errorCode;
+    std::filesystem::remove(intermediatesDir / "cache.json", errorCode);
+
+    Load();
+}
+
+Cache::~Cache()
+{
+    Save();
+}
+
+void Cache::Add(Asset* pAsset)
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    const std::string assetPath = pAsset->GetPath().generic_string();
+    auto it = m_PendingKeys.find(assetPath);
+    if (it != m_PendingKeys.end())
+    {
+        m_Keys[assetPath] = it->second;
+        m_PendingKeys.erase(it);
+        m_Dirty = true;
+    }
+}
+
+bool Cache::NeedsRebuild(Asset* pAsset, const std::string& parameters)
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    const std::string assetPath = pAsset->GetPath().generic_string();
+    const uint64_t key = CalculateRebuildKey(pAsset, parameters);
+    auto it = m_Keys.find(assetPath);
+    if (it != m_Keys.end() && it->second == key)
+    {
+        return false;
+    }
+    else
+    {
+        m_PendingKeys[assetPath] = key;
+        return true;
+    }
+}
+
+void Cache::Save()
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    if (m_Dirty == false)
+    {
+        return;
+    }
+
+    // Written to a temporary file first and renamed over the old cache, so an
+    // interrupted write never leaves a truncated cache behind.
+    const std::filesystem::path temporaryPath = std::filesystem::path(m_CachePath).concat(".tmp");
+    std::ofstream file(temporaryPath, std::ios::out | std::ios::binary | std::ios::trunc);
+    if (file.good() == false)
+    {
+        Log::Error() << "Failed to write cache to " << temporaryPath;
+        return;
+    }
 
-            m_Cache = data["cache"];
+    Write(file, sCacheMagic);
+    Write(file, sCacheVersion);
+
+    // Only files which were looked at during this session are kept, so records for deleted files don't accumulate.
+    uint32_t usedFiles = 0;
+    for (auto& record : m_Files)
+    {
+        usedFiles += record.second.used ? 1 : 0;
+    }
+
+    Write(file, usedFiles);
+    for (auto& record : m_Files)
+    {
+        if (record.second.used)
+        {
+            WriteString(file, record.first);
+            Write(file, record.second.size);
+            Write(file, record.second.modificationTime);
+            Write(file, record.second.inode);
+            Write(file, record.second.hash);
         }
     }
+
+    Write(file, static_cast<uint32_t>(m_Keys.size()));
+    for (auto& key : m_Keys)
+    {
+        WriteString(file, key.first);
+        Write(file, key.second);
+    }
+
+    file.close();
+    if (file.fail())
+    {
+        Log::Error() << "Failed to write cache to " << temporaryPath;
+        return;
+    }
+
+    std::error_code errorCode;
+    std::filesystem::rename(temporaryPath, m_CachePath, errorCode);
+    if (errorCode)
+    {
+        Log::Error() << "Failed to replace " << m_CachePath << ": " << errorCode.message();
+        return;
+    }
+
+    m_Dirty = false;
 }
 
-Cache::~Cache() 
+void Cache::Load()
 {
-    using namespace nlohmann;
-    std::ofstream file(m_CachePath, std::ios::out | std::ios::trunc);
-    if (file.good())
+    std::ifstream file(m_CachePath, std::ios::in | std::ios::binary);
+    if (file.good() == false)
+    {
+        return;
+    }
+
+    uint32_t magic = 0;
+    uint32_t version = 0;
+    if (Read(file, magic) == false || magic != sCacheMagic || Read(file, version) == false || version != sCacheVersion)
+    {
+        Log::Warning() << "Ignoring cache " << m_CachePath << " as it was written by a different version of Forge.";
+        return;
+    }
+
+    bool valid = true;
+    uint32_t count = 0;
+    valid = Read(file, count);
+    for (uint32_t i = 0; valid && i < count; ++i)
+    {
+        std::string path;
+        FileRecord record;
+        record.used = false;
+        valid = ReadString(file, path) && Read(file, record.size) && Read(file, record.modificationTime) && Read(file, record.inode) && Read(file, record.hash);
+        if (valid)
+        {
+            m_Files[path] = record;
+        }
+    }
+
+    valid = valid && Read(file, count);
+    for (uint32_t i = 0; valid && i < count; ++i)
+    {
+        std::string path;
+        uint64_t key = 0;
+        valid = ReadString(file, path) && Read(file, key);
+        if (valid)
+        {
+            m_Keys[path] = key;
+        }
+    }
+
+    if (valid == false)
     {
-        json j;
-        j["cache"] = m_Cache;
-        file << j.dump();
-        file.close();
+        Log::Warning() << "Cache " << m_CachePath << " is truncated, all assets will be rebuilt.";
+        m_Files.clear();
+        m_Keys.clear();
     }
 }
 
-void Cache::Add(Asset* pAsset)
+uint64_t Cache::GetFileHash(const std::filesystem::path& path)
 {
-    m_Cache[pAsset->GetPath().generic_string()] = pAsset->GetHash();
+    std::error_code errorCode;
+    const uint64_t size = static_cast<uint64_t>(std::filesystem::file_size(path, errorCode));
+    if (errorCode)
+    {
+        return 0;
+    }
+
+    const std::filesystem::file_time_type lastWriteTime = std::filesystem::last_write_time(path, errorCode);
+    if (errorCode)
+    {
+        return 0;
+    }
+    const int64_t modificationTime = static_cast<int64_t>(lastWriteTime.time_since_epoch().count());
+
+    uint64_t inode = 0;
+#ifndef TARGET_PLATFORM_WINDOWS
+    struct stat fileStat;
+    if (stat(path.c_str(), &fileStat) == 0)
+    {
+        inode = static_cast<uint64_t>(fileStat.st_ino);
+    }
+#endif
+
+    const std::string key = path.generic_string();
+    auto it = m_Files.find(key);
+    if (it != m_Files.end() && it->second.size == size && it->second.modificationTime == modificationTime && it->second.inode == inode)
+    {
+        it->second.used = true;
+        return it->second.hash;
+    }
+
+    const uint64_t hash = CalculateFileHash(path);
+    const bool racy = (std::filesystem::file_time_type::clock::now() - lastWriteTime) < sRacyModificationWindow;
+    m_Files[key] = {size, racy ? -1 : modificationTime, inode, hash, true};
+    m_Dirty = true;
+    return hash;
 }
-    
-bool Cache::NeedsRebuild(Asset* pAsset)
-{ 
-    auto it = m_Cache.find(pAsset->GetPath().generic_string());
-    return (it == m_Cache.end()) || (it->second != pAsset->GetHash());
+
+uint64_t Cache::CalculateRebuildKey(Asset* pAsset, const std::string& parameters)
+{
+    XXHash64 key(sCacheVersion);
+
+    const uint64_t compilerHash = GetFileHash(pAsset->GetCompiler()->GetPath());
+    key.add(&compilerHash, sizeof(uint64_t));
+    const Plugin* pPlugin = pAsset->GetCompiler()->GetPlugin();
+    if (pPlugin != nullptr)
+    {
+        const uint64_t pluginHash = GetFileHash(pPlugin->GetPath());
+        key.add(&pluginHash, sizeof(uint64_t));
+    }
+    key.add(parameters.data(), parameters.size());
+
+    // Paths are relative to the asset so that renaming a file in a source directory changes the key.
+    const std::filesystem::path assetDir = std::filesystem::path(pAsset->GetPath()).remove_filename();
+    for (const std::filesystem::path& input : pAsset->GetInputs())
+    {
+        const std::string relativePath = input.lexically_relative(assetDir).generic_string();
+        const uint64_t pathLength = relativePath.size();
+        const uint64_t inputHash = GetFileHash(input);
+        key.add(&pathLength, sizeof(uint64_t));
+        key.add(relativePath.data(), relativePath.size());
+        key.add(&inputHash, sizeof(uint64_t));
+    }
+
+    return key.hash();
 }
 
 } // namespace Genesis::ResComp
@@ -15,9 +15,11 @@
 // You should have received a copy of the GNU General Public License
 // along with Genesis. If not, see <http://www.gnu.org/licenses/>.
 
+
 #pragma once
 
 #include <filesystem>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 
@@ -26,18 +28,41 @@ namespace Genesis::ResComp
 
 class Asset;
 
+// Decides which assets need rebuilding. An asset's rebuild key combines the
+// contents of all of its inputs, its compiler and the parameters it is
+// compiled with. Each input file's content hash is remembered together with
+// its size, modification time and inode, so unchanged files are never read.
+// The cache is stored in a compact binary file in the intermediates directory.
 class Cache
 {
 public:
 	Cache(const std::filesystem::path& intermediatesDir);
 	~Cache();
 
-	void Add(Asset* pAsset);
-	bool NeedsRebuild(Asset* pAsset);
+	void Add(Asset* pAsset); // Records that the asset was built with the key calculated by the last NeedsRebuild().
+	bool NeedsRebuild(Asset* pAsset, const std::string& parameters);
+	void Save();
 
 private:
+	struct FileRecord
+	{
+		uint64_t size;
+		int64_t modificationTime;
+		uint64_t inode;
+		uint64_t hash;
+		bool used;
+	};
+
+	void Load();
+	uint64_t GetFileHash(const std::filesystem::path& path);
+	uint64_t CalculateRebuildKey(Asset* pAsset, const std::string& parameters);
+
 	std::filesystem::path m_CachePath;
-	std::unordered_map<std::string, uint64_t> m_Cache;
+	std::mutex m_Mutex; // Add() is called from the RPC server's threads.
+	std::unordered_map<std::string, FileRecord> m_Files;
+	std::unordered_map<std::string, uint64_t> m_Keys; // Rebuild key of each asset's last successful build.
+	std::unordered_map<std::string, uint64_t> m_PendingKeys; // Keys of assets currently being built.
+	bool m_Dirty;
 };
 
-} // namespace Genesis::ResComp
\ No newline at end of file
+} // namespace Genesis::ResComp
@@ -17,17 +17,13 @@
 
 #include "compiler.hpp"
 
-#include <fstream>
-#include "filehash.hpp"
-
 namespace Genesis::ResComp
 {
 
 Compiler::Compiler(const std::filesystem::path& path)
-    : m_Path(path), m_Hash(0)
+    : m_Path(path)
 {
     m_Name = path.stem().generic_string();
-    m_Hash = CalculateFileHash(path);
 }
 
 const std::filesystem::path& Compiler::GetPath() const
@@ -40,9 +36,14 @@ const std::string& Compiler::GetName() const
     return m_Name;
 }
 
-uint64_t Compiler::GetHash() const 
+Plugin* Compiler::GetPlugin() const
+{
+    return m_pPlugin.get();
+}
+
+void Compiler::SetPlugin(PluginUniquePtr pPlugin)
 {
-    return m_Hash;
+    m_pPlugin = std::move(pPlugin);
 }
 
 } // namespace Genesis::ResComp
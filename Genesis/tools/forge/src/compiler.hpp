@@ -20,6 +20,8 @@
 #include <filesystem>
 #include <string>
 
+#include "plugin.hpp"
+
 namespace Genesis::ResComp
 {
 
@@ -30,12 +32,15 @@ public:
 
     const std::filesystem::path& GetPath() const;
     const std::string& GetName() const;
-    uint64_t GetHash() const;
+
+    // Set if the compiler is also available as a plugin which Forge can run in-process.
+    Plugin* GetPlugin() const;
+    void SetPlugin(PluginUniquePtr pPlugin);
 
 private:
     std::filesystem::path m_Path;
     std::string m_Name;
-    uint64_t m_Hash;
+    PluginUniquePtr m_pPlugin;
 };
 
 } // namespace Genesis::ResComp
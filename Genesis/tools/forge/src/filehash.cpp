@@ -26,21 +26,25 @@ namespace Genesis::ResComp
 
 uint64_t CalculateFileHash(const std::filesystem::path& path)
 {
-    uint64_t hash = 0;
     std::ifstream file(path, std::ios::in | std::ios::binary);
-    if (file.good())
+    if (file.good() == false)
     {
-        file.seekg(0, file.end);
-        size_t length = static_cast<size_t>(file.tellg());
-        file.seekg(0, file.beg);
-        std::vector<char> buffer;
-        buffer.resize(length);
-        file.read(buffer.data(), length);
-        file.close();
+        return 0;
+    }
 
-        hash = XXHash64::hash(buffer.data(), length, 0);
+    static const size_t sBufferSize = 64 * 1024;
+    std::vector<char> buffer(sBufferSize);
+    XXHash64 hash(0);
+    while (file)
+    {
+        file.read(buffer.data(), buffer.size());
+        const std::streamsize bytesRead = file.gcount();
+        if (bytesRead > 0)
+        {
+            hash.add(buffer.data(), static_cast<uint64_t>(bytesRead));
+        }
     }
-    return hash;
+    return hash.hash();
 }
 
 } // namespace Genesis::ResComp
@@ -22,6 +22,8 @@
 namespace Genesis::ResComp
 {
 
+// Streams the file through XXHash64, so memory use doesn't depend on the file's size.
+// Returns 0 if the file can't be read.
 uint64_t CalculateFileHash(const std::filesystem::path& path);
 
 } // namespace Genesis::ResComp
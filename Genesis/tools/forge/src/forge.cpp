@@ -21,7 +21,9 @@
 #include "cache.hpp"
 #include "compiler.hpp"
 #include "filewatcher.hpp"
+#include "plugin.hpp"
 
+#include <cstring>
 #include <filesystem>
 #include <log.hpp>
 #include <platform.hpp>
@@ -36,13 +38,14 @@ namespace Genesis
 namespace ResComp
 {
 
-Forge::Forge(Mode mode, const std::filesystem::path& assetsDir, const std::filesystem::path& compilersDir, const std::filesystem::path& dataDir, const std::filesystem::path& intermediatesDir)
+Forge::Forge(Mode mode, const std::filesystem::path& assetsDir, const std::filesystem::path& compilersDir, const std::filesystem::path& dataDir, const std::filesystem::path& intermediatesDir, bool usePlugins)
     : m_Mode(mode)
     , m_AssetsDir(assetsDir)
     , m_CompilersDir(compilersDir)
     , m_DataDir(dataDir)
     , m_IntermediatesDir(intermediatesDir)
     , m_QuitRequested(false)
+    , m_UsePlugins(usePlugins)
 {
 }
 
@@ -77,7 +80,14 @@ bool Forge::Run()
 
     for (auto& compiler : m_CompilersMap)
     {
-        Log::Info() << "Compiler found: " << compiler.first;
+        if (compiler.second->GetPlugin() != nullptr)
+        {
+            Log::Info() << "Compiler found: " << compiler.first << " (plugin)";
+        }
+        else
+        {
+            Log::Info() << "Compiler found: " << compiler.first;
+        }
     }
 
     if (m_Mode == Mode::Standalone)
@@ -145,11 +155,27 @@ bool Forge::InitializeDirectories()
 
 void Forge::AggregateCompilers()
 {
+#if defined(TARGET_PLATFORM_WINDOWS)
+    const std::filesystem::path pluginExtension(".dll");
+#else
+    const std::filesystem::path pluginExtension(".so");
+#endif
+
+    std::vector<std::filesystem::path> plugins;
     for (const auto& dirEntry : std::filesystem::recursive_directory_iterator(m_CompilersDir))
     {
         const std::filesystem::path path = dirEntry.path();
         const std::string fileName = path.stem().generic_string();
 
+        if (path.extension() == pluginExtension)
+        {
+            if (Genesis::StringEndsWith(fileName, "CompPlugin"))
+            {
+                plugins.push_back(path);
+            }
+            continue;
+        }
+
 #ifdef TARGET_PLATFORM_WINDOWS
         const bool isExecutable = (path.extension() == ".exe");
 #else
@@ -162,6 +188,26 @@ void Forge::AggregateCompilers()
             m_CompilersMap[pCompiler->GetName()] = pCompiler;
         }
     }
+
+    if (m_UsePlugins == false)
+    {
+        return;
+    }
+
+    // A plugin is only used alongside its executable, which remains the fallback if the plugin can't be used.
+    for (const std::filesystem::path& path : plugins)
+    {
+        const std::string pluginName = path.stem().generic_string();
+        CompilerSharedPtr pCompiler = FindCompiler(pluginName.substr(0, pluginName.size() - std::strlen("Plugin")));
+        if (pCompiler != nullptr)
+        {
+            PluginUniquePtr pPlugin = std::make_unique<Plugin>(this, path);
+            if (pPlugin->IsLoaded())
+            {
+                pCompiler->SetPlugin(std::move(pPlugin));
+            }
+        }
+    }
 }
 
 void Forge::AggregateKnownAssets()
@@ -251,21 +297,9 @@ void Forge::InitializeRPCServer()
                        });
 
     m_pRPCServer->bind("log",
-                       [](const std::string& text, int level)
+                       [this](const std::string& text, int level)
                        {
-                           Log::Level logLevel = static_cast<Log::Level>(level);
-                           if (logLevel == Log::Level::Info)
-                           {
-                               Log::Info() << text;
-                           }
-                           else if (logLevel == Log::Level::Warning)
-                           {
-                               Log::Warning() << text;
-                           }
-                           else if (logLevel == Log::Level::Error)
-                           {
-                               Log::Error() << text;
-                           }
+                           OnCompilerLog(text, level);
                        });
 
     m_pRPCServer->bind("quit",
@@ -299,6 +333,8 @@ bool Forge::CompileAssets()
         }
     }
 
+    m_pCache->Save();
+
     Log::Info() << "Forge asset compilation completed, " << compiled << " compiled, " << cached << " cached, " << errors << " errors.";
 
     return errors == 0;
@@ -311,12 +347,25 @@ Forge::CompileResult Forge::CompileAsset(Asset* pAsset)
         Log::Error() << "Failed to compile " << pAsset->GetPath() << ": Invalid asset.";
         return CompileResult::Error;
     }
-    else if (m_pCache->NeedsRebuild(pAsset))
+
+    std::stringstream arguments;
+    arguments << "-a " << m_AssetsDir << " -d " << m_DataDir << " -f " << pAsset->GetPath() << " -m forge";
+
+    if (m_pCache->NeedsRebuild(pAsset, arguments.str()))
     {
         Log::Info() << "Compiling " << pAsset->GetPath() << "...";
 
-        std::stringstream arguments;
-        arguments << "-a " << m_AssetsDir << " -d " << m_DataDir << " -f " << pAsset->GetPath() << " -m forge";
+        Plugin* pPlugin = pAsset->GetCompiler()->GetPlugin();
+        if (pPlugin != nullptr && pPlugin->Instantiate())
+        {
+            const int result = pPlugin->Compile(m_AssetsDir, m_DataDir, pAsset->GetPath());
+            if (result != 0)
+            {
+                Log::Error() << "Failed to compile " << pAsset->GetPath() << ", compiler plugin returned error code " << result;
+                return CompileResult::Error;
+            }
+            return CompileResult::Success;
+        }
 
         Log::Info() << pAsset->GetCompiler()->GetPath() << " " << arguments.str();
 
@@ -358,5 +407,22 @@ void Forge::OnAssetCompilationFailed(const std::filesystem::path& asset, const s
     Log::Error() << "Failed to compile " << asset << ": " << reason;
 }
 
+void Forge::OnCompilerLog(const std::string& text, int level)
+{
+    Log::Level logLevel = static_cast<Log::Level>(level);
+    if (logLevel == Log::Level::Info)
+    {
+        Log::Info() << text;
+    }
+    else if (logLevel == Log::Level::Warning)
+    {
+        Log::Warning() << text;
+    }
+    else if (logLevel == Log::Level::Error)
+    {
+        Log::Error() << text;
+    }
+}
+
 } // namespace ResComp
 } // namespace Genesis
@@ -56,13 +56,18 @@ public:
         Service
     };
 
-    Forge(Mode mode, const std::filesystem::path& assetsDir, const std::filesystem::path& compilersDir, const std::filesystem::path& dataDir, const std::filesystem::path& intermediatesDir);
+    Forge(Mode mode, const std::filesystem::path& assetsDir, const std::filesystem::path& compilersDir, const std::filesystem::path& dataDir, const std::filesystem::path& intermediatesDir, bool usePlugins);
     ~Forge();
 
     bool Run();
 
     CompilerSharedPtr FindCompiler(const std::string& compilerName) const;
 
+    // Results reported by the compilers, either over RPC or directly by compiler plugins.
+    void OnResourceBuilt(const std::filesystem::path& asset, const std::filesystem::path& sourceFile, const std::filesystem::path& destinationFile);
+    void OnAssetCompilationFailed(const std::filesystem::path& asset, const std::string& reason);
+    void OnCompilerLog(const std::string& text, int level);
+
 private:
     enum class CompileResult
     {
@@ -71,9 +76,6 @@ private:
         Error
     };
 
-    void OnResourceBuilt(const std::filesystem::path& asset, const std::filesystem::path& sourceFile, const std::filesystem::path& destinationFile);
-    void OnAssetCompilationFailed(const std::filesystem::path& asset, const std::string& reason);
-
     void InitializeCache();
     void InitializeRPCClient();
     void InitializeRPCServer();
@@ -96,6 +98,7 @@ private:
     CacheUniquePtr m_pCache;
     std::unique_ptr<FileWatcher> m_pFileWatcher;
     bool m_QuitRequested;
+    bool m_UsePlugins;
 };
 
 } // namespace ResComp
@@ -42,6 +42,7 @@ int main(int argc, char** argv)
     parser.set_required<std::string>("c", "compilers-dir", "Compilers directory, containing all compiler binaries.");
     parser.set_required<std::string>("d", "data-dir", "Data directory, to which compiled resources will be written to.");
     parser.set_required<std::string>("i", "intermediates-dir", "Intermediates directory, containing temporary files used by the build process.");
+    parser.set_optional<bool>("n", "no-plugins", false, "Always run compilers as separate processes, even if they are available as plugins.");
     parser.run_and_exit_if_error();
 
     Forge::Mode mode(Forge::Mode::Standalone);
@@ -65,6 +66,6 @@ int main(int argc, char** argv)
     std::filesystem::path dataDir(parser.get<std::string>("d"));
     std::filesystem::path intermediatesDir(parser.get<std::string>("i"));
 
-    Forge forge(mode, assetsDir, compilersDir, dataDir, intermediatesDir);
+    Forge forge(mode, assetsDir, compilersDir, dataDir, intermediatesDir, parser.get<bool>("n") == false);
     return forge.Run() == true ? 0 : -1;
 }
@@ -0,0 +1,150 @@
+// Copyright 2026 Pedro Nunes
+//
+// This file is part of Genesis.
+//
+// Genesis is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Genesis is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Genesis. If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "plugin.hpp"
+
+#include "forge.hpp"
+
+#include <log.hpp>
+#include <platform.hpp>
+
+#if defined(TARGET_PLATFORM_WINDOWS)
+#include <Windows.h>
+#else
+#include <dlfcn.h>
+#endif
+
+namespace Genesis::ResComp
+{
+
+Plugin::Plugin(Forge* pForge, const std::filesystem::path& path)
+    : m_Path(path)
+    , m_pLibrary(nullptr)
+    , m_pPlugin(nullptr)
+    , m_Host{pForge, &Plugin::OnResourceBuilt, &Plugin::OnAssetCompilationFailed, &Plugin::OnLog}
+    , m_pCompiler(nullptr)
+    , m_InstantiationFailed(false)
+{
+    void* pEntryPoint = nullptr;
+#if defined(TARGET_PLATFORM_WINDOWS)
+    HMODULE hModule = LoadLibraryW(path.c_str());
+    if (hModule != nullptr)
+    {
+        m_pLibrary = hModule;
+        pEntryPoint = reinterpret_cast<void*>(GetProcAddress(hModule, sCompilerPluginEntryPoint));
+    }
+    else
+    {
+        Log::Warning() << "Failed to load compiler plugin " << path << ": " << GetLastError();
+        return;
+    }
+#else
+    m_pLibrary = dlopen(path.c_str(), RTLD_NOW | RTLD_LOCAL);
+    if (m_pLibrary != nullptr)
+    {
+        pEntryPoint = dlsym(m_pLibrary, sCompilerPluginEntryPoint);
+    }
+    else
+    {
+        Log::Warning() << "Failed to load compiler plugin " << path << ": " << dlerror();
+        return;
+    }
+#endif
+
+    if (pEntryPoint == nullptr)
+    {
+        Log::Warning() << "Compiler plugin " << path << " doesn't export " << sCompilerPluginEntryPoint << ".";
+        return;
+    }
+
+    const CompilerPlugin* pPlugin = reinterpret_cast<GetCompilerPluginFunction>(pEntryPoint)();
+    if (pPlugin == nullptr || pPlugin->version != sCompilerPluginVersion)
+    {
+        Log::Warning() << "Compiler plugin " << path << " was built for a different version of Forge.";
+        return;
+    }
+
+    m_pPlugin = pPlugin;
+}
+
+Plugin::~Plugin()
+{
+    if (m_pCompiler != nullptr)
+    {
+        m_pPlugin->Destroy(m_pCompiler);
+    }
+
+    if (m_pLibrary != nullptr)
+    {
+#if defined(TARGET_PLATFORM_WINDOWS)
+        FreeLibrary(reinterpret_cast<HMODULE>(m_pLibrary));
+#else
+        dlclose(m_pLibrary);
+#endif
+    }
+}
+
+bool Plugin::IsLoaded() const
+{
+    return m_pPlugin != nullptr;
+}
+
+const std::filesystem::path& Plugin::GetPath() const
+{
+    return m_Path;
+}
+
+bool Plugin::Instantiate()
+{
+    if (m_pCompiler == nullptr && m_InstantiationFailed == false && IsLoaded())
+    {
+        m_pCompiler = m_pPlugin->Create(&m_Host);
+        if (m_pCompiler == nullptr)
+        {
+            Log::Warning() << "Compiler plugin " << m_Path << " failed to initialize, its executable will be used instead.";
+            m_InstantiationFailed = true;
+        }
+    }
+
+    return m_pCompiler != nullptr;
+}
+
+int Plugin::Compile(const std::filesystem::path& assetsDir, const std::filesystem::path& dataDir, const std::filesystem::path& file)
+{
+    const std::string assetsDirString = assetsDir.generic_string();
+    const std::string dataDirString = dataDir.generic_string();
+    const std::string fileString = file.generic_string();
+    return m_pPlugin->Compile(m_pCompiler, assetsDirString.c_str(), dataDirString.c_str(), fileString.c_str());
+}
+
+void Plugin::OnResourceBuilt(void* pContext, const char* pAsset, const char* pSourceFile, const char* pDestinationFile)
+{
+    reinterpret_cast<Forge*>(pContext)->OnResourceBuilt(pAsset, pSourceFile, pDestinationFile);
+}
+
+void Plugin::OnAssetCompilationFailed(void* pContext, const char* pAsset, const char* pReason)
+{
+    reinterpret_cast<Forge*>(pContext)->OnAssetCompilationFailed(pAsset, pReason);
+}
+
+void Plugin::OnLog(void* pContext, const char* pText, int level)
+{
+    reinterpret_cast<Forge*>(pContext)->OnCompilerLog(pText, level);
+}
+
+} // namespace Genesis::ResComp
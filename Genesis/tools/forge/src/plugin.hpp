@@ -0,0 +1,61 @@
+// Copyright 2026 Pedro Nunes
+//
+// This file is part of Genesis.
+//
+// Genesis is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Genesis is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Genesis. If not, see <http://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+#include <compilerplugin.hpp>
+
+#include <filesystem>
+#include <memory>
+
+namespace Genesis::ResComp
+{
+
+class Forge;
+
+// A compiler built as a shared library, loaded once and then used for every
+// asset which needs that compiler instead of launching its executable.
+class Plugin
+{
+public:
+    Plugin(Forge* pForge, const std::filesystem::path& path);
+    ~Plugin();
+
+    bool IsLoaded() const;
+    const std::filesystem::path& GetPath() const;
+
+    // Creates the compiler the first time it is needed. If this fails the executable should be used instead.
+    bool Instantiate();
+    int Compile(const std::filesystem::path& assetsDir, const std::filesystem::path& dataDir, const std::filesystem::path& file);
+
+private:
+    static void OnResourceBuilt(void* pContext, const char* pAsset, const char* pSourceFile, const char* pDestinationFile);
+    static void OnAssetCompilationFailed(void* pContext, const char* pAsset, const char* pReason);
+    static void OnLog(void* pContext, const char* pText, int level);
+
+    std::filesystem::path m_Path;
+    void* m_pLibrary;
+    const CompilerPlugin* m_pPlugin;
+    CompilerPluginHost m_Host;
+    void* m_pCompiler;
+    bool m_InstantiationFailed;
+};
+
+using PluginUniquePtr = std::unique_ptr<Plugin>;
+
+} // namespace Genesis::ResComp
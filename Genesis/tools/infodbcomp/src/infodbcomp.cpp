@@ -0,0 +1,134 @@
+// Copyright 2026 Pedro Nunes
+//
+// This file is part of Genesis.
+//
+// Genesis is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Genesis is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Genesis. If not, see <http://www.gnu.org/licenses/>.
+
+#include "infodbcomp.hpp"
+
+// clang-format off
+#include <externalheadersbegin.hpp>
+#include <nlohmann/json.hpp>
+#include <externalheadersend.hpp>
+// clang-format on
+
+#include <fstream>
+#include <infodbcompiler.hpp>
+#include <log.hpp>
+
+namespace Genesis
+{
+namespace ResComp
+{
+
+InfoDbComp::InfoDbComp()
+    : m_KeyElement("Name")
+{
+}
+
+InfoDbComp::~InfoDbComp() {}
+
+int InfoDbComp::Run()
+{
+    if (ReadAsset(GetFile()) == false)
+    {
+        OnAssetCompilationFailed(GetFile(), "Invalid info database asset file.");
+        return -1;
+    }
+
+    if (std::filesystem::is_directory(m_SourceDirectory) == false)
+    {
+        OnAssetCompilationFailed(GetFile(), "Source directory doesn't exist.");
+        return -1;
+    }
+
+    Serialization::InfoDatabase database;
+    Serialization::InfoDatabaseCompiler compiler(database, m_KeyElement);
+    const std::vector<std::filesystem::path> sourceFiles = Serialization::InfoDatabaseCompiler::GetSourceFiles(m_SourceDirectory);
+    for (const std::filesystem::path& sourceFile : sourceFiles)
+    {
+        if (compiler.CompileFile(sourceFile) == false)
+        {
+            OnAssetCompilationFailed(GetFile(), "Failed to compile " + sourceFile.string());
+            return -1;
+        }
+    }
+
+    const std::filesystem::path targetFile = GetTargetPath();
+    std::ofstream file(targetFile, std::ios::out | std::ios::trunc | std::ios::binary);
+    if (file.good() == false)
+    {
+        OnAssetCompilationFailed(GetFile(), "Couldn't create " + targetFile.string());
+        return -1;
+    }
+
+    bitsery::Serializer<bitsery::OutputBufferedStreamAdapter> ser{file};
+    ser.object(database);
+    ser.adapter().flush();
+    file.close();
+
+    Log::Info() << "Compiled " << database.entries.size() << " entries and " << database.strings.size() << " strings from " << sourceFiles.size() << " files.";
+    OnResourceBuilt(GetFile(), m_SourceDirectory, targetFile);
+    return 0;
+}
+
+bool InfoDbComp::ReadAsset(const std::filesystem::path& assetPath)
+{
+    // Forget the previous asset's key, as a plugin instance compiles many databases.
+    m_KeyElement = "Name";
+
+    using namespace nlohmann;
+    std::ifstream file(assetPath);
+    if (file.good())
+    {
+        json j;
+        file >> j;
+        file.close();
+
+        json::iterator it = j.find("source");
+        if (it == j.end() || it->is_string() == false)
+        {
+            Log::Error() << "Couldn't find required 'source' field in asset " << assetPath;
+            return false;
+        }
+        else
+        {
+            m_SourceDirectory = assetPath;
+            m_SourceDirectory = m_SourceDirectory.remove_filename() / it->get<std::string>();
+        }
+
+        it = j.find("key");
+        if (it != j.end() && it->is_string())
+        {
+            m_KeyElement = it->get<std::string>();
+        }
+
+        return true;
+    }
+    else
+    {
+        return false;
+    }
+}
+
+std::filesystem::path InfoDbComp::GetTargetPath() const
+{
+    std::filesystem::path targetPath = GetDataDir() / std::filesystem::relative(GetFile(), GetAssetsDir()).remove_filename();
+    std::filesystem::create_directories(targetPath);
+    const std::string targetFileName = GetFile().stem().string() + ".idb";
+    return targetPath / targetFileName;
+}
+
+} // namespace ResComp
+} // namespace Genesis
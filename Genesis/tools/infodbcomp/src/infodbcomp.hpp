@@ -0,0 +1,53 @@
+// Copyright 2026 Pedro Nunes
+//
+// This file is part of Genesis.
+//
+// Genesis is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Genesis is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Genesis. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <filesystem>
+#include <rescomp.hpp>
+#include <string>
+
+namespace Genesis
+{
+namespace ResComp
+{
+
+/////////////////////////////////////////////////////////////////////
+// InfoDbComp
+// Compiles every XML file in a directory into a single info database.
+// Each child of a file's root element becomes an entry, identified by
+// the text of its key element (by default, <Name>).
+/////////////////////////////////////////////////////////////////////
+
+class InfoDbComp : public ResComp
+{
+public:
+    InfoDbComp();
+    virtual ~InfoDbComp() override;
+
+    virtual int Run() override;
+
+private:
+    bool ReadAsset(const std::filesystem::path& assetPath);
+    std::filesystem::path GetTargetPath() const;
+
+    std::filesystem::path m_SourceDirectory;
+    std::string m_KeyElement;
+};
+
+} // namespace ResComp
+} // namespace Genesis
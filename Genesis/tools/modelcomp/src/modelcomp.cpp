@@ -98,6 +98,10 @@ int ModelComp::Run()
 
 bool ModelComp::ReadAsset(const std::filesystem::path& assetPath)
 {
+    // When running as a plugin the same ModelComp compiles many assets, so nothing can carry over.
+    m_Materials.clear();
+    m_GeneratePhysicsMesh = false;
+
     using namespace nlohmann;
     std::ifstream file(assetPath);
     if (file.good())
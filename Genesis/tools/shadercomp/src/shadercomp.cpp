@@ -45,13 +45,10 @@ ShaderComp::~ShaderComp()
     }
 }
 
-bool ShaderComp::Initialize(int argc, char** argv) 
+// The hidden window and its GL context are only used to validate shaders. When running as a
+// plugin, they are created once and reused for every shader Forge compiles.
+bool ShaderComp::OnInitialize()
 {
-    if (ResComp::Initialize(argc, argv) == false)
-    {
-        return false;
-    }
-
     if (SDL_Init(SDL_INIT_VIDEO) < 0)
     {
         Log::Error() << SDL_GetError();
@@ -131,12 +128,29 @@ int ShaderComp::Run()
     }
 }
 
-bool ShaderComp::ValidateShader(const std::filesystem::path& path) 
+// Logs the info log and returns false if the shader doesn't compile.
+static bool CompileShader(GLuint shaderID, const std::string& shaderCode)
 {
-    // Create the shaders
-    GLuint vertexShaderID = glCreateShader(GL_VERTEX_SHADER);
-    GLuint fragmentShaderID = glCreateShader(GL_FRAGMENT_SHADER);
+    const char* pSourcePointer = shaderCode.c_str();
+    glShaderSource(shaderID, 1, &pSourcePointer, nullptr);
+    glCompileShader(shaderID);
 
+    GLint compilationSuccessful = GL_FALSE;
+    glGetShaderiv(shaderID, GL_COMPILE_STATUS, &compilationSuccessful);
+    if (compilationSuccessful == GL_FALSE)
+    {
+        int infoLogLength = 0;
+        glGetShaderiv(shaderID, GL_INFO_LOG_LENGTH, &infoLogLength);
+        std::vector<char> shaderErrorMessage(infoLogLength + 1);
+        glGetShaderInfoLog(shaderID, infoLogLength, nullptr, &shaderErrorMessage[0]);
+        Log::Error() << shaderErrorMessage.data();
+        return false;
+    }
+    return true;
+}
+
+bool ShaderComp::ValidateShader(const std::filesystem::path& path) 
+{
     std::string shaderCode;
     std::ifstream shaderFile(path);
 
@@ -159,66 +173,41 @@ bool ShaderComp::ValidateShader(const std::filesystem::path& path)
     const std::string vertexShaderCode = "#version 330\n#define VERTEX_PROGRAM\n#line 0\n" + shaderCode;
     const std::string fragmentShaderCode = "#version 330\n#define FRAGMENT_PROGRAM\n#line 0\n" + shaderCode;
 
-    GLint compilationSuccessful = GL_FALSE;
-    int infoLogLength = 0;
-
-    // Compile Vertex Shader
-    const char* vertexSourcePointer = vertexShaderCode.c_str();
-    glShaderSource(vertexShaderID, 1, &vertexSourcePointer, nullptr);
-    glCompileShader(vertexShaderID);
-
-    // Check Vertex Shader
-    glGetShaderiv(vertexShaderID, GL_COMPILE_STATUS, &compilationSuccessful);
-    if (compilationSuccessful == GL_FALSE)
-    {
-        glGetShaderiv(vertexShaderID, GL_INFO_LOG_LENGTH, &infoLogLength);
-        std::vector<char> vertexShaderErrorMessage(infoLogLength + 1);
-        glGetShaderInfoLog(vertexShaderID, infoLogLength, nullptr, &vertexShaderErrorMessage[0]);
-        Log::Error()  << vertexShaderErrorMessage.data();
-        return false;
-    }
-
-    // Compile Fragment Shader
-    const char* fragmentSourcePointer = fragmentShaderCode.c_str();
-    glShaderSource(fragmentShaderID, 1, &fragmentSourcePointer, nullptr);
-    glCompileShader(fragmentShaderID);
+    // Every object created from here on is deleted before returning, whether or not the shader is valid.
+    GLuint vertexShaderID = glCreateShader(GL_VERTEX_SHADER);
+    GLuint fragmentShaderID = glCreateShader(GL_FRAGMENT_SHADER);
+    bool isValid = CompileShader(vertexShaderID, vertexShaderCode) && CompileShader(fragmentShaderID, fragmentShaderCode);
 
-    // Check Fragment Shader
-    glGetShaderiv(fragmentShaderID, GL_COMPILE_STATUS, &compilationSuccessful);
-    if (compilationSuccessful == GL_FALSE)
+    if (isValid)
     {
-        glGetShaderiv(fragmentShaderID, GL_INFO_LOG_LENGTH, &infoLogLength);
-        std::vector<char> fragmentShaderErrorMessage(infoLogLength + 1);
-        glGetShaderInfoLog(fragmentShaderID, infoLogLength, nullptr, &fragmentShaderErrorMessage[0]);
-        Log::Error() << fragmentShaderErrorMessage.data();
-        return false;
-    }
-
-    // Link the program
-    GLuint programHandle = glCreateProgram();
-    glAttachShader(programHandle, vertexShaderID);
-    glAttachShader(programHandle, fragmentShaderID);
-    glLinkProgram(programHandle);
+        // Link the program
+        GLuint programHandle = glCreateProgram();
+        glAttachShader(programHandle, vertexShaderID);
+        glAttachShader(programHandle, fragmentShaderID);
+        glLinkProgram(programHandle);
+
+        // Check the program
+        GLint linkSuccessful = GL_FALSE;
+        glGetProgramiv(programHandle, GL_LINK_STATUS, &linkSuccessful);
+        if (linkSuccessful == GL_FALSE)
+        {
+            int infoLogLength = 0;
+            glGetProgramiv(programHandle, GL_INFO_LOG_LENGTH, &infoLogLength);
+            std::vector<char> programErrorMessage(infoLogLength + 1);
+            glGetProgramInfoLog(programHandle, infoLogLength, nullptr, &programErrorMessage[0]);
+            Log::Error() << &programErrorMessage[0];
+            isValid = false;
+        }
 
-    // Check the program
-    GLint linkSuccessful = GL_FALSE;
-    glGetProgramiv(programHandle, GL_LINK_STATUS, &linkSuccessful);
-    if (linkSuccessful == GL_FALSE)
-    {
-        glGetProgramiv(programHandle, GL_INFO_LOG_LENGTH, &infoLogLength);
-        std::vector<char> programErrorMessage(infoLogLength + 1);
-        glGetProgramInfoLog(programHandle, infoLogLength, nullptr, &programErrorMessage[0]);
-        Log::Error() << &programErrorMessage[0];
-        return false;
+        glDetachShader(programHandle, vertexShaderID);
+        glDetachShader(programHandle, fragmentShaderID);
+        glDeleteProgram(programHandle);
     }
 
-    glDetachShader(programHandle, vertexShaderID);
-    glDetachShader(programHandle, fragmentShaderID);
-
     glDeleteShader(vertexShaderID);
     glDeleteShader(fragmentShaderID);
 
-    return true;
+    return isValid;
 }
 
 } // namespace Genesis::ResComp
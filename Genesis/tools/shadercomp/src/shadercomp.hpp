@@ -30,9 +30,11 @@ public:
     ShaderComp();
     virtual ~ShaderComp() override;
 
-    virtual bool Initialize(int argc, char** argv) override;
     virtual int Run() override;
 
+protected:
+    virtual bool OnInitialize() override;
+
 private:
     bool ValidateShader(const std::filesystem::path& path);
     SDL_Window* m_pWindow;